@@ -0,0 +1,59 @@
+//============================================================================
+//                                  I B E X
+// File        : bench_affine2.cpp
+// Author      : IBEX contributors
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#include "ibex.h"
+
+#include <cstdlib>
+
+using namespace std;
+using namespace ibex;
+
+/*
+ * Benchmark of the dense and sparse affine forms.
+ *
+ * Evaluates, with the AF_fAF2 and AF_fAF2_sparse backends, the n-2
+ * expressions x[k]*x[k+1]+sqr(x[k+2])-2*x[k] over n variables (as in
+ * a sparse system of n equations) N times, and reports the time
+ * and the sum of the diameters of the results.
+ */
+template<class T>
+double bench(int n, int N, double& diam) {
+	Affine2Main<T>* x = new Affine2Main<T>[n];
+	for (int i=0; i<n; i++)
+		x[i]=Affine2Main<T>(n,i+1,Interval(1,1.1));
+
+	Timer::start();
+	for (int p=0; p<N; p++) {
+		diam=0;
+		for (int k=0; k<n-2; k++) {
+			Affine2Main<T> f=x[k]*x[k+1]+sqr(x[k+2])-2.0*x[k];
+			diam+=f.itv().diam();
+		}
+	}
+	Timer::stop();
+
+	delete[] x;
+	return Timer::VIRTUAL_TIMELAPSE();
+}
+
+int main(int argc, char** argv) {
+
+	int n = argc>1 ? atoi(argv[1]) : 300;
+	int N = argc>2 ? atoi(argv[2]) : 10;
+
+	double d1,d2;
+	double t1=bench<AF_fAF2>(n,N,d1);
+	double t2=bench<AF_fAF2_sparse>(n,N,d2);
+
+	cout << "dense:            " << t1 << "s (diam=" << d1 << ")" << endl;
+	cout << "sparse:           " << t2 << "s (diam=" << d2 << ")" << endl;
+
+	return 0;
+}
@@ -0,0 +1,79 @@
+//============================================================================
+//                                  I B E X
+// File        : bench_cellheapoptim.cpp
+// Author      : IBEX contributors
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#include "ibex.h"
+
+#include <cstdlib>
+
+using namespace std;
+using namespace ibex;
+
+/*
+ * Microbenchmark of the cell heaps of the optimizer.
+ *
+ * Pushes n cells (with random costs) in two heaps (LB and UB criteria,
+ * as in the optimizer) and pops them all.
+ */
+int main(int argc, char** argv) {
+
+	int n = argc>1 ? atoi(argv[1]) : 1000000;
+
+	// the cells are created in advance so that only
+	// the heap operations are measured
+	vector<OptimCell*> cells;
+	srand(1);
+	for (int i=0; i<n; i++) {
+		double lb=((double) rand())/RAND_MAX;
+		double ub=lb+((double) rand())/RAND_MAX;
+		OptimCell* c=new OptimCell(IntervalVector(1,Interval(lb,ub)));
+		cells.push_back(c);
+	}
+
+	CellHeapOptim heap1(0,CellHeapOptim::LB);
+	CellHeapOptim heap2(0,CellHeapOptim::UB);
+
+	Timer::start();
+	for (int i=0; i<n; i++) {
+		heap1.push(cells[i]);
+		heap2.push(cells[i]);
+	}
+	Timer::stop();
+	double tpush=Timer::VIRTUAL_TIMELAPSE();
+
+	int nb_pop=0;
+	double last=NEG_INFINITY;
+	bool sorted=true;
+
+	Timer::start();
+	// pop alternately from the two heaps, as the optimizer does
+	for (int k=0; !heap1.empty(); k++) {
+		CellHeapOptim& h = k%2==0 ? heap1 : heap2;
+		CellHeapOptim& other = k%2==0 ? heap2 : heap1;
+		OptimCell* c=h.pop();
+		if (k%2==0) {
+			sorted &= c->box[0].lb() >= last;
+			last=c->box[0].lb();
+		}
+		nb_pop++;
+		// c is deleted here if it is on the top of the other heap
+		other.cleantop();
+		h.cleantop();
+	}
+	heap2.flush();
+	Timer::stop();
+	double tpop=Timer::VIRTUAL_TIMELAPSE();
+
+	cout << "cells:        " << n << endl;
+	cout << "push (x2):    " << tpush << "s (" << (2*n/tpush) << " push/s)" << endl;
+	cout << "pop:          " << tpop << "s (" << (nb_pop/tpop) << " pop/s)" << endl;
+	cout << "pop order:    " << (sorted? "ok" : "WRONG") << endl;
+
+	return sorted ? 0 : 1;
+}
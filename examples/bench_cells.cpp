@@ -0,0 +1,61 @@
+//============================================================================
+//                                  I B E X
+// File        : bench_cells.cpp
+// Author      : IBEX contributors
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#include "ibex.h"
+
+#include <cstdlib>
+
+using namespace std;
+using namespace ibex;
+
+/*
+ * Microbenchmark of the creation and deletion of cells.
+ *
+ * Explores a search tree of N nodes in dimension n, as a solver
+ * would do without contraction: each cell is bisected and deleted
+ * and its two subcells are pushed in a stack. A cell is discarded
+ * (like a solution or an empty box) when its box is smaller than 1e-3.
+ */
+int main(int argc, char** argv) {
+
+	int n = argc>1 ? atoi(argv[1]) : 10;
+	int N = argc>2 ? atoi(argv[2]) : 5000000;
+
+	RoundRobin bsc(0);
+	CellStack buffer;
+
+	Timer::start();
+
+	Cell* root=new Cell(IntervalVector(n,Interval(0,1)));
+	root->add<BisectedVar>();
+	bsc.add_backtrackable(*root);
+	buffer.push(root);
+
+	int nb_bisect=0;
+	for (int i=0; i<N && !buffer.empty(); i++) {
+		Cell* c=buffer.pop();
+		if (c->box.max_diam()>1e-3) {
+			pair<IntervalVector,IntervalVector> boxes=bsc.bisect(*c);
+			pair<Cell*,Cell*> new_cells=c->bisect(boxes.first,boxes.second);
+			buffer.push(new_cells.first);
+			buffer.push(new_cells.second);
+			nb_bisect++;
+		}
+		delete c;
+	}
+	buffer.flush();
+
+	Timer::stop();
+
+	cout << "bisections: " << nb_bisect << endl;
+	cout << "time:       " << Timer::VIRTUAL_TIMELAPSE() << "s" << endl;
+
+	return 0;
+}
@@ -0,0 +1,76 @@
+//============================================================================
+//                                  I B E X
+// File        : bench_cse.cpp
+// Author      : IBEX contributors
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#include "ibex.h"
+
+#include <cstdlib>
+
+using namespace std;
+using namespace ibex;
+
+/*
+ * Benchmark of the size of the DAGs built by the parser.
+ *
+ * Loads a system (e.g., a file of the "benchs" directory) and reports
+ * the number of nodes of its function and of the derivative of
+ * its function, and the time of N evaluations, Jacobian matrices
+ * and HC4 propagations on the initial box.
+ */
+int main(int argc, char** argv) {
+
+	if (argc<2) {
+		cerr << "usage: bench_cse filename [N]" << endl;
+		exit(1);
+	}
+
+	int N = argc>2 ? atoi(argv[2]) : 10000;
+
+	System sys(argv[1]);
+	Function& f=sys.f;
+	int n=sys.nb_var;
+	int m=sys.f.image_dim();
+
+	Function df(f,Function::DIFF);
+
+	IntervalVector box(sys.box);
+	IntervalMatrix J(m,n);
+	CtcHC4 hc4(sys.ctrs,0.01);
+
+	f.eval_vector(box); // generate the components once for all
+	f.jacobian(box,J);
+
+	Timer::start();
+	for (int k=0; k<N; k++)
+		f.eval_vector(box);
+	Timer::stop();
+	double t1=Timer::VIRTUAL_TIMELAPSE();
+
+	Timer::start();
+	for (int k=0; k<N; k++)
+		f.jacobian(box,J);
+	Timer::stop();
+	double t2=Timer::VIRTUAL_TIMELAPSE();
+
+	Timer::start();
+	for (int k=0; k<N; k++) {
+		IntervalVector b(box);
+		try { hc4.contract(b); } catch (EmptyBoxException&) { }
+	}
+	Timer::stop();
+	double t3=Timer::VIRTUAL_TIMELAPSE();
+
+	cout << "nodes of f:       " << f.nb_nodes() << endl;
+	cout << "nodes of df:      " << df.nb_nodes() << endl;
+	cout << "eval:             " << t1 << "s" << endl;
+	cout << "jacobian:         " << t2 << "s" << endl;
+	cout << "hc4:              " << t3 << "s" << endl;
+
+	return 0;
+}
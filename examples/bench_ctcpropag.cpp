@@ -0,0 +1,69 @@
+//============================================================================
+//                                  I B E X
+// File        : bench_ctcpropag.cpp
+// Author      : IBEX contributors
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#include "ibex.h"
+
+#include <cstdlib>
+
+using namespace std;
+using namespace ibex;
+
+/*
+ * Benchmark of the propagation loop (HC4) on a system.
+ *
+ * Runs HC4 on the boxes of n random branches of the search tree
+ * of a system (e.g., benchs/katsura-14.bch or benchs/yamamura8a.bch)
+ * and reports the number of propagations per second.
+ */
+int main(int argc, char** argv) {
+
+	if (argc<2) {
+		cerr << "usage: bench_ctcpropag filename [n]" << endl;
+		exit(1);
+	}
+
+	System sys(argv[1]);
+	int n = argc>2 ? atoi(argv[2]) : 1000;
+	int depth = 30;
+
+	CtcHC4 hc4(sys);
+
+	LargestFirst bsc;
+
+	int nb_ctc=0;   // number of propagations
+	int nb_empty=0; // number of empty boxes
+	srand(1);
+
+	Timer::start();
+	// n random descents in the search tree, as a solver would
+	// do (each box is contracted, then bisected, and one of the
+	// two subboxes is chosen randomly).
+	for (int k=0; k<n; k++) {
+		IntervalVector box(sys.box);
+		try {
+			for (int d=0; d<depth; d++) {
+				nb_ctc++;
+				hc4.contract(box);
+				pair<IntervalVector,IntervalVector> p=bsc.bisect(box);
+				box = rand()%2 ? p.first : p.second;
+			}
+		} catch(EmptyBoxException&) {
+			nb_empty++;
+		}
+	}
+	Timer::stop();
+	double t=Timer::VIRTUAL_TIMELAPSE();
+
+	cout << "system:       " << argv[1] << " (" << sys.nb_ctr << " constraints, " << sys.nb_var << " variables)" << endl;
+	cout << "propagations: " << nb_ctc << " (" << nb_empty << " empty boxes)" << endl;
+	cout << "time:         " << t << "s (" << (nb_ctc/t) << " propagations/s)" << endl;
+
+	return 0;
+}
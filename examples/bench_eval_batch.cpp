@@ -0,0 +1,78 @@
+//============================================================================
+//                                  I B E X
+// File        : bench_eval_batch.cpp
+// Author      : IBEX contributors
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#include "ibex.h"
+
+#include <cstdlib>
+
+using namespace std;
+using namespace ibex;
+
+/*
+ * Benchmark of the batched evaluation of a function.
+ *
+ * Evaluates the constraints of a system (e.g., benchs/yamamura8a.bch)
+ * on n random points of the initial box, first point by point
+ * (Function::eval) then by batches (Function::eval_batch),
+ * as the optimizer does when it looks for a loup.
+ */
+int main(int argc, char** argv) {
+
+	if (argc<2) {
+		cerr << "usage: bench_eval_batch filename [n] [batch size]" << endl;
+		exit(1);
+	}
+
+	System sys(argv[1]);
+	int n = argc>2 ? atoi(argv[2]) : 100000;
+	int b = argc>3 ? atoi(argv[3]) : 10;
+
+	IntervalVector box(sys.box);
+	// the random points must be finite
+	for (int j=0; j<sys.nb_var; j++) box[j]&=Interval(-1e3,1e3);
+
+	srand(1);
+	IntervalMatrix x(sys.nb_var,b);
+	for (int k=0; k<b; k++) {
+		Vector pt=box.random();
+		for (int j=0; j<sys.nb_var; j++) x[j][k]=pt[j];
+	}
+	IntervalVector y(b);
+
+	bool same=true;
+
+	Timer::start();
+	for (int i=0; i<n/b; i++)
+		for (int c=0; c<sys.nb_ctr; c++)
+			for (int k=0; k<b; k++)
+				y[k]=sys.ctrs[c].f.eval(x.col(k));
+	Timer::stop();
+	double t1=Timer::VIRTUAL_TIMELAPSE();
+
+	Timer::start();
+	for (int i=0; i<n/b; i++)
+		for (int c=0; c<sys.nb_ctr; c++)
+			sys.ctrs[c].f.eval_batch(x,y);
+	Timer::stop();
+	double t2=Timer::VIRTUAL_TIMELAPSE();
+
+	for (int c=0; c<sys.nb_ctr; c++) {
+		sys.ctrs[c].f.eval_batch(x,y);
+		for (int k=0; k<b; k++)
+			same &= (y[k]==sys.ctrs[c].f.eval(x.col(k)));
+	}
+
+	cout << "system:       " << argv[1] << " (" << sys.nb_ctr << " constraints, " << sys.nb_var << " variables)" << endl;
+	cout << "eval:         " << t1 << "s" << endl;
+	cout << "eval_batch:   " << t2 << "s (batches of " << b << " points)" << endl;
+	cout << "results:      " << (same? "ok" : "DIFFERENT") << endl;
+
+	return same ? 0 : 1;
+}
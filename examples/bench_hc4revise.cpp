@@ -0,0 +1,61 @@
+//============================================================================
+//                                  I B E X
+// File        : bench_hc4revise.cpp
+// Author      : IBEX contributors
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#include "ibex.h"
+
+#include <cstdlib>
+
+using namespace std;
+using namespace ibex;
+
+/*
+ * Benchmark of the forward-backward projection (HC4Revise)
+ * of the constraints of a system.
+ *
+ * Projects each constraint n times onto the initial box of the
+ * system (e.g., benchs/katsura-14.bch or benchs/yamamura8a.bch)
+ * and reports the number of projections per second.
+ */
+int main(int argc, char** argv) {
+
+	if (argc<2) {
+		cerr << "usage: bench_hc4revise filename [n]" << endl;
+		exit(1);
+	}
+
+	System sys(argv[1]);
+	int n = argc>2 ? atoi(argv[2]) : 100000;
+
+	HC4Revise hc4r(INTERVAL_MODE,true); // with the scalar tape
+	IntervalVector box(sys.box.size());
+
+	int nb_proj=0;  // number of projections
+	int nb_empty=0; // number of empty projections
+
+	Timer::start();
+	for (int k=0; k<n; k++) {
+		for (int i=0; i<sys.nb_ctr; i++) {
+			Domain y(Dim::scalar());
+			y.i()= sys.ctrs[i].op==EQ ? Interval::ZERO : Interval::NEG_REALS;
+			box=sys.box;
+			nb_proj++;
+			if (!hc4r.try_proj(sys.ctrs[i].f,y,box) && box.is_empty())
+				nb_empty++;
+		}
+	}
+	Timer::stop();
+	double t=Timer::VIRTUAL_TIMELAPSE();
+
+	cout << "system:       " << argv[1] << " (" << sys.nb_ctr << " constraints, " << sys.nb_var << " variables)" << endl;
+	cout << "projections:  " << nb_proj << " (" << nb_empty << " empty)" << endl;
+	cout << "time:         " << t << "s (" << (nb_proj/t) << " projections/s)" << endl;
+
+	return 0;
+}
@@ -0,0 +1,105 @@
+//============================================================================
+//                                  I B E X
+// File        : bench_interval.cpp
+// Author      : IBEX contributors
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#include "ibex.h"
+
+#include <cstdlib>
+
+using namespace std;
+using namespace ibex;
+
+/*
+ * Benchmark of the elementary operations of the underlying
+ * interval arithmetic (to compare the different arithmetics
+ * ibex can be configured with).
+ *
+ * Applies each operation n times to an array of intervals and
+ * reports the number of operations per second. The hull of the
+ * results is printed so that the loops are not optimized out.
+ */
+
+namespace {
+
+const int N=1000;
+
+typedef Interval (*binary)(const Interval&, const Interval&);
+typedef Interval (*unary)(const Interval&);
+
+Interval add(const Interval& x, const Interval& y) { return x+y; }
+Interval mul(const Interval& x, const Interval& y) { return x*y; }
+Interval div(const Interval& x, const Interval& y) { return x/y; }
+Interval _sqr(const Interval& x) { return sqr(x); }
+Interval _exp(const Interval& x) { return exp(x); }
+Interval _cos(const Interval& x) { return cos(x); }
+
+Interval x[N], y[N];
+
+void report(const char* name, int n, double t, const Interval& hull) {
+	cout << name << (n*(double) N)/t/1e6 << " Mops/s\t" << hull << endl;
+}
+
+void bench(const char* name, binary f, int n) {
+	Interval hull=Interval::EMPTY_SET;
+	Timer::start();
+	for (int k=0; k<n; k++)
+		for (int i=0; i<N; i++)
+			hull |= f(x[i],y[i]);
+	Timer::stop();
+	report(name,n,Timer::VIRTUAL_TIMELAPSE(),hull);
+}
+
+void bench(const char* name, unary f, int n) {
+	Interval hull=Interval::EMPTY_SET;
+	Timer::start();
+	for (int k=0; k<n; k++)
+		for (int i=0; i<N; i++)
+			hull |= f(x[i]);
+	Timer::stop();
+	report(name,n,Timer::VIRTUAL_TIMELAPSE(),hull);
+}
+
+}
+
+int main(int argc, char** argv) {
+
+	int n = argc>1 ? atoi(argv[1]) : 10000;
+
+	srand(1);
+	for (int i=0; i<N; i++) {
+		double a=-10+20.0*rand()/RAND_MAX;
+		double b=-10+20.0*rand()/RAND_MAX;
+		x[i]=Interval(a,a+1.0*rand()/RAND_MAX);
+		y[i]=Interval(b,b+1.0*rand()/RAND_MAX);
+	}
+
+	bench("add:  ",add,n);
+	bench("mul:  ",mul,n);
+	bench("div:  ",div,n);
+	bench("sqr:  ",_sqr,n);
+	bench("exp:  ",_exp,n/10);
+	bench("cos:  ",_cos,n/10);
+
+	// a forward evaluation (dominated by the arithmetic)
+	Variable u,v;
+	Function f(u,v,sqr(u)*v+u/(1+sqr(v))-exp(u*v));
+	IntervalVector box(2);
+	Interval hull=Interval::EMPTY_SET;
+	Timer::start();
+	for (int k=0; k<n/10; k++)
+		for (int i=0; i<N; i++) {
+			box[0]=x[i];
+			box[1]=y[i];
+			hull |= f.eval(box);
+		}
+	Timer::stop();
+	report("eval: ",n/10,Timer::VIRTUAL_TIMELAPSE(),hull);
+
+	return 0;
+}
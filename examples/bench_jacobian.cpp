@@ -0,0 +1,82 @@
+//============================================================================
+//                                  I B E X
+// File        : bench_jacobian.cpp
+// Author      : IBEX contributors
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#include "ibex.h"
+
+#include <cstdlib>
+
+using namespace std;
+using namespace ibex;
+
+/*
+ * Benchmark of the Jacobian matrix of a sparse function.
+ *
+ * The function is the Broyden tridiagonal function in dimension n:
+ *   f_i(x) = (3-2x_i)x_i - x_{i-1} - 2x_{i+1} + 1.
+ *
+ * Compares the gradient of each component (one backward sweep per
+ * row) with the sparse Jacobian (one forward sweep for all the rows,
+ * with 3 colors of variables).
+ */
+int main(int argc, char** argv) {
+
+	int n = argc>1 ? atoi(argv[1]) : 500;
+	int N = argc>2 ? atoi(argv[2]) : 100;
+
+	const ExprSymbol& x=ExprSymbol::new_("x",Dim::col_vec(n));
+	Array<const ExprNode> c(n);
+	for (int i=0; i<n; i++) {
+		const ExprNode* e=&((3-2*x[i])*x[i]+1);
+		if (i>0) e=&(*e-x[i-1]);
+		if (i<n-1) e=&(*e-2*x[i+1]);
+		c.set_ref(i,*e);
+	}
+	Function f(x,ExprVector::new_(c,false));
+
+	IntervalVector box(n,Interval(-1,1));
+	IntervalMatrix J1(n,n);
+	IntervalMatrix J2(n,n);
+	SparseJacobian J3(f);
+
+	f.jacobian(box,J2); // generate the components once for all
+	for (int i=0; i<n; i++) f[i].gradient(box,J1[i]);
+
+	Timer::start();
+	for (int k=0; k<N; k++)
+		for (int i=0; i<n; i++)
+			f[i].gradient(box,J1[i]);
+	Timer::stop();
+	double t1=Timer::VIRTUAL_TIMELAPSE();
+
+	Timer::start();
+	for (int k=0; k<N; k++)
+		f.jacobian(box,J2);
+	Timer::stop();
+	double t2=Timer::VIRTUAL_TIMELAPSE();
+
+	Timer::start();
+	for (int k=0; k<N; k++)
+		f.jacobian(box,J3);
+	Timer::stop();
+	double t3=Timer::VIRTUAL_TIMELAPSE();
+
+	bool same=true;
+	for (int i=0; i<n; i++)
+		for (int j=0; j<n; j++)
+			same &= (J1[i][j]==J2[i][j] && J1[i][j]==J3(i,j));
+
+	cout << "dimension:          " << n << " (" << J3.nnz() << " nonzeros, " << J3.nb_colors() << " colors)" << endl;
+	cout << "gradient by row:    " << t1 << "s" << endl;
+	cout << "jacobian (dense):   " << t2 << "s" << endl;
+	cout << "jacobian (sparse):  " << t3 << "s" << endl;
+	cout << "results:            " << (same? "ok" : "DIFFERENT") << endl;
+
+	return same ? 0 : 1;
+}
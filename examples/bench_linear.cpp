@@ -0,0 +1,77 @@
+//============================================================================
+//                                  I B E X
+// File        : bench_linear.cpp
+// Author      : IBEX contributors
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#include "ibex.h"
+
+#include <cstdlib>
+
+using namespace std;
+using namespace ibex;
+
+/*
+ * Benchmark of the interval linear algebra.
+ *
+ * Builds a random diagonally dominant interval matrix A of size n
+ * and reports the time of N matrix products, matrix-vector products,
+ * preconditionings and Gauss-Seidel contractions of A.x=b.
+ */
+int main(int argc, char** argv) {
+
+	int n = argc>1 ? atoi(argv[1]) : 50;
+	int N = argc>2 ? atoi(argv[2]) : 100;
+
+	srand(1);
+
+	IntervalMatrix A(n,n);
+	for (int i=0; i<n; i++)
+		for (int j=0; j<n; j++) {
+			double a = (i==j? 2*n : 0) + ((double) rand())/RAND_MAX;
+			A[i][j] = Interval(a).inflate(0.01);
+		}
+
+	IntervalVector b(n,Interval(-1,1));
+	IntervalVector x0(n,Interval(-10,10));
+
+	Timer::start();
+	for (int k=0; k<N; k++)
+		A*A;
+	Timer::stop();
+	double t1=Timer::VIRTUAL_TIMELAPSE();
+
+	Timer::start();
+	for (int k=0; k<100*N; k++)
+		A*x0;
+	Timer::stop();
+	double t2=Timer::VIRTUAL_TIMELAPSE();
+
+	Timer::start();
+	for (int k=0; k<N; k++) {
+		IntervalMatrix A2(A);
+		IntervalVector b2(b);
+		precond(A2,b2);
+	}
+	Timer::stop();
+	double t3=Timer::VIRTUAL_TIMELAPSE();
+
+	Timer::start();
+	for (int k=0; k<N; k++) {
+		IntervalVector x(x0);
+		gauss_seidel(A,b,x);
+	}
+	Timer::stop();
+	double t4=Timer::VIRTUAL_TIMELAPSE();
+
+	cout << "matrix product:   " << t1 << "s" << endl;
+	cout << "matrix-vector:    " << t2 << "s" << endl;
+	cout << "precond:          " << t3 << "s" << endl;
+	cout << "gauss-seidel:     " << t4 << "s" << endl;
+
+	return 0;
+}
@@ -0,0 +1,123 @@
+//============================================================================
+//                                  I B E X
+// File        : bench_polygon.cpp
+// Author      : IBEX contributors
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#include "ibex.h"
+
+#include <cstdlib>
+
+using namespace std;
+using namespace ibex;
+
+/*
+ * Scaling of the polygon separator with the number of segments.
+ *
+ * For polygons with an increasing number of segments (a circle of
+ * radius 10 with a noisy radius, like the contour of a map), reports
+ * the time of:
+ * - the construction of the separator (SepPolygon)
+ * - a call to SepPolygon::separate (on small random boxes)
+ * - a call to PdcInPolygon::test (on random points)
+ * - a call to the union of all the segment contractors (CtcUnion),
+ *   i.e., the boundary contractor without the hierarchy of segments
+ *   (only up to max_linear segments).
+ */
+
+namespace {
+
+double random(double a, double b) {
+	return a+(b-a)*rand()/RAND_MAX;
+}
+
+/* A polygon with n vertices (counter-clockwise) */
+void contour(int n, vector<double>& ax, vector<double>& ay, vector<double>& bx, vector<double>& by) {
+	vector<double> x(n), y(n);
+	for (int i=0; i<n; i++) {
+		double t=2*M_PI*i/n;
+		double r=10+random(-0.1,0.1);
+		x[i]=r*::cos(t);
+		y[i]=r*::sin(t);
+	}
+	for (int i=0; i<n; i++) {
+		ax.push_back(x[i]); ay.push_back(y[i]);
+		bx.push_back(x[(i+1)%n]); by.push_back(y[(i+1)%n]);
+	}
+}
+
+}
+
+int main(int argc, char** argv) {
+
+	int nb_calls   = argc>1 ? atoi(argv[1]) : 10000;
+	int max_edges  = argc>2 ? atoi(argv[2]) : 100000;
+	int max_linear = argc>3 ? atoi(argv[3]) : 10000;
+
+	srand(1);
+	vector<IntervalVector> boxes;
+	for (int k=0; k<nb_calls; k++) {
+		IntervalVector box(2);
+		double x=random(-12,12), y=random(-12,12);
+		box[0]=Interval(x,x+0.1);
+		box[1]=Interval(y,y+0.1);
+		boxes.push_back(box);
+	}
+
+	cout << "edges\tbuild(s)\tseparate(us)\ttest(us)\tunion(us)" << endl;
+
+	for (int n=100; n<=max_edges; n*=10) {
+		vector<double> ax,ay,bx,by;
+		contour(n,ax,ay,bx,by);
+
+		Clock clock(Clock::REAL);
+		clock.start();
+		SepPolygon sep(ax,ay,bx,by);
+		double t_build=clock.elapsed();
+
+		clock.reset();
+		clock.start();
+		for (int k=0; k<nb_calls; k++) {
+			IntervalVector x_in(boxes[k]), x_out(boxes[k]);
+			sep.separate(x_in,x_out);
+		}
+		double t_sep=clock.elapsed()/nb_calls*1e6;
+
+		PdcInPolygon pdc(ax,ay,bx,by);
+		clock.reset();
+		clock.start();
+		for (int k=0; k<nb_calls; k++)
+			pdc.test(boxes[k].mid());
+		double t_test=clock.elapsed()/nb_calls*1e6;
+
+		cout << n << "\t" << t_build << "\t" << t_sep << "\t" << t_test << "\t";
+
+		if (n<=max_linear) {
+			Array<Ctc> list(n);
+			for (int i=0; i<n; i++)
+				list.set_ref(i, *new CtcSegment(ax[i],ay[i],bx[i],by[i]));
+			CtcUnion u(list);
+
+			// the union is linear in n: fewer calls
+			int m=std::max(1,nb_calls*100/n);
+			clock.reset();
+			clock.start();
+			for (int k=0; k<m; k++) {
+				IntervalVector box(boxes[k%nb_calls]);
+				try { u.contract(box); } catch(EmptyBoxException&) { }
+			}
+			cout << clock.elapsed()/m*1e6;
+
+			for (int i=0; i<n; i++)
+				delete &list[i];
+		} else
+			cout << "-";
+		cout << endl;
+	}
+
+	return 0;
+}
@@ -0,0 +1,79 @@
+//============================================================================
+//                                  I B E X
+// File        : bench_polytopehull.cpp
+// Author      : IBEX contributors
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#include "ibex.h"
+
+#include <cstdlib>
+
+using namespace std;
+using namespace ibex;
+
+/*
+ * Benchmark of the polytope hull contractor.
+ *
+ * The contractor (with a X-Taylor relaxation) is called on a sequence of
+ * boxes obtained by successive bisections of the initial box of a system,
+ * as in a branch & bound: two consecutive linear programs are close and
+ * the linear solver can start from the previous basis.
+ *
+ * With nb threads>1, the LPs of each contraction are solved in
+ * parallel (see CtcPolytopeHull::set_nb_threads) and the time reported
+ * is the real time.
+ */
+int main(int argc, char** argv) {
+
+	if (argc<2) {
+		cerr << "usage: bench_polytopehull filename [nb boxes] [nb threads]" << endl;
+		exit(1);
+	}
+
+	System sys(argv[1]);
+	NormalizedSystem nsys(sys);
+	int N = argc>2 ? atoi(argv[2]) : 2000;
+	int nb_threads = argc>3 ? atoi(argv[3]) : 1;
+
+	vector<LinearRelaxXTaylor::corner_point> cpoints;
+	cpoints.push_back(LinearRelaxXTaylor::INF_X);
+	cpoints.push_back(LinearRelaxXTaylor::SUP_X);
+	LinearRelaxXTaylor lr(nsys,cpoints);
+	CtcPolytopeHull ctc(lr,CtcPolytopeHull::ALL_BOX);
+	ctc.set_nb_threads(nb_threads);
+
+	LargestFirst bsc;
+	IntervalVector box=sys.box;
+	double volume=0;
+	srand(1);
+
+	Clock clock(Clock::REAL);
+	clock.start();
+	for (int k=0; k<N; k++) {
+		IntervalVector box2=box;
+		try {
+			ctc.contract(box2);
+		} catch(EmptyBoxException&) {
+			box2.set_empty();
+		}
+		if (box2.is_empty() || box2.max_diam()<1e-6) {
+			// restart from the initial box
+			box=sys.box;
+			continue;
+		}
+		volume+=box2.volume();
+		pair<IntervalVector,IntervalVector> p=bsc.bisect(box2);
+		box = rand()%2? p.first : p.second;
+	}
+	clock.stop();
+
+	cout << "contractions: " << N << endl;
+	cout << "time:         " << clock.elapsed() << "s" << endl;
+	cout << "volume sum:   " << volume << endl;
+
+	return 0;
+}
@@ -0,0 +1,58 @@
+//============================================================================
+//                                  I B E X
+// File        : bench_quantif.cpp
+// Author      : IBEX contributors
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#include "ibex.h"
+
+#include <cstdlib>
+
+using namespace std;
+using namespace ibex;
+
+/*
+ * Benchmark of the contractors for quantified constraints.
+ *
+ * Pave the projection of 1.5x^2+1.5y^2-xy-0.2<=0 on x with a
+ * "exists y" contractor and a "for all y" contractor in a
+ * branch-and-prune (the parameter box is bisected up to "prec")
+ * and reports the time and the number of solutions.
+ */
+int main(int argc, char** argv) {
+
+	double prec = argc>1 ? atof(argv[1]) : 1e-04;
+	double eps  = argc>2 ? atof(argv[2]) : 1e-03;
+
+	Variable x,y;
+	Function f(x,y,1.5*sqr(x)+1.5*sqr(y)-x*y-0.2);
+	NumConstraint c(f,LEQ);
+
+	CtcExist exist_y(c,y,IntervalVector(1,Interval(-10,10)),prec);
+	CtcForAll forall_y(c,y,IntervalVector(1,Interval(-0.01,0.01)),prec);
+
+	IntervalVector box(1,Interval(-10,10));
+	RoundRobin rr(eps);
+	CellStack stack;
+
+	Solver s1(exist_y,rr,stack);
+	Timer::start();
+	vector<IntervalVector> sols1=s1.solve(box);
+	Timer::stop();
+	double t1=Timer::VIRTUAL_TIMELAPSE();
+
+	Solver s2(forall_y,rr,stack);
+	Timer::start();
+	vector<IntervalVector> sols2=s2.solve(box);
+	Timer::stop();
+	double t2=Timer::VIRTUAL_TIMELAPSE();
+
+	cout << "exists:           " << t1 << "s (" << sols1.size() << " solutions)" << endl;
+	cout << "for all:          " << t2 << "s (" << sols2.size() << " solutions)" << endl;
+
+	return 0;
+}
@@ -0,0 +1,118 @@
+//============================================================================
+//                                  I B E X
+// File        : bench_setindex.cpp
+// Author      : IBEX contributors
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#include "ibex.h"
+
+#include <cstdlib>
+
+using namespace std;
+using namespace ibex;
+
+/*
+ * Benchmark of the point-location queries on a set interval.
+ *
+ * Paves the ring 1<=x^2+y^2<=4 and queries the membership and the
+ * distance to the set of random points:
+ * - one point at a time (with the set and with the index)
+ * - by batches (SetIndex), with one thread and with several threads.
+ * Reports the number of queries per second.
+ */
+
+namespace {
+
+void report(const char* name, int n, double t) {
+	cout << name << n/t/1e6 << " Mq/s" << endl;
+}
+
+}
+
+int main(int argc, char** argv) {
+
+	double eps      = argc>1 ? atof(argv[1]) : 1e-03;
+	int n           = argc>2 ? atoi(argv[2]) : 1000000;
+	int nb_threads  = argc>3 ? atoi(argv[3]) : Thread::hardware_concurrency();
+
+	Variable x,y;
+	Function f(x,y,sqr(x)+sqr(y));
+	SepFwdBwd sep(f,Interval(1,4));
+
+	IntervalVector box(2,Interval(-3,3));
+	SetInterval set(box,eps);
+	set.contract(sep);
+
+	SetIndex index(set);
+	cout << "nodes: " << index.nb_nodes() << endl;
+
+	srand(1);
+	Matrix pts(n,2);
+	for (int i=0; i<n; i++)
+		for (int j=0; j<2; j++)
+			pts[i][j]=-3+6.0*rand()/RAND_MAX;
+
+	BoolInterval* res=new BoolInterval[n];
+	int nb_in=0;
+
+	// ------------------ membership ------------------
+	Clock clock(Clock::REAL);
+	clock.start();
+	for (int i=0; i<n; i++)
+		res[i]=index.contains(pts[i]);
+	report("contains (one by one):    ",n,clock.elapsed());
+
+	clock.reset();
+	clock.start();
+	index.contains(pts,res);
+	report("contains (batch):         ",n,clock.elapsed());
+
+	clock.reset();
+	clock.start();
+	index.contains(pts,res,nb_threads);
+	report("contains (batch, threads):",n,clock.elapsed());
+
+	for (int i=0; i<n; i++)
+		if (res[i]==YES) nb_in++;
+	cout << "points inside: " << nb_in << endl;
+
+	// ------------------ distance --------------------
+	int m=n/100;
+	double s=0;
+	clock.reset();
+	clock.start();
+	for (int i=0; i<m; i++)
+		s+=set.dist(pts[i],true);
+	report("dist (set):               ",m,clock.elapsed());
+
+	clock.reset();
+	clock.start();
+	for (int i=0; i<m; i++)
+		s+=index.dist(pts[i],true);
+	report("dist (index):             ",m,clock.elapsed());
+
+	Matrix pts2(m,2);
+	for (int i=0; i<m; i++) pts2[i]=pts[i];
+
+	clock.reset();
+	clock.start();
+	Vector d=index.dist(pts2,true);
+	report("dist (batch):             ",m,clock.elapsed());
+
+	clock.reset();
+	clock.start();
+	d=index.dist(pts2,true,nb_threads);
+	report("dist (batch, threads):    ",m,clock.elapsed());
+
+	double s2=0;
+	for (int i=0; i<m; i++) s2+=d[i];
+	cout << "sum of distances: " << s/2 << " " << s2 << endl;
+
+	delete[] res;
+
+	return 0;
+}
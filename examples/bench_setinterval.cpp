@@ -0,0 +1,103 @@
+//============================================================================
+//                                  I B E X
+// File        : bench_setinterval.cpp
+// Author      : IBEX contributors
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#include "ibex.h"
+
+#include <cstdlib>
+#include <cstdio>
+
+using namespace std;
+using namespace ibex;
+
+/*
+ * Benchmark of the construction of a set interval.
+ *
+ * Paves the ring 1<=x^2+y^2<=4 with the sequential
+ * construction (SetInterval::sync(Sep&)) and with the
+ * multi-threaded one (SetInterval::sync(const Array<Sep>&,int))
+ * and reports the (real) time of both.
+ *
+ * Then contracts the box with the same separator, saves the
+ * resulting set, opens it again (the file is mapped, see SetFlat)
+ * and reports the time of a distance query on both sets.
+ */
+int main(int argc, char** argv) {
+
+	double eps      = argc>1 ? atof(argv[1]) : 1e-03;
+	int nb_threads  = argc>2 ? atoi(argv[2]) : Thread::hardware_concurrency();
+	int fork_depth  = argc>3 ? atoi(argv[3]) : 6;
+
+	// one separator per thread (they must not share any function)
+	vector<Function*> f;
+	Array<Sep> sep(nb_threads);
+	for (int i=0; i<nb_threads; i++) {
+		Variable x,y;
+		f.push_back(new Function(x,y,sqr(x)+sqr(y)));
+		sep.set_ref(i,*new SepFwdBwd(*f.back(),Interval(1,4)));
+	}
+
+	IntervalVector box(2,Interval(-3,3));
+
+	Clock clock1(Clock::REAL);
+	SetInterval set1(box,eps,false);
+	clock1.start();
+	set1.sync(sep[0]);
+	double t1=clock1.elapsed();
+
+	Clock clock2(Clock::REAL);
+	SetInterval set2(box,eps,false);
+	clock2.start();
+	set2.sync(sep,fork_depth);
+	double t2=clock2.elapsed();
+
+	cout << "sequential:       " << t1 << "s" << endl;
+	cout << nb_threads << " thread(s):      " << t2 << "s" << endl;
+
+	SetInterval set0(box,eps);
+	set0.contract(sep[0]);
+
+	const char* filename="bench_setinterval.set";
+	Clock clock3(Clock::REAL);
+	clock3.start();
+	set0.save(filename);
+	double t3=clock3.elapsed();
+
+	Clock clock4(Clock::REAL);
+	clock4.start();
+	SetInterval set3(filename);
+	double t4=clock4.elapsed();
+
+	Vector pt(2);
+	pt[0]=0.1; pt[1]=0.2;
+
+	Clock clock5(Clock::REAL);
+	clock5.start();
+	double d1=set0.dist(pt,true);
+	double t5=clock5.elapsed();
+
+	Clock clock6(Clock::REAL);
+	clock6.start();
+	double d3=set3.dist(pt,true);
+	double t6=clock6.elapsed();
+
+	cout << "save:             " << t3 << "s" << endl;
+	cout << "load:             " << t4 << "s" << endl;
+	cout << "dist (in memory): " << t5 << "s (" << d1 << ")" << endl;
+	cout << "dist (mapped):    " << t6 << "s (" << d3 << ")" << endl;
+
+	remove(filename);
+
+	for (int i=0; i<nb_threads; i++) {
+		delete &sep[i];
+		delete f[i];
+	}
+
+	return 0;
+}
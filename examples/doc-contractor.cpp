@@ -85,9 +85,10 @@ public:
 
 	Count(const NumConstraint& ctr) : CtcFwdBwd(ctr) { }
 
-	void contract(IntervalVector& box) {
-		CtcFwdBwd::contract(box);
+	bool try_contract(IntervalVector& box) {
+		if (!CtcFwdBwd::try_contract(box)) return false;
 		count++;
+		return true;
 	}
 };
 
@@ -113,9 +114,10 @@ public:
 		}
 	}
 
-	void contract(IntervalVector& box) {
-		CtcFwdBwd::contract(box);
+	bool try_contract(IntervalVector& box) {
+		if (!CtcFwdBwd::try_contract(box)) return false;
 		count++;
+		return true;
 	}
 };
 
@@ -26,7 +26,7 @@ IntervalVector& IntervalVector::operator=(const Affine2Vector& x) {
 }
 
 
-IntervalVector::IntervalVector(const Affine2Vector& x) : n(x.size()), vec(new Interval[x.size()]) {
+IntervalVector::IntervalVector(const Affine2Vector& x) : n(x.size()), own(true), vec(new Interval[x.size()]) {
 	for (int i=0; i<n; i++) vec[i]=x[i].itv();
 }
 
@@ -0,0 +1,685 @@
+/* ============================================================================
+ * I B E X - Implementation of the Affine2Main<AF_fAF2_sparse> class
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : IBEX contributors
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+#include "ibex_Affine2_fAF2_sparse.h"
+#include "ibex_Affine2.h"
+#include "ibex_MemoryPool.h"
+
+#include <algorithm>
+
+namespace ibex {
+
+namespace {
+
+/* Same constants as Affine2Main::AF_EM() and AF_EC() */
+const double EM = __builtin_powi(2.0, -51);
+const double EC = __builtin_powi(2.0, -55);
+
+/*
+ * Account for an operation that gave v with the rounding error eee:
+ * ttt bounds the sum of the rounding errors and sss the sum of
+ * the negligible values, that are set to 0.
+ */
+inline void round_off(double eee, double& v, double& ttt, double& sss) {
+	ttt = (1+2*EM)*(ttt+fabs(eee));
+	if (fabs(v)<EC) {
+		sss = (1+2*EM)*(sss+fabs(v));
+		v = 0.0;
+	}
+}
+
+}
+
+void AF_fAF2_sparse::reserve(int cap) {
+	_nz=0;
+	if (cap<=_cap) return;
+	release();
+	_val=(double*) MemoryPool::allocate(cap*(sizeof(double)+sizeof(int)));
+	_ind=(int*) (_val+cap);
+	_cap=cap;
+}
+
+void AF_fAF2_sparse::release() {
+	if (_cap>0) MemoryPool::deallocate(_val,_cap*(sizeof(double)+sizeof(int)));
+	_val=NULL;
+	_ind=NULL;
+	_nz=0;
+	_cap=0;
+}
+
+void AF_fAF2_sparse::copy(const AF_fAF2_sparse& x, double sign) {
+	_center=sign*x._center;
+	if (this==&x) {
+		for (int k=0; k<_nz; k++) _val[k]=sign*_val[k];
+		return;
+	}
+	reserve(x._nz);
+	for (int k=0; k<x._nz; k++) push(x._ind[k],sign*x._val[k]);
+}
+
+void AF_fAF2_sparse::swap_terms(AF_fAF2_sparse& x) {
+	std::swap(_val,x._val);
+	std::swap(_ind,x._ind);
+	std::swap(_nz,x._nz);
+	std::swap(_cap,x._cap);
+}
+
+double AF_fAF2_sparse::coef(int i) const {
+	int* p=std::lower_bound(_ind,_ind+_nz,i);
+	return (p!=_ind+_nz && *p==i)? _val[p-_ind] : 0.0;
+}
+
+
+
+template<>
+Affine2Main<AF_fAF2_sparse>& Affine2Main<AF_fAF2_sparse>::operator=(const Interval& x) {
+
+	_elt.release();
+
+	if (x.is_empty()) {
+		_n = -1;
+		_elt._err = 0.0;
+	} else if (x.ub()>= POS_INFINITY && x.lb()<= NEG_INFINITY ) {
+		_n = -2;
+		_elt._err = 0.0;
+	} else if (x.ub()>= POS_INFINITY ) {
+		_n = -3;
+		_elt._err = x.lb();
+	} else if (x.lb()<= NEG_INFINITY ) {
+		_n = -4;
+		_elt._err = x.ub();
+	} else  {
+		_n = 0;
+		_elt._center = x.mid();
+		_elt._err	= x.rad();
+	}
+	return *this;
+}
+
+
+
+template<>
+Affine2Main<AF_fAF2_sparse>::Affine2Main() :
+		 _n		(-2		),
+		 _elt	(0.0	,POS_INFINITY)	{
+ }
+
+template<>
+Affine2Main<AF_fAF2_sparse>::Affine2Main(int n, int m, const Interval& itv) :
+			_n 		(n),
+			_elt	(0.0,0.0)
+{
+	assert((n>=0) && (m>=0) && (m<=n));
+	if (!(itv.is_unbounded()||itv.is_empty())) {
+		_elt._center = itv.mid();
+
+		if (m == 0) {
+			_elt._err = itv.rad();
+		} else if (itv.rad()!=0) {
+			_elt.reserve(1);
+			_elt.push(m,itv.rad());
+		}
+	} else {
+		*this = itv;
+	}
+}
+
+
+template<>
+Affine2Main<AF_fAF2_sparse>::Affine2Main(const double d) :
+			_n 		(0),
+			_elt	(0.0,0.0) {
+	if (fabs(d)<POS_INFINITY) {
+		_elt._center = d;
+	} else {
+		_n=-1;
+		_elt._err = d;
+	}
+}
+
+
+template<>
+Affine2Main<AF_fAF2_sparse>::Affine2Main(const Interval & itv):
+			_n 		(0),
+			_elt	(0.0,0.0) {
+	*this = itv;
+}
+
+
+template<>
+Affine2Main<AF_fAF2_sparse>::Affine2Main(const Affine2Main<AF_fAF2_sparse>& x) :
+		_n		(x._n),
+		_elt	(0.0	,x._elt._err ) {
+	if (is_actif()) {
+		_elt.copy(x._elt);
+	}
+}
+
+
+
+template<>
+double Affine2Main<AF_fAF2_sparse>::val(int i) const{
+	assert((0<=i) && (i<=_n));
+	return i==0? _elt._center : _elt.coef(i);
+}
+
+template<>
+double Affine2Main<AF_fAF2_sparse>::err() const{
+	return _elt._err;
+}
+
+
+
+template<>
+const Interval Affine2Main<AF_fAF2_sparse>::itv() const {
+
+	if (is_actif()) {
+		Interval res(_elt._center);
+		Interval pmOne(-1.0, 1.0);
+		for (int k = 0; k < _elt._nz; k++){
+			res += (_elt._val[k] * pmOne);
+		}
+		res += _elt._err * pmOne;
+		return res;
+	} else if (_n==-1) {
+		return Interval::EMPTY_SET;
+	} else if (_n==-2) {
+		return Interval::ALL_REALS;
+	} else if (_n==-3) {
+		return Interval(_elt._err,POS_INFINITY);
+	} else  {  //if (_n==-4)
+		return Interval(NEG_INFINITY,_elt._err);
+	}
+
+}
+
+
+template<>
+double Affine2Main<AF_fAF2_sparse>::mid() const{
+	return (is_actif())? _elt._center : itv().mid();
+}
+
+
+
+template<>
+Affine2Main<AF_fAF2_sparse>& Affine2Main<AF_fAF2_sparse>::operator=(const Affine2Main<AF_fAF2_sparse>& x) {
+	if (this != &x) {
+		_n = x._n;
+		_elt._err = x._elt._err;
+		if (x.is_actif()) {
+			_elt.copy(x._elt);
+		} else {
+			_elt.release();
+		}
+	}
+	return *this;
+
+}
+
+template<>
+Affine2Main<AF_fAF2_sparse>& Affine2Main<AF_fAF2_sparse>::operator=(double d) {
+
+	_elt.release();
+
+	if (fabs(d)<POS_INFINITY) {
+		_n = 0;
+		_elt._err = 0.0;
+		_elt._center = d;
+	} else {
+		if (d>0) {
+			_n = -3;
+		} else {
+			_n = -4;
+		}
+		_elt._err = d;
+	}
+	return *this;
+}
+
+
+
+/** \brief Return (-x) */
+template<>
+Affine2Main<AF_fAF2_sparse> Affine2Main<AF_fAF2_sparse>::operator-() const {
+	Affine2Main<AF_fAF2_sparse> res;
+	res._n = _n;
+	res._elt._err = _elt._err;
+	if (is_actif()) {
+		res._elt.copy(_elt,-1.0);
+	}
+	return res;
+}
+
+
+
+template<>
+Affine2Main<AF_fAF2_sparse>& Affine2Main<AF_fAF2_sparse>::saxpy(double alpha, const Affine2Main<AF_fAF2_sparse>& y, double beta, double ddelta, bool B1, bool B2, bool B3, bool B4) {
+	double temp, ttt, sss, eee;
+	int k;
+
+	if (is_actif()) {
+		if (B1) {  // multiply by a scalar alpha
+			if (alpha==0.0) {
+				_elt._center = 0.0;
+				_elt._nz = 0;
+				_elt._err = 0;
+			}
+			else if ((fabs(alpha)) < POS_INFINITY) {
+				ttt= 0.0;
+				sss= 0.0;
+				eee = _elt.twoProd(_elt._center, alpha, &temp);
+				round_off(eee,temp,ttt,sss);
+				_elt._center = temp;
+
+				int nz=0;
+				for (k=0; k<_elt._nz; k++) {
+					eee = _elt.twoProd(_elt._val[k], alpha, &temp);
+					round_off(eee,temp,ttt,sss);
+					if (temp!=0.0) {
+						_elt._ind[nz] = _elt._ind[k];
+						_elt._val[nz++] = temp;
+					}
+				}
+				_elt._nz = nz;
+
+				_elt._err = (1+2*AF_EM())*(
+						((1+2*AF_EM())*fabs(alpha)*_elt._err) +
+						((AF_EE()*ttt) +
+						(AF_EE()*sss))
+						);
+
+			}
+			else {
+				*this = itv()*alpha;
+			}
+		}
+
+		if (B2) {  // add a affine2 form y
+
+			if (y.is_actif()) {
+				if (_n==y.size()) {
+
+					ttt=0.0;
+					sss=0.0;
+					eee = _elt.twoSum(_elt._center, y._elt._center, &temp);
+					round_off(eee,temp,ttt,sss);
+					_elt._center = temp;
+
+					// merge the two lists of terms
+					AF_fAF2_sparse res(0.0,0.0);
+					res.reserve(_elt._nz+y._elt._nz);
+					int i=0, j=0;
+					while (i<_elt._nz || j<y._elt._nz) {
+						int ind;
+						if (j==y._elt._nz || (i<_elt._nz && _elt._ind[i]<y._elt._ind[j])) {
+							ind = _elt._ind[i];
+							temp = _elt._val[i++];
+							round_off(0.0,temp,ttt,sss);
+						} else if (i==_elt._nz || y._elt._ind[j]<_elt._ind[i]) {
+							ind = y._elt._ind[j];
+							temp = y._elt._val[j++];
+							round_off(0.0,temp,ttt,sss);
+						} else {
+							ind = _elt._ind[i];
+							eee = _elt.twoSum(_elt._val[i++], y._elt._val[j++], &temp);
+							round_off(eee,temp,ttt,sss);
+						}
+						if (temp!=0.0) res.push(ind,temp);
+					}
+					_elt.swap_terms(res);
+
+					_elt._err = (1+2*AF_EM())*(
+							(_elt._err+y._elt._err) +
+							((AF_EE()*(ttt)) +
+							(AF_EE()*sss))
+							);
+
+				} else  {
+					if (_n>y.size()) {
+						*this += y.itv();
+					} else {
+						Interval tmp1 = itv();
+						*this = y;
+						*this += tmp1;
+					}
+				}
+			}
+			else { // y is not a valid affine2 form. So we add y.itv() such as an interval
+				*this = itv()+y.itv();
+			}
+		}
+		if (B3) {  //add a constant beta
+			if ((fabs(beta))<POS_INFINITY) {
+				ttt=0.0;
+				sss=0.0;
+				eee = _elt.twoSum(_elt._center,beta,&temp);
+				round_off(eee,temp,ttt,sss);
+				_elt._center = temp;
+
+				_elt._err = (1+2*AF_EM())*(
+						_elt._err +
+						(AF_EE()*(ttt)+
+						AF_EE()*sss)
+						);
+
+			}
+			else {
+				*this = itv()+beta;
+			}
+		}
+
+		if (B4) {  // add an error  ddelta
+
+			if ((fabs(ddelta))<POS_INFINITY) {
+				ttt=0.0;
+				sss=0.0;
+				eee = _elt.twoSum(_elt._err,fabs(ddelta), &temp);
+				ttt = (1+2*AF_EM())*(fabs(eee));
+				if (fabs(temp)<AF_EC()) {
+					sss = (1+2*AF_EM())*(fabs(temp));
+					temp =0;
+				}
+				_elt._err = (1+2*AF_EM())*(
+						temp +
+						(AF_EE()*(ttt) +
+						AF_EE()*sss)
+						);
+
+			}
+			else {
+				*this = itv()+Interval(-1,1)*ddelta;
+			}
+		}
+
+		if (is_actif()) {
+			bool b = (_elt._err<POS_INFINITY) && (fabs(_elt._center)<POS_INFINITY);
+			for (k=0;k<_elt._nz;k++) {
+				b &= (fabs(_elt._val[k])<POS_INFINITY);
+			}
+			if (!b) {
+				*this = Interval::ALL_REALS;
+			}
+		}
+
+	} else {
+		if (B1) {  //scalar alpha
+			*this = itv()* alpha;
+		}
+		if (B2) {  // add y
+			*this = itv()+ y.itv();
+		}
+		if (B3) {  //constant beta
+			*this = itv()+ beta;
+		}
+		if (B4) {  // error  delta
+			*this = itv()+Interval(-1,1)*ddelta;
+		}
+	}
+	return *this;
+
+}
+
+
+template<>
+Affine2Main<AF_fAF2_sparse>& Affine2Main<AF_fAF2_sparse>::operator*=(const Interval& y) {
+	if (	(!is_actif())||
+			y.is_empty()||
+			y.is_unbounded() ) {
+		*this = itv()*y;
+
+	} else {
+		double  ttt, sss,  yVal0, eee, temp;
+		int k;
+
+		ttt=0.0; sss=0.0;
+		yVal0 = y.mid();
+		// RES = X%(0) * res
+		eee = _elt.twoProd(_elt._center, yVal0, &temp);
+		round_off(eee,temp,ttt,sss);
+		_elt._center = temp;
+
+		int nz=0;
+		for (k=0; k<_elt._nz; k++) {
+			eee = _elt.twoProd(_elt._val[k], yVal0, &temp);
+			round_off(eee,temp,ttt,sss);
+			if (temp!=0.0) {
+				_elt._ind[nz] = _elt._ind[k];
+				_elt._val[nz++] = temp;
+			}
+		}
+		_elt._nz = nz;
+
+		_elt._err = (1+2*AF_EM())*(
+				(1+2*AF_EM())*(abs(y).ub())*_elt._err +
+				((AF_EE()*ttt) +
+				(AF_EE()*sss))
+				);
+
+		{
+			bool b = (_elt._err<POS_INFINITY) && (fabs(_elt._center)<POS_INFINITY);
+			for (k=0;k<_elt._nz;k++) {
+				b &= (fabs(_elt._val[k])<POS_INFINITY);
+			}
+			if (!b) {
+				*this = Interval::ALL_REALS;
+			}
+		}
+
+	}
+	return *this;
+}
+
+
+
+template<>
+Affine2Main<AF_fAF2_sparse>& Affine2Main<AF_fAF2_sparse>::operator*=(const Affine2Main<AF_fAF2_sparse>& y) {
+
+	if (is_actif() && (y.is_actif())) {
+
+		if (_n==y.size()) {
+			double Sx, Sy, Sxy, Sz, ttt, sss, ppp, tmp, xVal0, yVal0, eee, a, b;
+			int k;
+
+			Sx=0.0; Sy=0.0; Sxy=0.0; Sz=0.0; ttt=0.0; sss=0.0;
+			xVal0 = _elt._center;
+			yVal0 = y._elt._center;
+
+			// RES = X%T(0) * Y%(0)
+			eee = _elt.twoProd(xVal0, yVal0, &ppp);
+			round_off(eee,ppp,ttt,sss);
+			_elt._center = ppp;
+
+			// RES = ( Y%(0) * X ) + ( X%T(0) * Y ), merging the two lists of terms
+			AF_fAF2_sparse res(0.0,0.0);
+			res.reserve(_elt._nz+y._elt._nz);
+			int i=0, j=0;
+			while (i<_elt._nz || j<y._elt._nz) {
+				int ind;
+				bool bx = (j==y._elt._nz || (i<_elt._nz && _elt._ind[i]<=y._elt._ind[j]));
+				bool by = (i==_elt._nz || (j<y._elt._nz && y._elt._ind[j]<=_elt._ind[i]));
+				double xi = bx? _elt._val[i] : 0.0;
+				double yi = by? y._elt._val[j] : 0.0;
+				ind = bx? _elt._ind[i++] : y._elt._ind[j++];
+				if (bx && by) j++;
+
+				if (bx && by) {
+					eee = _elt.twoProd(xi, yi, &ppp);
+					ttt = (1+2*AF_EM())*(ttt+fabs(eee));
+
+					eee = _elt.twoSum(Sz,ppp, &tmp);
+					Sz = tmp;
+					round_off(eee,Sz,ttt,sss);
+
+					eee = _elt.twoSum(Sxy,fabs(ppp), &tmp);
+					Sxy = tmp;
+					round_off(eee,Sxy,ttt,sss);
+				}
+				a = 0.0;
+				if (bx) {
+					eee = _elt.twoSum(Sx,fabs(xi), &tmp);
+					Sx = tmp;
+					round_off(eee,Sx,ttt,sss);
+
+					eee = _elt.twoProd(xi, yVal0, &a);
+					round_off(eee,a,ttt,sss);
+				}
+				b = 0.0;
+				if (by) {
+					eee = _elt.twoSum(Sy,fabs(yi), &tmp);
+					Sy = tmp;
+					round_off(eee,Sy,ttt,sss);
+
+					eee = _elt.twoProd(xVal0, yi, &b);
+					round_off(eee,b,ttt,sss);
+				}
+				eee = _elt.twoSum(a, b, &tmp);
+				round_off(eee,tmp,ttt,sss);
+				if (tmp!=0.0) res.push(ind,tmp);
+			}
+
+			eee = _elt.twoProd(0.5,Sz, &ppp);
+			ttt = (1+2*AF_EM())*(ttt+fabs(eee));
+
+			eee = _elt.twoSum(_elt._center,ppp, &tmp);
+			round_off(eee,tmp,ttt,sss);
+			_elt._center = tmp;
+
+			eee = _elt.twoSum(_elt._err,Sx, &tmp);
+			ttt = (1+2*AF_EM())*(ttt+fabs(eee));
+
+			eee = _elt.twoSum(y._elt._err,Sy, &ppp);
+			ttt = (1+2*AF_EM())*(ttt+fabs(eee));
+
+			_elt._err = (1+ 2*AF_EM()) * (
+					((1+ 2*AF_EM()) *fabs(yVal0) * _elt._err)  +
+					((1+ 2*AF_EM()) *fabs(xVal0) * y._elt._err)  +
+					((1+ 2*AF_EM()) *(tmp * ppp)) +
+					((1- 2*AF_EM()) *(-0.5) *  Sxy)  +
+					(AF_EE() * (ttt))  +
+					(AF_EE() * sss)
+					);
+
+			// note: y is not read anymore (it may be *this)
+			_elt.swap_terms(res);
+
+			{
+				bool b = (_elt._err<POS_INFINITY) && (fabs(_elt._center)<POS_INFINITY);
+				for (k=0;k<_elt._nz;k++) {
+					b &= (fabs(_elt._val[k])<POS_INFINITY);
+				}
+				if (!b) {
+					*this = Interval::ALL_REALS;
+				}
+			}
+
+		} else {
+			if (_n>y.size()) {
+				*this *= y.itv();
+			} else {
+				Interval tmp1 = this->itv();
+				*this = y;
+				*this *= tmp1;
+			}
+		}
+
+
+	} else {
+		*this = itv()*y.itv();
+	}
+
+	return *this;
+}
+
+
+template<>
+Affine2Main<AF_fAF2_sparse>& Affine2Main<AF_fAF2_sparse>::sqr(const Interval itv) {
+
+	if (	(!is_actif())||
+			itv.is_empty()||
+			itv.is_unbounded()||
+			(itv.diam() < AF_EC())  ) {
+		*this = pow(itv,2);
+
+	} else  {
+
+		double Sx, Sx2, ttt, sss, ppp, x0, eee,tmp;
+		int k;
+		Sx = 0; Sx2 = 0; ttt = 0; sss = 0;
+
+		// compute the error
+		for (k = 0; k < _elt._nz; k++) {
+
+			eee = _elt.twoProd(_elt._val[k],_elt._val[k], &ppp);
+			ttt = (1+2*AF_EM())*(ttt+fabs(eee));
+
+			eee = _elt.twoSum(Sx2,ppp, &tmp);
+			Sx2 = tmp;
+			round_off(eee,Sx2,ttt,sss);
+
+			eee = _elt.twoSum(Sx,fabs(_elt._val[k]), &tmp);
+			Sx = tmp;
+			round_off(eee,Sx,ttt,sss);
+		}
+
+		x0 = _elt._center;
+
+		eee = _elt.twoProd(x0,x0, &ppp);
+		round_off(eee,ppp,ttt,sss);
+		_elt._center = ppp;
+
+		// compute 2*_elt._val[0]*(*this)
+		int nz=0;
+		for (k = 0; k < _elt._nz; k++) {
+			eee = _elt.twoProd((2*x0),_elt._val[k], &ppp);
+			round_off(eee,ppp,ttt,sss);
+			if (ppp!=0.0) {
+				_elt._ind[nz] = _elt._ind[k];
+				_elt._val[nz++] = ppp;
+			}
+		}
+		_elt._nz = nz;
+
+		eee = _elt.twoProd(0.5,Sx2, &ppp);
+		ttt = (1+2*AF_EM())*(ttt+fabs(eee));
+
+		eee = _elt.twoSum(_elt._center,ppp, &tmp);
+		round_off(eee,tmp,ttt,sss);
+		_elt._center = tmp;
+
+		eee = _elt.twoSum(_elt._err,Sx, &tmp);
+		ttt = (1+2*AF_EM())*(ttt+fabs(eee));
+
+		_elt._err = (1+ 2*AF_EM()) * (
+				((1+ 2*AF_EM()) *2*fabs(x0) * _elt._err)  +
+				((1+ 2*AF_EM()) *(tmp * tmp)) +
+				((1- 2*AF_EM()) *(-0.5) *  Sx2)  +
+				(AF_EE() * (ttt))  +
+				(AF_EE() * sss)
+				);
+
+		{
+			bool b = (_elt._err<POS_INFINITY) && (fabs(_elt._center)<POS_INFINITY);
+			for (k=0;k<_elt._nz;k++) {
+				b &= (fabs(_elt._val[k])<POS_INFINITY);
+			}
+			if (!b) {
+				*this = Interval::ALL_REALS;
+			}
+		}
+
+	}
+
+	return *this;
+}
+
+
+
+
+}// end namespace ibex
@@ -0,0 +1,174 @@
+/* ============================================================================
+ * I B E X - Definition of the Affine2 class based on fAF version 2, sparse forms
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : IBEX contributors
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef IBEX_AFFINE2_FAF2_SPARSE_H_
+#define IBEX_AFFINE2_FAF2_SPARSE_H_
+
+#include "ibex_Interval.h"
+
+
+namespace ibex {
+
+/**
+ * \brief Sparse version of fAF2.
+ *
+ * Same arithmetic as #AF_fAF2, but only the non-zero terms of the form are
+ * stored, as a list of (index, coefficient) sorted by index. The operations
+ * merge these lists, so that their cost depends on the number of noise
+ * symbols involved, not on the total number of variables.
+ * The lists are allocated in the shared memory pools (see #MemoryPool).
+ */
+class AF_fAF2_sparse {
+
+	friend class Affine2Main<AF_fAF2_sparse>;
+
+private:
+	/**
+	 * Code for the particular case:
+	 * if the affine form is actif, _n>1  and _n is the size of the affine form
+	 * if the set is degenerate, _n = 0 or itv().diam()< AF_EC()
+	 * if the set is empty, _n = -1
+	 * if the set is ]-oo,+oo[, _n = -2
+	 * if the set is [a, +oo[ , _n = -3 and _err= a
+	 * if the set is ]-oo, a] , _n = -4 and _err= a
+	 *
+	 */
+
+	double _center;	// center of the affine form (value of the 0th term)
+	double * _val; 	// coefficients of the non-zero terms
+	int * _ind;		// indices of the non-zero terms (in increasing order)
+	int _nz;		// number of non-zero terms
+	int _cap;		// capacity of _val and _ind
+	double _err; 	// error of the affine form, corresponded to the last term
+
+	/**
+	 * \brief Make room for \a cap terms.
+	 *
+	 * The current terms are lost.
+	 */
+	void reserve(int cap);
+
+	/**
+	 * \brief Remove all the terms and release the memory.
+	 */
+	void release();
+
+	/**
+	 * \brief Append the term (i,v).
+	 *
+	 * \pre There is room for it and i is greater than the last index.
+	 */
+	void push(int i, double v);
+
+	/**
+	 * \brief Copy the terms (and the center) of \a x, multiplied by \a sign.
+	 */
+	void copy(const AF_fAF2_sparse& x, double sign=1.0);
+
+	/**
+	 * \brief Exchange the terms with those of \a x.
+	 */
+	void swap_terms(AF_fAF2_sparse& x);
+
+	/**
+	 * \brief Coefficient of the ith noise symbol (0 if absent).
+	 */
+	double coef(int i) const;
+
+	/**
+	 * \brief return the exact rounding error of the addition of 2 floating-point numbers
+	 */
+	double twoSum(double a, double b, double *res);
+
+	/**
+	 * \brief return the exact rounding error of the multiplication of 2 floating-point numbers
+	 */
+	double twoProd(double a, double b, double *res);
+	void Split(double x, int sp, double *x_high, double *x_low);
+
+	AF_fAF2_sparse(const AF_fAF2_sparse&);            // forbidden
+	AF_fAF2_sparse& operator=(const AF_fAF2_sparse&); // forbidden
+
+public:
+	/** \brief Create an empty affine form. */
+	AF_fAF2_sparse(double center, double err);
+
+	/** \brief  Delete the affine form */
+	virtual ~AF_fAF2_sparse();
+
+};
+
+
+inline AF_fAF2_sparse::AF_fAF2_sparse(double center, double err) :
+	_center	(center),
+	_val	(NULL),
+	_ind	(NULL),
+	_nz		(0),
+	_cap	(0),
+	_err	(err) {
+
+}
+
+inline AF_fAF2_sparse::~AF_fAF2_sparse() {
+	release();
+}
+
+inline void AF_fAF2_sparse::push(int i, double v) {
+	_ind[_nz]=i;
+	_val[_nz++]=v;
+}
+
+
+/////////////////////
+// CODE extract from "Handbook of Floating-Point Arithmetic" p.132-139
+inline void AF_fAF2_sparse::Split(double x, int sp, double *x_high, double *x_low)
+{
+	unsigned long C = (1UL << sp) + 1;
+	double gamma = (C * x);
+	double delta = (x - gamma);
+	*x_high= (gamma + delta);
+	*x_low= (x - *x_high);
+}
+
+inline double AF_fAF2_sparse::twoProd(double x, double y, double *r_1)
+{
+	int SHIFT_POW = 27; //  53 / 2 for double precision.
+	double x_high, x_low;
+	double y_high, y_low;
+	double t_1;
+	double t_2;
+	double t_3;
+	Split(x, SHIFT_POW, &x_high, &x_low);
+	Split(y, SHIFT_POW, &y_high, &y_low);
+	*r_1 = (x * y);
+	t_1 = (-*r_1 + x_high * y_high);
+	t_2 =   (t_1 + x_high * y_low );
+	t_3 =	(t_2 + x_low  * y_high);
+	return  (t_3 + x_low  * y_low );
+}
+
+
+
+// CODE extract from "Handbook of Floating-Point Arithmetic" p.130
+inline double AF_fAF2_sparse::twoSum(double a, double b, double *res) {
+	*res = (a+b);
+	double a2 = (*res - b);
+	double b2 = (*res - a2);
+	double delta_a = (a - a2);
+	double delta_b = (b - b2);
+	return (delta_a + delta_b);
+}
+
+//////////////////////
+
+}
+
+#endif /* IBEX_AFFINE2_FAF2_SPARSE_H_ */
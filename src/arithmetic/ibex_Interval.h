@@ -62,6 +62,18 @@
 //	#define POS_INFINITY filib::primitive::compose(0,0x7FE,(1 << 21)-1,0xffffffff)
 	/** \brief IBEX_NAN: <double> representation of NaN */
 	#define IBEX_NAN filib::primitive::compose(0,0x7FF,1 << 19,0)
+#else
+#ifdef _IBEX_WITH_NATIVE_
+	#include "ibex_NativeInterval.h"
+	#include "interval/interval.hpp" // elementary functions
+	#include <limits>
+	/** \brief NEG_INFINITY: <double> representation of -oo */
+	#define NEG_INFINITY (-std::numeric_limits<double>::infinity())
+	/** \brief POS_INFINITY: <double> representation of +oo */
+	#define POS_INFINITY std::numeric_limits<double>::infinity()
+	/** \brief IBEX_NAN: <double> representation of NaN */
+	#define IBEX_NAN std::numeric_limits<double>::quiet_NaN()
+#endif
 #endif
 #endif
 #endif
@@ -126,7 +138,8 @@ double next_float(double x);
  * \brief Interval
  *
  * This class defines the interval interface of IBEX and encapsulates an interval "itv" whose
- * type depends on the chosen implementation (currently: Gaol, Bias of filib).
+ * type depends on the chosen implementation (currently: Gaol, Bias, filib or the native
+ * arithmetic of ibex).
  *
  * Note that some functions of the Gaol interval interface do not appear here (like "possibly relations")
  * because there are not used by ibex; while other have been introduced (like "ratio_delta"). Some
@@ -137,6 +150,9 @@ double next_float(double x);
  * rounding_strategy = native_switched
  * interval_mode = i_mode_extended_flag
  *
+ * The native arithmetic (see #ibex::NativeInterval) is entirely inlined, except the
+ * elementary functions which are delegated to filib.
+ * It does not assume any rounding mode and leaves the rounding mode unchanged.
  */
 class Interval {
   public:
@@ -528,6 +544,15 @@ class Interval {
 
     FI_INTERVAL itv;
 
+#else
+#ifdef _IBEX_WITH_NATIVE_
+	/* \brief Wrap the native interval [x]. */
+    Interval(const NativeInterval& x);
+    /* \brief Assign this to the native interval [x]. */
+    Interval& operator=(const NativeInterval& x);
+
+    NativeInterval itv;
+#endif
 #endif
 #endif
 #endif
@@ -847,6 +872,10 @@ bool bwd_integer(Interval& x);
 #else
 #ifdef _IBEX_WITH_FILIB_
 #include "ibex_filib_Interval.h_"
+#else
+#ifdef _IBEX_WITH_NATIVE_
+#include "ibex_native_Interval.h_"
+#endif
 #endif
 #endif
 #endif
@@ -955,6 +984,10 @@ inline double distance(const Interval &x1, const Interval &x2) {
 #else
 #ifdef _IBEX_WITH_FILIB_
     	return x1.itv.dist(x2.itv);
+#else
+#ifdef _IBEX_WITH_NATIVE_
+    	return hausdorff(x1,x2);
+#endif
 #endif
 #endif
 #endif
@@ -0,0 +1,332 @@
+/* ============================================================================
+ * I B E X - Kernels of interval linear algebra
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : IBEX contributors
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "ibex_IntervalKernels.h"
+
+#if defined(__SSE2__) && (defined(_IBEX_WITH_FILIB_) || defined(_IBEX_WITH_NATIVE_))
+#define IBEX_SSE2_KERNELS
+#include <emmintrin.h>
+#endif
+
+namespace ibex {
+
+#ifdef IBEX_SSE2_KERNELS
+
+namespace {
+
+/*
+ * An interval [a,b] is stored as two contiguous doubles a,b
+ * (or -a,b with the native arithmetic).
+ * In a register, it is represented by the pair (-a,b) (with -a in the
+ * low part) so that both bounds are rounded upward.
+ */
+
+/* The layout of Interval is checked at compile time */
+typedef char interval_is_two_doubles[sizeof(Interval)==2*sizeof(double)? 1 : -1];
+
+/* Set the rounding mode of SSE to "upward" in the current scope */
+class RoundUp {
+public:
+	RoundUp() : csr(_mm_getcsr()) {
+		_mm_setcsr((csr & ~_MM_ROUND_MASK) | _MM_ROUND_UP);
+	}
+	~RoundUp() {
+		_mm_setcsr(csr);
+	}
+private:
+	const unsigned int csr;
+};
+
+/* Change the sign of the low part */
+inline __m128d flip(__m128d x) {
+	return _mm_xor_pd(x, _mm_set_pd(0.0,-0.0));
+}
+
+/* Exchange the low and high parts */
+inline __m128d swap(__m128d x) {
+	return _mm_shuffle_pd(x,x,1);
+}
+
+#ifdef _IBEX_WITH_NATIVE_
+/* The native arithmetic already stores the pair (-a,b) */
+
+/* (-a,b) */
+inline __m128d load(const Interval& x) {
+	return _mm_loadu_pd((const double*) &x);
+}
+
+/* (a,b) */
+inline __m128d raw(const Interval& x) {
+	return flip(load(x));
+}
+#else
+/* (a,b) */
+inline __m128d raw(const Interval& x) {
+	return _mm_loadu_pd((const double*) &x);
+}
+
+/* (-a,b) */
+inline __m128d load(const Interval& x) {
+	return flip(raw(x));
+}
+#endif
+
+/* (-x,x) */
+inline __m128d load(double x) {
+	return _mm_set_pd(x,-x);
+}
+
+inline void store(Interval& x, __m128d v) {
+#ifdef _IBEX_WITH_NATIVE_
+	_mm_storeu_pd((double*) &x, v);
+#else
+	_mm_storeu_pd((double*) &x, flip(v));
+#endif
+}
+
+/* All the bits set if x is empty */
+inline __m128d empty_mask(const Interval& x) {
+	__m128d v=raw(x);
+	return _mm_cmpunord_pd(v,v);
+}
+
+inline __m128d empty_mask(double) {
+	return _mm_setzero_pd();
+}
+
+/* (-a,a) and (-b,b) */
+inline void split(const Interval& x, __m128d& l, __m128d& u) {
+	__m128d v=raw(x);
+	l=flip(_mm_unpacklo_pd(v,v));
+	u=flip(_mm_unpackhi_pd(v,v));
+}
+
+inline void split(double x, __m128d& l, __m128d& u) {
+	l=u=load(x);
+}
+
+/* (a,a) and (b,b) */
+inline void bcast(const Interval& x, __m128d& l, __m128d& u) {
+	__m128d v=raw(x);
+	l=_mm_unpacklo_pd(v,v);
+	u=_mm_unpackhi_pd(v,v);
+}
+
+inline void bcast(double x, __m128d& l, __m128d& u) {
+	l=u=_mm_set1_pd(x);
+}
+
+/* Product where 0*oo=0 */
+inline __m128d mul0(__m128d x, __m128d y) {
+	__m128d p=_mm_mul_pd(x,y);
+	return _mm_and_pd(p,_mm_cmpord_pd(p,p));
+}
+
+/*
+ * Product of [a1,a2] (given by split) and [b1,b2] (given by bcast):
+ * the lower (resp. upper) bound is the smallest (resp. largest) of
+ * the products ai*bj, hence (-lb,ub) is the max of the pairs (-ai*bj,ai*bj).
+ */
+inline __m128d mul(__m128d al, __m128d au, __m128d bl, __m128d bu) {
+	return _mm_max_pd(_mm_max_pd(mul0(al,bl),mul0(al,bu)), _mm_max_pd(mul0(au,bl),mul0(au,bu)));
+}
+
+template<class T>
+inline __m128d mul(const Interval& a, const T& x) {
+	__m128d al,au,xl,xu;
+	split(a,al,au);
+	bcast(x,xl,xu);
+	return _mm_or_pd(mul(al,au,xl,xu),_mm_or_pd(empty_mask(a),empty_mask(x)));
+}
+
+inline __m128d mul(double a, const Interval& x) {
+	__m128d al,au,xl,xu;
+	split(a,al,au);
+	bcast(x,xl,xu);
+	return _mm_or_pd(_mm_max_pd(mul0(al,xl),mul0(al,xu)),empty_mask(x));
+}
+
+template<class T>
+inline void _add_kernel(Interval* x, const T* y, int n) {
+	RoundUp r;
+	for (int i=0; i<n; i++)
+		store(x[i],_mm_add_pd(load(x[i]),load(y[i])));
+}
+
+template<class T>
+inline void _sub_kernel(Interval* x, const T* y, int n) {
+	RoundUp r;
+	for (int i=0; i<n; i++)
+		store(x[i],_mm_add_pd(load(x[i]),swap(load(y[i]))));
+}
+
+template<class S>
+inline void _mul_kernel(const S& a, Interval* x, int n) {
+	RoundUp r;
+	for (int i=0; i<n; i++)
+		store(x[i],mul(a,x[i]));
+}
+
+template<class S, class T>
+inline void _axpy_kernel(const S& a, const T* x, Interval* y, int n) {
+	RoundUp r;
+	for (int i=0; i<n; i++)
+		store(y[i],_mm_add_pd(load(y[i]),mul(a,x[i])));
+}
+
+template<class T>
+inline void _dot_kernel(const T* x, const Interval* y, int n, Interval& acc) {
+	RoundUp r;
+	__m128d s=load(acc);
+	for (int i=0; i<n; i++)
+		s=_mm_add_pd(s,mul(y[i],x[i]));
+	store(acc,s);
+}
+
+} // end anonymous namespace
+
+void add_kernel(Interval* x, const Interval* y, int n) {
+	_add_kernel(x,y,n);
+}
+
+void add_kernel(Interval* x, const double* y, int n) {
+	_add_kernel(x,y,n);
+}
+
+void sub_kernel(Interval* x, const Interval* y, int n) {
+	_sub_kernel(x,y,n);
+}
+
+void sub_kernel(Interval* x, const double* y, int n) {
+	_sub_kernel(x,y,n);
+}
+
+void mul_kernel(const Interval& a, Interval* x, int n) {
+	_mul_kernel(a,x,n);
+}
+
+void mul_kernel(double a, Interval* x, int n) {
+	_mul_kernel(a,x,n);
+}
+
+void axpy_kernel(const Interval& a, const Interval* x, Interval* y, int n) {
+	_axpy_kernel(a,x,y,n);
+}
+
+void axpy_kernel(const Interval& a, const double* x, Interval* y, int n) {
+	_axpy_kernel(a,x,y,n);
+}
+
+void axpy_kernel(double a, const Interval* x, Interval* y, int n) {
+	_axpy_kernel(a,x,y,n);
+}
+
+void dot_kernel(const Interval* x, const Interval* y, int n, Interval& acc) {
+	_dot_kernel(x,y,n,acc);
+}
+
+void dot_kernel(const double* x, const Interval* y, int n, Interval& acc) {
+	_dot_kernel(x,y,n,acc);
+}
+
+void sub_dot_kernel(const Interval* x, const Interval* y, int n, Interval& acc) {
+	RoundUp r;
+	__m128d s=load(acc);
+	for (int i=0; i<n; i++)
+		s=_mm_add_pd(s,swap(mul(y[i],x[i])));
+	store(acc,s);
+}
+
+void hull_kernel(Interval* x, const Interval* y, int n) {
+	// (-lb,ub) of the hull is the max of the pairs;
+	// note: _mm_max_pd returns the 2nd argument if one is NaN.
+	for (int i=0; i<n; i++) {
+		__m128d a=load(x[i]);
+		__m128d b=load(y[i]);
+		__m128d m=empty_mask(y[i]);
+		store(x[i],_mm_or_pd(_mm_and_pd(m,a),_mm_andnot_pd(m,_mm_max_pd(a,b))));
+	}
+}
+
+bool inter_kernel(Interval* x, const Interval* y, int n) {
+	// (-lb,ub) of the intersection is the min of the pairs
+	bool nonempty=true;
+	for (int i=0; i<n; i++) {
+		store(x[i],_mm_or_pd(_mm_min_pd(load(x[i]),load(y[i])),empty_mask(x[i])));
+		// note: false if a bound is NaN
+		nonempty &= (x[i].lb()<=x[i].ub());
+	}
+	return nonempty;
+}
+
+#else
+
+void add_kernel(Interval* x, const Interval* y, int n) {
+	for (int i=0; i<n; i++) x[i]+=y[i];
+}
+
+void add_kernel(Interval* x, const double* y, int n) {
+	for (int i=0; i<n; i++) x[i]+=y[i];
+}
+
+void sub_kernel(Interval* x, const Interval* y, int n) {
+	for (int i=0; i<n; i++) x[i]-=y[i];
+}
+
+void sub_kernel(Interval* x, const double* y, int n) {
+	for (int i=0; i<n; i++) x[i]-=y[i];
+}
+
+void mul_kernel(const Interval& a, Interval* x, int n) {
+	for (int i=0; i<n; i++) x[i]*=a;
+}
+
+void mul_kernel(double a, Interval* x, int n) {
+	for (int i=0; i<n; i++) x[i]*=a;
+}
+
+void axpy_kernel(const Interval& a, const Interval* x, Interval* y, int n) {
+	for (int i=0; i<n; i++) y[i]+=a*x[i];
+}
+
+void axpy_kernel(const Interval& a, const double* x, Interval* y, int n) {
+	for (int i=0; i<n; i++) y[i]+=a*x[i];
+}
+
+void axpy_kernel(double a, const Interval* x, Interval* y, int n) {
+	for (int i=0; i<n; i++) y[i]+=a*x[i];
+}
+
+void dot_kernel(const Interval* x, const Interval* y, int n, Interval& acc) {
+	for (int i=0; i<n; i++) acc+=x[i]*y[i];
+}
+
+void dot_kernel(const double* x, const Interval* y, int n, Interval& acc) {
+	for (int i=0; i<n; i++) acc+=x[i]*y[i];
+}
+
+void sub_dot_kernel(const Interval* x, const Interval* y, int n, Interval& acc) {
+	for (int i=0; i<n; i++) acc-=x[i]*y[i];
+}
+
+void hull_kernel(Interval* x, const Interval* y, int n) {
+	for (int i=0; i<n; i++) x[i]|=y[i];
+}
+
+bool inter_kernel(Interval* x, const Interval* y, int n) {
+	for (int i=0; i<n; i++)
+		if ((x[i]&=y[i]).is_empty()) return false;
+	return true;
+}
+
+#endif
+
+} // end namespace ibex
@@ -0,0 +1,88 @@
+/* ============================================================================
+ * I B E X - Kernels of interval linear algebra
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : IBEX contributors
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __IBEX_INTERVAL_KERNELS_H__
+#define __IBEX_INTERVAL_KERNELS_H__
+
+#include "ibex_Interval.h"
+
+namespace ibex {
+
+/**
+ * \ingroup arithmetic
+ *
+ * \defgroup kernels Kernels of interval linear algebra
+ *
+ * Loops over arrays of n intervals (or reals) used by the operators of
+ * IntervalVector and IntervalMatrix and by the linear solvers.
+ *
+ * When SSE2 is available (and the interval type is made of two doubles),
+ * an interval [a,b] is processed as the pair (-a,b) in a single register:
+ * both bounds are then rounded upward, and the rounding mode is set
+ * only once per call. The results are the same as with the interval
+ * operators (the operations are performed in the same order).
+ *
+ * All the intervals are assumed to be non-empty; an empty component
+ * gives an empty result (as with the interval operators).
+ */
+/*@{*/
+
+/** \brief x[i] += y[i]. */
+void add_kernel(Interval* x, const Interval* y, int n);
+
+/** \brief x[i] += y[i]. */
+void add_kernel(Interval* x, const double* y, int n);
+
+/** \brief x[i] -= y[i]. */
+void sub_kernel(Interval* x, const Interval* y, int n);
+
+/** \brief x[i] -= y[i]. */
+void sub_kernel(Interval* x, const double* y, int n);
+
+/** \brief x[i] *= a. */
+void mul_kernel(const Interval& a, Interval* x, int n);
+
+/** \brief x[i] *= a. */
+void mul_kernel(double a, Interval* x, int n);
+
+/** \brief y[i] += a*x[i]. */
+void axpy_kernel(const Interval& a, const Interval* x, Interval* y, int n);
+
+/** \brief y[i] += a*x[i]. */
+void axpy_kernel(const Interval& a, const double* x, Interval* y, int n);
+
+/** \brief y[i] += a*x[i]. */
+void axpy_kernel(double a, const Interval* x, Interval* y, int n);
+
+/** \brief acc += x[0]*y[0], acc += x[1]*y[1], ... */
+void dot_kernel(const Interval* x, const Interval* y, int n, Interval& acc);
+
+/** \brief acc += x[0]*y[0], acc += x[1]*y[1], ... */
+void dot_kernel(const double* x, const Interval* y, int n, Interval& acc);
+
+/** \brief acc -= x[0]*y[0], acc -= x[1]*y[1], ... */
+void sub_dot_kernel(const Interval* x, const Interval* y, int n, Interval& acc);
+
+/** \brief x[i] |= y[i]. */
+void hull_kernel(Interval* x, const Interval* y, int n);
+
+/**
+ * \brief x[i] &= y[i].
+ *
+ * Return false if one intersection is empty (x is then undefined).
+ */
+bool inter_kernel(Interval* x, const Interval* y, int n);
+
+/*@}*/
+
+} // end namespace ibex
+
+#endif // __IBEX_INTERVAL_KERNELS_H__
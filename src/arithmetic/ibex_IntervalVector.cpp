@@ -10,6 +10,7 @@
  * ---------------------------------------------------------------------------- */
 
 #include "ibex_IntervalVector.h"
+#include "ibex_IntervalKernels.h"
 #include <vector>
 #include <stdlib.h>
 #include <sstream>
@@ -22,22 +23,22 @@
 
 namespace ibex {
 
-IntervalVector::IntervalVector(int nn) : n(nn), vec(new Interval[nn]) {
+IntervalVector::IntervalVector(int nn) : n(nn), own(true), vec(new Interval[nn]) {
 	assert(nn>=1);
 	for (int i=0; i<nn; i++) vec[i]=Interval::ALL_REALS;
 }
 
-IntervalVector::IntervalVector(int n1, const Interval& x) : n(n1), vec(new Interval[n1]) {
+IntervalVector::IntervalVector(int n1, const Interval& x) : n(n1), own(true), vec(new Interval[n1]) {
 	assert(n1>=1);
 	for (int i=0; i<n1; i++) vec[i]=x;
 }
 
-IntervalVector::IntervalVector(const IntervalVector& x) : n(x.n), vec(new Interval[x.n]) {
+IntervalVector::IntervalVector(const IntervalVector& x) : n(x.n), own(true), vec(new Interval[x.n]) {
 	assert(x.vec!=NULL); // forbidden to copy uninitialized boxes
 	for (int i=0; i<n; i++) vec[i]=x[i];
 }
 
-IntervalVector::IntervalVector(int n1, double bounds[][2]) : n(n1), vec(new Interval[n1]) {
+IntervalVector::IntervalVector(int n1, double bounds[][2]) : n(n1), own(true), vec(new Interval[n1]) {
 	if (bounds==0) // probably, the user called IntervalVector(n,0) and 0 is interpreted as NULL!
 		for (int i=0; i<n1; i++)
 			vec[i]=Interval::ZERO;
@@ -46,10 +47,14 @@ IntervalVector::IntervalVector(int n1, double bounds[][2]) : n(n1), vec(new Inte
 			vec[i]=Interval(bounds[i][0],bounds[i][1]);
 }
 
-IntervalVector::IntervalVector(const Vector& x) : n(x.size()), vec(new Interval[n]) {
+IntervalVector::IntervalVector(const Vector& x) : n(x.size()), own(true), vec(new Interval[n]) {
 	for (int i=0; i<n; i++) vec[i]=x[i];
 }
 
+IntervalVector::IntervalVector(int n1, Interval* storage, bool own) : n(n1), own(own), vec(storage) {
+	assert(n1>=1);
+}
+
 void IntervalVector::init(const Interval& x) {
 	for (int i=0; i<size(); i++)
 		(*this)[i]=x;
@@ -68,10 +73,11 @@ void IntervalVector::resize(int n2) {
 		newVec[i]=vec[i];
 	for (; i<n2; i++)
 		newVec[i]=Interval::ALL_REALS;
-	if (vec!=NULL) // vec==NULL happens when default constructor is used (n==0)
+	if (vec!=NULL && own) // vec==NULL happens when default constructor is used (n==0)
 		delete[] vec;
 
 	n   = n2;
+	own = true;
 	vec = newVec;
 }
 
@@ -83,13 +89,8 @@ IntervalVector& IntervalVector::operator&=(const IntervalVector& x)  {
 	if (is_empty()) return *this;
 	if (x.is_empty()) { set_empty(); return *this; }
 
-	for (int i=0; i<size(); i++) {
-		(*this)[i] &= x[i];
-		if ((*this)[i].is_empty()) {
-			set_empty();
-			return *this;
-		}
-	}
+	if (!inter_kernel(vec,x.vec,n))
+		set_empty();
 	return *this;
 }
 
@@ -100,9 +101,7 @@ IntervalVector& IntervalVector::operator|=(const IntervalVector& x)  {
 	if (x.is_empty()) return *this;
 	if (is_empty()) { *this=x; return *this; }
 
-	for (int i=0; i<size(); i++) {
-		(*this)[i] |= x[i];
-	}
+	hull_kernel(vec,x.vec,n);
 	return *this;
 }
 
@@ -74,6 +74,21 @@ public:
 	 */
 	IntervalVector(const Vector& x);
 
+	/**
+	 * \brief Create a vector of dimension \a n stored in \a storage.
+	 *
+	 * The components are the \a n intervals in \a storage (they are not copied).
+	 *
+	 * If \a own is true, the vector takes the ownership of the storage, which
+	 * must have been allocated by new Interval[n]. Otherwise, the storage is
+	 * external: the destructor does not free it and #resize(int) moves the
+	 * components to memory owned by the vector.
+	 *
+	 * \pre n>0 and \a storage contains \a n intervals. An external storage
+	 * must not be freed before the vector is deleted or resized.
+	 */
+	IntervalVector(int n, Interval* storage, bool own);
+
 	/**
 	 * \brief Create [empty; ...; empty]
 	 *
@@ -140,6 +155,8 @@ public:
 	 * modified and the new ones are set to (-inf,+inf), even if
 	 * (*this) is the empty Interval (however, in this case, the status of
 	 * (*this) remains "empty").
+	 * If the vector was built on an external storage, the storage is
+	 * left unchanged.
 	 */
 	void resize(int n2);
 
@@ -543,10 +560,11 @@ private:
 	friend class IntervalMatrix;
 	friend class Affine2Vector;
 
-	IntervalVector() : n(0), vec(NULL) { } // for IntervalMatrix & complementary()
+	IntervalVector() : n(0), own(true), vec(NULL) { } // for IntervalMatrix & complementary()
 
 
 	int n;             // dimension (size of vec)
+	bool own;          // false if vec is an external storage (not to be freed)
 	Interval *vec;	   // vector of elements
 };
 
@@ -707,7 +725,7 @@ inline IntervalVector IntervalVector::empty(int n) {
 }
 
 inline IntervalVector::~IntervalVector() {
-	delete[] vec;
+	if (own) delete[] vec;
 }
 
 inline void IntervalVector::set_empty() {
@@ -11,6 +11,7 @@
 
 #include "ibex_Affine2Matrix.h"
 #include "ibex_IntervalMatrix.h"
+#include "ibex_IntervalKernels.h"
 
 namespace ibex {
 
@@ -249,6 +250,153 @@ inline Mout mulMM(const Min1& m1, const Min2& m2) {
 	return m3;
 }
 
+/*================== specializations with interval kernels ==================*/
+
+/* the array of components (note: a vector has at least one component) */
+inline double* data(Vector& v)                           { return &v[0]; }
+inline const double* data(const Vector& v)               { return &v[0]; }
+inline Interval* data(IntervalVector& v)                 { return &v[0]; }
+inline const Interval* data(const IntervalVector& v)     { return &v[0]; }
+
+template<>
+inline IntervalVector& set_addV<IntervalVector,Vector>(IntervalVector& v1, const Vector& v2) {
+	assert(v1.size()==v2.size());
+	if (is_empty(v1)) return v1;
+	add_kernel(data(v1),data(v2),v1.size());
+	return v1;
+}
+
+template<>
+inline IntervalVector& set_addV<IntervalVector,IntervalVector>(IntervalVector& v1, const IntervalVector& v2) {
+	assert(v1.size()==v2.size());
+	if (is_empty(v1) || is_empty(v2)) { set_empty(v1); return v1; }
+	add_kernel(data(v1),data(v2),v1.size());
+	return v1;
+}
+
+template<>
+inline IntervalVector& set_subV<IntervalVector,Vector>(IntervalVector& v1, const Vector& v2) {
+	assert(v1.size()==v2.size());
+	if (is_empty(v1)) return v1;
+	sub_kernel(data(v1),data(v2),v1.size());
+	return v1;
+}
+
+template<>
+inline IntervalVector& set_subV<IntervalVector,IntervalVector>(IntervalVector& v1, const IntervalVector& v2) {
+	assert(v1.size()==v2.size());
+	if (is_empty(v1) || is_empty(v2)) { set_empty(v1); return v1; }
+	sub_kernel(data(v1),data(v2),v1.size());
+	return v1;
+}
+
+template<>
+inline IntervalVector& set_mulSV<double,IntervalVector>(const double& x, IntervalVector& v) {
+	if (is_empty(v)) return v;
+	mul_kernel(x,data(v),v.size());
+	return v;
+}
+
+template<>
+inline IntervalVector& set_mulSV<Interval,IntervalVector>(const Interval& x, IntervalVector& v) {
+	if (is_empty(x) || is_empty(v)) { set_empty(v); return v; }
+	mul_kernel(x,data(v),v.size());
+	return v;
+}
+
+template<>
+inline Interval mulVV<Vector,IntervalVector,Interval>(const Vector& v1, const IntervalVector& v2) {
+	assert(v1.size()==v2.size());
+	if (is_empty(v2)) return Interval::EMPTY_SET;
+	Interval y=0;
+	dot_kernel(data(v1),data(v2),v1.size(),y);
+	return y;
+}
+
+template<>
+inline Interval mulVV<IntervalVector,Vector,Interval>(const IntervalVector& v1, const Vector& v2) {
+	assert(v1.size()==v2.size());
+	if (is_empty(v1)) return Interval::EMPTY_SET;
+	Interval y=0;
+	dot_kernel(data(v2),data(v1),v1.size(),y);
+	return y;
+}
+
+template<>
+inline Interval mulVV<IntervalVector,IntervalVector,Interval>(const IntervalVector& v1, const IntervalVector& v2) {
+	assert(v1.size()==v2.size());
+	if (is_empty(v1) || is_empty(v2)) return Interval::EMPTY_SET;
+	Interval y=0;
+	dot_kernel(data(v1),data(v2),v1.size(),y);
+	return y;
+}
+
+/*
+ * v*m and m1*m2 are calculated row by row, as linear combinations
+ * of the rows of m (resp. m2). The sum of each component is made in
+ * the same order as in the generic functions.
+ */
+template<class Vin, class M>
+inline IntervalVector mulVM_rows(const Vin& v, const M& m) {
+	assert(m.nb_rows()==v.size());
+
+	IntervalVector y(m.nb_cols(),Interval::ZERO);
+
+	if (is_empty(m) || is_empty(v)) { set_empty(y); return y; }
+
+	for (int i=0; i<m.nb_rows(); i++)
+		axpy_kernel(v[i],data(m[i]),data(y),m.nb_cols());
+
+	return y;
+}
+
+template<>
+inline IntervalVector mulVM<Vector,IntervalMatrix,IntervalVector>(const Vector& v, const IntervalMatrix& m) {
+	return mulVM_rows(v,m);
+}
+
+template<>
+inline IntervalVector mulVM<IntervalVector,Matrix,IntervalVector>(const IntervalVector& v, const Matrix& m) {
+	return mulVM_rows(v,m);
+}
+
+template<>
+inline IntervalVector mulVM<IntervalVector,IntervalMatrix,IntervalVector>(const IntervalVector& v, const IntervalMatrix& m) {
+	return mulVM_rows(v,m);
+}
+
+template<class Min1, class Min2>
+inline IntervalMatrix mulMM_rows(const Min1& m1, const Min2& m2) {
+	assert(m1.nb_cols()==m2.nb_rows());
+
+	IntervalMatrix m3(m1.nb_rows(),m2.nb_cols(),Interval::ZERO);
+
+	if (is_empty(m1) || is_empty(m2)) { set_empty(m3); return m3; }
+
+	for (int i=0; i<m1.nb_rows(); i++) {
+		for (int k=0; k<m1.nb_cols(); k++)
+			axpy_kernel(m1[i][k],data(m2[k]),data(m3[i]),m2.nb_cols());
+	}
+	return m3;
+}
+
+template<>
+inline IntervalMatrix mulMM<Matrix,IntervalMatrix,IntervalMatrix>(const Matrix& m1, const IntervalMatrix& m2) {
+	return mulMM_rows(m1,m2);
+}
+
+template<>
+inline IntervalMatrix mulMM<IntervalMatrix,Matrix,IntervalMatrix>(const IntervalMatrix& m1, const Matrix& m2) {
+	return mulMM_rows(m1,m2);
+}
+
+template<>
+inline IntervalMatrix mulMM<IntervalMatrix,IntervalMatrix,IntervalMatrix>(const IntervalMatrix& m1, const IntervalMatrix& m2) {
+	return mulMM_rows(m1,m2);
+}
+
+/*===========================================================================*/
+
 template<typename V>
 inline V absV(const V& v) {
 	V res(v.size());
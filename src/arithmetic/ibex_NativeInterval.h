@@ -0,0 +1,50 @@
+/* ============================================================================
+ * I B E X - Raw interval of the native interval arithmetic
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : IBEX contributors
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __IBEX_NATIVE_INTERVAL_H__
+#define __IBEX_NATIVE_INTERVAL_H__
+
+namespace ibex {
+
+/**
+ * \ingroup arithmetic
+ *
+ * \brief Raw interval of the native arithmetic.
+ *
+ * An interval [a,b] is stored as the pair (-a,b), so that both bounds are
+ * calculated with the same rounding mode (upward): the lower bound of
+ * x+y is -((-a)+(-c)), etc. The rounding mode is set by each operation
+ * and restored afterwards (see #ibex::native::RoundUp).
+ *
+ * The empty set is represented by (NaN,NaN).
+ */
+class NativeInterval {
+public:
+	/** \brief Create [a,b] (no check). */
+	NativeInterval(double a, double b) : nlb(-a), ub(b) { }
+
+	/** \brief Set *this to [x,x]. */
+	NativeInterval& operator=(double x) {
+		nlb=-x;
+		ub=x;
+		return *this;
+	}
+
+	/** \brief The opposite of the lower bound. */
+	double nlb;
+
+	/** \brief The upper bound. */
+	double ub;
+};
+
+} // end namespace ibex
+
+#endif // __IBEX_NATIVE_INTERVAL_H__
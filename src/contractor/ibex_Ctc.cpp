@@ -14,6 +14,10 @@
 
 namespace ibex {
 
+void Ctc::contract(IntervalVector& box) {
+	if (!try_contract(box)) throw EmptyBoxException();
+}
+
 void Ctc::contract(IntervalVector& box, const BitSet& impact) {
 	_impact = &impact;
 
@@ -48,6 +52,41 @@ void Ctc::contract(IntervalVector& box, const BitSet& impact, BitSet& flags) {
 	_output_flags = NULL;
 }
 
+bool Ctc::try_contract(IntervalVector& box) {
+	try {
+		contract(box);
+	}
+	catch(EmptyBoxException&) {
+		box.set_empty();
+		return false;
+	}
+	return !box.is_empty();
+}
+
+bool Ctc::try_contract(IntervalVector& box, const BitSet& impact) {
+	_impact = &impact;
+
+	bool res=try_contract(box);
+
+	_impact = NULL;
+
+	return res;
+}
+
+bool Ctc::try_contract(IntervalVector& box, const BitSet& impact, BitSet& flags) {
+	_impact = &impact;
+	_output_flags = &flags;
+
+	flags.clear();
+
+	bool res=try_contract(box);
+
+	_impact = NULL;
+	_output_flags = NULL;
+
+	return res;
+}
+
 bool Ctc::check_nb_var_ctc_list (const Array<Ctc>& l)  {
 	int i=1, n=l[0].nb_var;
 	while (i<l.size() && l[i].nb_var==n) {
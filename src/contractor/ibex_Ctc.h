@@ -44,8 +44,14 @@ public:
 
 	/**
 	 * \brief Contraction.
+	 *
+	 * By default, this function calls #try_contract(IntervalVector&) and throws
+	 * an #ibex::EmptyBoxException if the box is empty. A contractor must
+	 * redefine at least one of these two functions.
+	 *
+	 * \throw #ibex::EmptyBoxException - if the box is empty.
 	 */
-	virtual void contract(IntervalVector& box)=0;
+	virtual void contract(IntervalVector& box);
 
 	/**
 	 * \brief Delete *this.
@@ -72,6 +78,38 @@ public:
 	 */
 	void contract(IntervalVector& box, const BitSet& impact, BitSet& flags);
 
+	/**
+	 * \brief Contraction, without exception.
+	 *
+	 * Same as #contract(IntervalVector&) except that an empty result is not
+	 * signaled by an #ibex::EmptyBoxException: the box is set to the empty set
+	 * and false is returned. Throwing and catching an exception is far more
+	 * expensive than the contraction itself in most cases.
+	 *
+	 * By default, this function calls #contract(IntervalVector&) and catches
+	 * the exception. The main built-in contractors only redefine this function,
+	 * so that no exception is thrown at all (their #contract(IntervalVector&) is
+	 * the default one). A subclass of such a contractor must therefore redefine
+	 * this function, not #contract(IntervalVector&), to change the contraction.
+	 *
+	 * \return false iff the box is empty.
+	 */
+	virtual bool try_contract(IntervalVector& box);
+
+	/**
+	 * \brief Contraction with specified impact, without exception.
+	 *
+	 * \see #contract(IntervalVector&, const BitSet&) and #try_contract(IntervalVector&).
+	 */
+	bool try_contract(IntervalVector& box, const BitSet& impact);
+
+	/**
+	 * \brief Contraction with specified impact and output flags, without exception.
+	 *
+	 * \see #contract(IntervalVector&, const BitSet&, BitSet&) and #try_contract(IntervalVector&).
+	 */
+	bool try_contract(IntervalVector& box, const BitSet& impact, BitSet& flags);
+
 	/**
 	 * \brief The number of variables this contractor works with.
 	 */
@@ -102,7 +102,7 @@ class Ctc3BCid : public Ctc {
 
 
 	/**
-	 * \brief Apply contraction.
+	 * \brief Apply contraction, without exception.
 	 *
 	 * Applies 3BCID contraction on #vhandled variables of #cid_vars, starting
 	 * by #start_var.
@@ -110,8 +110,10 @@ class Ctc3BCid : public Ctc {
 	 * If the \link ibex::Contractor::Indicators::scope scope \endlink field is a
 	 * specific variable, then #var3BCID is called with the specified variable.
 	 * Otherwise, 3BCID will be performed.
+	 *
+	 * \return false iff the box is empty.
 	 */
-	virtual void contract(IntervalVector& box);
+	virtual bool try_contract(IntervalVector& box);
 
 	/** The variables to which var3BCID is applied **/
 	BitSet cid_vars;
@@ -30,7 +30,7 @@ CtcAcid::CtcAcid(const System& sys, Ctc& ctc, bool optim, int s3b, int scid,
 		system(sys), nbcalls(0), nbctvar(0), ctratio(ct_ratio), nbcidvar(0) ,  nbtuning(0), optim(optim) {
 }
 
-void CtcAcid::contract(IntervalVector& box) {
+bool CtcAcid::try_contract(IntervalVector& box) {
 
 	int nb_CID_var=cid_vars.size();                    // [gch]
 	impact.clear();                                    // [gch]
@@ -67,8 +67,10 @@ void CtcAcid::contract(IntervalVector& box) {
 		impact.add(v2);
 		var3BCID(box, v2);                             // appel 3BCID sur la variable v2
 		impact.remove(v2);
-		if(box.is_empty())
-			throw EmptyBoxException();
+		if(box.is_empty()) {
+			delete [] ctstat;
+			return false;
+		}
 		if (nbcall1 < nbinitcalls) {                   // on fait des stats pour le réglage courant
 			for (int i=0; i<initbox.size(); i++)
 			{//cout << i << " initbox " << initbox[i].diam() << " box " << box[i].diam() << endl;
@@ -105,6 +107,7 @@ void CtcAcid::contract(IntervalVector& box) {
 	}
 
 	delete [] ctstat;
+	return true;
 }
 
 // en optim, l'objectif est placé en 1er
@@ -63,7 +63,7 @@ public :
 	    double var_min_width=default_var_min_width, double ct_ratio=default_ctratio);
 
 	/**
-	 * \brief the contraction function
+	 * \brief the contraction function, without exception
 	 *
 	 * Adaptive CID : the number nbcidbar of variables on which 3BCID is applied is adaptively determined
 	 * At the beginning, during the first nbinitcalls nodes,there isthe first tuning phase where nbcidvar = nbvar
@@ -77,8 +77,10 @@ public :
 	 *  For computing nbcidvar during a tuning phase, one determines after how many variables, 
 	 *  the average gain (on all the dimensions of the current box) is less  than ct_ratio:
 	 *  this average number of variables (during the tuning phase) will become nbcidvar.
+	 *
+	 * \return false iff the box is empty.
 	 */
-	virtual void contract(IntervalVector& box);
+	virtual bool try_contract(IntervalVector& box);
 
 	double nbvar_stat();
 
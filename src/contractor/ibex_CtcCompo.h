@@ -78,9 +78,9 @@ public:
 	~CtcCompo();
 
 	/**
-	 * \brief Contract a box.
+	 * \brief Contract a box, without exception.
 	 */
-	virtual void contract(IntervalVector& box);
+	virtual bool try_contract(IntervalVector& box);
 
 	/** The list of sub-contractors */
 	Array<Ctc> list;
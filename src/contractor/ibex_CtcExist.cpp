@@ -4,97 +4,267 @@
 // Author      : Jordan Ninin, Gilles Chabert
 // License     : See the LICENSE file
 // Created     : Jan 29, 2014
-// Last Update : May 7, 2014
+// Last Update : Oct 17, 2026
 //============================================================================
 
 #include "ibex_CtcExist.h"
+#include "ibex_MemoryPool.h"
+
 #include <cassert>
+#include <new>
 
 using namespace std;
 
 namespace ibex {
 
+/*
+ * A cell of the paving of the parameters.
+ *
+ * The boxes of a node are stored in a single block of the memory pools:
+ * - cell: the initial box of the cell
+ * - y:    the box of the cell contracted w.r.t. "key" (bisected to give the sub-cells)
+ * - key:  the box x for which "y" has been calculated
+ * - x:    the box x contracted in the current call to contract(...)
+ */
+class CtcExist::Node {
+public:
+	Node(int n, const IntervalVector& cell);
+
+	~Node();
+
+	/* Whether the initial box of this cell is y */
+	bool is_cell(const IntervalVector& y) const;
+
+	/* Whether y is the contraction of the cell */
+	bool is_contraction(const IntervalVector& y) const;
+
+	/* Whether x is a subset of key */
+	bool included(const Interval* x) const;
+
+	/* Store the contraction y of the cell w.r.t. x */
+	void set(const Interval* x, const IntervalVector& y);
+
+	/* Store that the cell is infeasible w.r.t. x (the sub-cells are deleted) */
+	void set_empty(const Interval* x);
+
+	/* Delete the sub-cells and the contraction */
+	void clear();
+
+	static void* operator new(size_t size) {
+		return MemoryPool::allocate(size);
+	}
+
+	static void operator delete(void* p, size_t size) {
+		MemoryPool::deallocate(p,size);
+	}
+
+	const int n; // number of variables
+	const int m; // number of parameters
+	Interval* cell;
+	Interval* y;
+	Interval* key;
+	Interval* x;
+	double diam; // max diameter of y
+	bool done;   // whether y and key are set
+	bool empty;  // whether the cell is infeasible w.r.t. key
+	Node* left;
+	Node* right;
+
+private:
+	Node(const Node&);            // forbidden
+	Node& operator=(const Node&); // forbidden
+};
+
+CtcExist::Node::Node(int n, const IntervalVector& c) : n(n), m(c.size()), diam(0), done(false), empty(false), left(NULL), right(NULL) {
+	cell=(Interval*) MemoryPool::allocate((2*m+2*n)*sizeof(Interval));
+	for (int i=0; i<2*m+2*n; i++)
+		new (&cell[i]) Interval();
+	y=cell+m;
+	key=y+m;
+	x=key+n;
+	for (int i=0; i<m; i++) cell[i]=y[i]=c[i];
+	diam=c.max_diam();
+}
+
+CtcExist::Node::~Node() {
+	clear();
+	for (int i=0; i<2*m+2*n; i++)
+		cell[i].~Interval();
+	MemoryPool::deallocate(cell,(2*m+2*n)*sizeof(Interval));
+}
+
+bool CtcExist::Node::is_cell(const IntervalVector& y) const {
+	for (int i=0; i<m; i++)
+		if (cell[i]!=y[i]) return false;
+	return true;
+}
+
+bool CtcExist::Node::is_contraction(const IntervalVector& y) const {
+	for (int i=0; i<m; i++)
+		if (this->y[i]!=y[i]) return false;
+	return true;
+}
+
+bool CtcExist::Node::included(const Interval* x) const {
+	for (int i=0; i<n; i++)
+		if (!x[i].is_subset(key[i])) return false;
+	return true;
+}
+
+void CtcExist::Node::set(const Interval* x, const IntervalVector& y) {
+	for (int i=0; i<n; i++) key[i]=x[i];
+	for (int i=0; i<m; i++) this->y[i]=y[i];
+	diam=y.max_diam();
+	done=true;
+	empty=false;
+}
+
+void CtcExist::Node::set_empty(const Interval* x) {
+	clear();
+	for (int i=0; i<n; i++) key[i]=x[i];
+	done=true;
+	empty=true;
+}
+
+void CtcExist::Node::clear() {
+	if (left) delete left;
+	if (right) delete right;
+	left=right=NULL;
+	done=false;
+}
+
 CtcExist::CtcExist(const NumConstraint& ctr,  const ExprSymbol& y1, const IntervalVector& init_box, double prec)
- : CtcQuantif(ctr, Array<const ExprSymbol>(y1), init_box, prec) {
+ : CtcQuantif(ctr, Array<const ExprSymbol>(y1), init_box, prec),
+   root(NULL), x(nb_var), y(nb_param), y_mid(nb_param) {
 }
 
 CtcExist::CtcExist(const NumConstraint& ctr,  const ExprSymbol& y1, const ExprSymbol& y2, const IntervalVector& init_box, double prec)
- : CtcQuantif(ctr, Array<const ExprSymbol>(y1,y2), init_box, prec) {
+ : CtcQuantif(ctr, Array<const ExprSymbol>(y1,y2), init_box, prec),
+   root(NULL), x(nb_var), y(nb_param), y_mid(nb_param) {
 }
 
 CtcExist::CtcExist(const NumConstraint& ctr,  const ExprSymbol& y1, const ExprSymbol& y2, const ExprSymbol& y3, const IntervalVector& init_box, double prec)
- : CtcQuantif(ctr, Array<const ExprSymbol>(y1,y2,y3), init_box, prec) {
+ : CtcQuantif(ctr, Array<const ExprSymbol>(y1,y2,y3), init_box, prec),
+   root(NULL), x(nb_var), y(nb_param), y_mid(nb_param) {
 }
 
 CtcExist::CtcExist(const NumConstraint& ctr,  const ExprSymbol& y1, const ExprSymbol& y2, const ExprSymbol& y3, const ExprSymbol& y4, const IntervalVector& init_box, double prec)
- : CtcQuantif(ctr, Array<const ExprSymbol>(y1,y2,y3,y4), init_box, prec) {
+ : CtcQuantif(ctr, Array<const ExprSymbol>(y1,y2,y3,y4), init_box, prec),
+   root(NULL), x(nb_var), y(nb_param), y_mid(nb_param) {
 }
 
 CtcExist::CtcExist(const NumConstraint& ctr,  const ExprSymbol& y1, const ExprSymbol& y2, const ExprSymbol& y3, const ExprSymbol& y4, const ExprSymbol& y5, const IntervalVector& init_box, double prec)
- : CtcQuantif(ctr, Array<const ExprSymbol>(y1,y2,y3,y4,y5), init_box, prec) {
+ : CtcQuantif(ctr, Array<const ExprSymbol>(y1,y2,y3,y4,y5), init_box, prec),
+   root(NULL), x(nb_var), y(nb_param), y_mid(nb_param) {
 }
 
 CtcExist::CtcExist(const NumConstraint& ctr,  const ExprSymbol& y1, const ExprSymbol& y2, const ExprSymbol& y3, const ExprSymbol& y4, const ExprSymbol& y5, const ExprSymbol& y6, const IntervalVector& init_box, double prec)
- : CtcQuantif(ctr, Array<const ExprSymbol>(y1,y2,y3,y4,y5,y6), init_box, prec) {
+ : CtcQuantif(ctr, Array<const ExprSymbol>(y1,y2,y3,y4,y5,y6), init_box, prec),
+   root(NULL), x(nb_var), y(nb_param), y_mid(nb_param) {
 }
 
 CtcExist::CtcExist(const NumConstraint& ctr,  const ExprSymbol& y1, const ExprSymbol& y2, const ExprSymbol& y3, const ExprSymbol& y4, const ExprSymbol& y5, const ExprSymbol& y6, const ExprSymbol& y7, const IntervalVector& init_box, double prec)
- : CtcQuantif(ctr, Array<const ExprSymbol>(y1,y2,y3,y4,y5,y6,y7), init_box, prec) {
+ : CtcQuantif(ctr, Array<const ExprSymbol>(y1,y2,y3,y4,y5,y6,y7), init_box, prec),
+   root(NULL), x(nb_var), y(nb_param), y_mid(nb_param) {
 }
 
 CtcExist::CtcExist(const NumConstraint& ctr,  const ExprSymbol& y1, const ExprSymbol& y2, const ExprSymbol& y3, const ExprSymbol& y4, const ExprSymbol& y5, const ExprSymbol& y6, const ExprSymbol& y7, const ExprSymbol& y8, const IntervalVector& init_box, double prec)
- : CtcQuantif(ctr, Array<const ExprSymbol>(y1,y2,y3,y4,y5,y6,y7,y8), init_box, prec) {
+ : CtcQuantif(ctr, Array<const ExprSymbol>(y1,y2,y3,y4,y5,y6,y7,y8), init_box, prec),
+   root(NULL), x(nb_var), y(nb_param), y_mid(nb_param) {
 }
 
 CtcExist::CtcExist(const NumConstraint& ctr,  const ExprSymbol& y1, const ExprSymbol& y2, const ExprSymbol& y3, const ExprSymbol& y4, const ExprSymbol& y5, const ExprSymbol& y6, const ExprSymbol& y7, const ExprSymbol& y8, const ExprSymbol& y9, const IntervalVector& init_box, double prec)
- : CtcQuantif(ctr, Array<const ExprSymbol>(y1,y2,y3,y4,y5,y6,y7,y8,y9), init_box, prec) {
+ : CtcQuantif(ctr, Array<const ExprSymbol>(y1,y2,y3,y4,y5,y6,y7,y8,y9), init_box, prec),
+   root(NULL), x(nb_var), y(nb_param), y_mid(nb_param) {
 }
 
 CtcExist::CtcExist(const NumConstraint& ctr,  const ExprSymbol& y1, const ExprSymbol& y2, const ExprSymbol& y3, const ExprSymbol& y4, const ExprSymbol& y5, const ExprSymbol& y6, const ExprSymbol& y7, const ExprSymbol& y8, const ExprSymbol& y9, const ExprSymbol& y10, const IntervalVector& init_box, double prec)
- : CtcQuantif(ctr, Array<const ExprSymbol>(y1,y2,y3,y4,y5,y6,y7,y8,y9,y10), init_box, prec) {
+ : CtcQuantif(ctr, Array<const ExprSymbol>(y1,y2,y3,y4,y5,y6,y7,y8,y9,y10), init_box, prec),
+   root(NULL), x(nb_var), y(nb_param), y_mid(nb_param) {
 }
 
 CtcExist::CtcExist(const NumConstraint& ctr,  const ExprSymbol& y1, const ExprSymbol& y2, const ExprSymbol& y3, const ExprSymbol& y4, const ExprSymbol& y5, const ExprSymbol& y6, const ExprSymbol& y7, const ExprSymbol& y8, const ExprSymbol& y9, const ExprSymbol& y10, const ExprSymbol& y11, const IntervalVector& init_box, double prec)
- : CtcQuantif(ctr, Array<const ExprSymbol>(y1,y2,y3,y4,y5,y6,y7,y8,y9,y10,y11), init_box, prec) {
+ : CtcQuantif(ctr, Array<const ExprSymbol>(y1,y2,y3,y4,y5,y6,y7,y8,y9,y10,y11), init_box, prec),
+   root(NULL), x(nb_var), y(nb_param), y_mid(nb_param) {
 }
 
 CtcExist::CtcExist(const NumConstraint& ctr,  const ExprSymbol& y1, const ExprSymbol& y2, const ExprSymbol& y3, const ExprSymbol& y4, const ExprSymbol& y5, const ExprSymbol& y6, const ExprSymbol& y7, const ExprSymbol& y8, const ExprSymbol& y9, const ExprSymbol& y10, const ExprSymbol& y11, const ExprSymbol& y12, const IntervalVector& init_box, double prec)
- : CtcQuantif(ctr, Array<const ExprSymbol>(y1,y2,y3,y4,y5,y6,y7,y8,y9,y10,y11,y12), init_box, prec) {
+ : CtcQuantif(ctr, Array<const ExprSymbol>(y1,y2,y3,y4,y5,y6,y7,y8,y9,y10,y11,y12), init_box, prec),
+   root(NULL), x(nb_var), y(nb_param), y_mid(nb_param) {
 }
 
 CtcExist::CtcExist(Ctc& ctc, const BitSet& vars, const IntervalVector& init_box, double prec, bool own_ctc) :
-	CtcQuantif(ctc, vars, init_box, prec, own_ctc) {
+	CtcQuantif(ctc, vars, init_box, prec, own_ctc), root(NULL), x(nb_var), y(nb_param), y_mid(nb_param) {
 }
 
 CtcExist::CtcExist(const NumConstraint& c, const Array<const ExprSymbol>& y, const IntervalVector& y_init, double prec) :
-	CtcQuantif(c, y, y_init, prec) {
+	CtcQuantif(c, y, y_init, prec), root(NULL), x(nb_var), y(nb_param), y_mid(nb_param) {
 }
 
-void CtcExist::proceed(const IntervalVector& x_init, const IntervalVector& x_current, IntervalVector& x_res, IntervalVector& y) {
-	IntervalVector x = x_current;
+CtcExist::~CtcExist() {
+	flush();
+}
+
+void CtcExist::flush() {
+	if (root) delete root;
+	root=NULL;
+}
+
+void CtcExist::bisect(Node* node) {
+	for (int i=0; i<nb_param; i++) y[i]=node->y[i];
+	pair<IntervalVector,IntervalVector> cut = bsc->bisect(y);
+	node->left = new Node(nb_var,cut.first);
+	node->right = new Node(nb_var,cut.second);
+}
+
+void CtcExist::proceed(const IntervalVector& x_init, const Interval* x_current, IntervalVector& x_res, Node* node) {
+
+	// The result of the last contraction of the cell is valid if the box
+	// is included in the box for which it has been calculated.
+	bool fresh=!node->done || !node->included(x_current);
+
+	if (!fresh && node->empty) return;
+
+	for (int i=0; i<nb_var; i++) x[i]=x_current[i];
+	if (fresh) {
+		node->clear();
+		for (int i=0; i<nb_param; i++) y[i]=node->cell[i];
+	} else
+		for (int i=0; i<nb_param; i++) y[i]=node->y[i];
 
 	try {
 		CtcQuantif::contract(x, y);
 	} catch (EmptyBoxException&) {
+		node->set_empty(x_current);
 		return;
 	}
 
+	// If the cell is contracted further with the current box, the
+	// sub-cells are calculated again (from the contracted cell).
+	if (!fresh && !node->is_contraction(y)) {
+		node->clear();
+		fresh=true;
+	}
+
+	if (fresh) node->set(x_current, y);
+
 	if (!x.is_subset(x_res)) {
 
-		if (y.max_diam()<=prec) {
+		if (node->diam<=prec) {
 			x_res |= x;
 			if (x_res==x_init) return;
 		}
 		else {
 
-			l.push(pair<IntervalVector,IntervalVector>(x,y));
+			for (int i=0; i<nb_var; i++) node->x[i]=x[i];
+			l.push(node);
 
 			// ============================== sampling =============================
 			// To converge faster to the result, we contract with the mid-vector of y.
 			// This allows to get an estimate of "res" without waiting for epsilon-sized
 			// parameter boxes (getting quickly some estimate is important for pruning).
 			try {
-				IntervalVector y_mid = y.mid();
+				for (int i=0; i<nb_param; i++) y_mid[i]=y[i].mid();
 				CtcQuantif::contract(x,y_mid);  // x may be contracted here; that's why we pushed it on the stack *before* sampling.
 				x_res |= x;
 				if (x_res==x_init) return;
@@ -115,26 +285,27 @@ void CtcExist::contract(IntervalVector& box) {
 
 	assert(l.empty()); // even when an exception is thrown by this function, l is empty.
 
-	l.push(pair<IntervalVector,IntervalVector>(box, y_init));
-	
-	IntervalVector x_save(Ctc::nb_var);
-	IntervalVector x(Ctc::nb_var);
+	// the paving is calculated again if the initial
+	// box of the parameters has changed.
+	if (root && !root->is_cell(y_init)) flush();
 
-	IntervalVector y(nb_param);
-	IntervalVector y_mid(nb_param); // for sampling
+	if (!root) root = new Node(nb_var, y_init);
+
+	// the root cell is not contracted (as its sub-cells will be)
+	for (int i=0; i<nb_var; i++) root->x[i]=box[i];
+	l.push(root);
 
 	while (!l.empty()) {
 
-		// get the domain of variables
-		x_save = l.top().first;
-		// get and immediately bisect the domain of parameters (strategy inspired by Optimizer)
-		pair<IntervalVector,IntervalVector> cut = bsc->bisect(l.top().second);
-		
+		Node* node=l.top();
 		l.pop();
 
+		// get (or create) the bisection of the domain of parameters (strategy inspired by Optimizer)
+		if (!node->left) bisect(node);
+
 		// proceed with the two sub-boxes for y
-		proceed(box, x_save, res, cut.first);
-		proceed(box, x_save, res, cut.second);
+		proceed(box, node->x, res, node->left);
+		proceed(box, node->x, res, node->right);
 	}
 
 	box &= res;
@@ -4,7 +4,7 @@
 // Author      : Jordan Ninin, Gilles Chabert
 // License     : See the LICENSE file
 // Created     : Jan 29, 2014
-// Last Update : May 7, 2014
+// Last Update : Oct 17, 2026
 //============================================================================
 
 #ifndef __IBEX_CTC_EXIST_H__
@@ -13,7 +13,6 @@
 #include "ibex_CtcQuantif.h"
 
 #include <stack>
-#include <list>
 
 namespace ibex {
 
@@ -27,6 +26,13 @@ namespace ibex {
  *    exists y in[y] |  c(x,y).
  *
  * where y is a vector of "parameters".
+ *
+ * The paving of the parameter box built by a call to #contract(IntervalVector&)
+ * is kept for the next calls. When the next box is included in the box for which
+ * a cell of the paving has been processed, the contraction of the cell is reused:
+ * the cells proven infeasible are skipped and the other ones are not bisected again.
+ * A cell (and its sub-paving) is only calculated again if the box is not included.
+ * In a branch & prune, this avoids rebuilding the paving from scratch for each box.
  */
 class CtcExist : public CtcQuantif {
 public:
@@ -129,29 +135,62 @@ public:
 	 */
 	CtcExist(Ctc& c, const BitSet& vars, const IntervalVector& y_init, double prec, bool own_ctc=false);
 
+	/**
+	 * \brief Delete this.
+	 */
+	virtual ~CtcExist();
+
 	/**
 	 * \brief Contract a box.
 	 */
 	virtual void contract(IntervalVector& x);
 
+	/**
+	 * \brief Delete the paving of the parameters.
+	 *
+	 * The next call to #contract(IntervalVector&) starts from scratch.
+	 * This is done automatically if #y_init is changed.
+	 */
+	void flush();
+
 private:
+	/**
+	 * A cell of the paving of the parameters.
+	 */
+	class Node;
+
 	/**
 	 * Function call by contract to proceed a pair (x,y).
 	 *
-	 * The overall result x_res is updated, as well as y, and a new pair (x',y') is possibly pushed in the list "l".
+	 * The overall result x_res is updated, as well as the node, and the node is possibly pushed in the list "l".
 	 *
 	 * \param x_init:    the initial box "x" to be contracted
 	 * \param x_current: the current box "x" generated by the branch & bound inside the contract(...) function
 	 * \param x_res:     the current state of the overall result (proj-union). Corresponds, at the end, to the result
 	 *                   of the contraction
-	 * \param y:         the current box "y"
+	 * \param node:      the current cell of "y"
 	 */
-	void proceed(const IntervalVector& x_init, const IntervalVector& x_current, IntervalVector& x_res, IntervalVector& y);
+	void proceed(const IntervalVector& x_init, const Interval* x_current, IntervalVector& x_res, Node* node);
 
 	/**
-	 * Stack of pairs (x,y)
+	 * Create the two sub-cells of a node.
+	 */
+	void bisect(Node* node);
+
+	/**
+	 * Root of the paving (NULL if none).
+	 */
+	Node* root;
+
+	/**
+	 * Stack of nodes. The box x of a node is stored in the node.
+	 */
+	std::stack<Node*> l;
+
+	/*
+	 * Temporary boxes x and y (avoid allocation).
 	 */
-	std::stack<std::pair<IntervalVector,IntervalVector> > l;
+	IntervalVector x, y, y_mid;
 
 };
 
@@ -21,13 +21,15 @@ CtcFixPoint::CtcFixPoint(Ctc& ctc, double ratio) : Ctc(ctc.nb_var), ctc(ctc), ra
 CtcFixPoint::~CtcFixPoint(){
 }
 
-void CtcFixPoint::contract(IntervalVector& box) {
+bool CtcFixPoint::try_contract(IntervalVector& box) {
 
 	IntervalVector old_box(box);
 	do {
 		old_box=box;
-		ctc.contract(box);
+		if (!ctc.try_contract(box)) return false;
 	} while (old_box.rel_distance(box)>ratio);
+
+	return true;
 }
 
 } // end namespace ibex
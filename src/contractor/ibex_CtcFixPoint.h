@@ -37,9 +37,9 @@ public:
 	virtual ~CtcFixPoint();
 
 	/**
-	 * \brief Contract a box.
+	 * \brief Contract a box, without exception.
 	 */
-	virtual void contract(IntervalVector& box);
+	virtual bool try_contract(IntervalVector& box);
 
 	/** The sub-contractor */
 	Ctc& ctc;
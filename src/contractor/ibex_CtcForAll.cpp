@@ -4,91 +4,89 @@
 // Author      : Jordan Ninin, Gilles Chabert
 // License     : See the LICENSE file
 // Created     : Jan 29, 2014
-// Last Update : Jan 29, 2014
+// Last Update : Oct 17, 2026
 //============================================================================
 
 #include "ibex_CtcForAll.h"
 #include <cassert>
+#include <stack>
 
 using namespace std;
 
 namespace ibex {
 
 CtcForAll::CtcForAll(const NumConstraint& ctr,  const ExprSymbol& y1, const IntervalVector& init_box, double prec)
- : CtcQuantif(ctr, Array<const ExprSymbol>(y1), init_box, prec) {
+ : CtcQuantif(ctr, Array<const ExprSymbol>(y1), init_box, prec),
+   y_sampled(IntervalVector::empty(nb_param)), y_mid(nb_param) {
 }
 
 CtcForAll::CtcForAll(const NumConstraint& ctr,  const ExprSymbol& y1, const ExprSymbol& y2, const IntervalVector& init_box, double prec)
- : CtcQuantif(ctr, Array<const ExprSymbol>(y1,y2), init_box, prec) {
+ : CtcQuantif(ctr, Array<const ExprSymbol>(y1,y2), init_box, prec),
+   y_sampled(IntervalVector::empty(nb_param)), y_mid(nb_param) {
 }
 
 CtcForAll::CtcForAll(const NumConstraint& ctr,  const ExprSymbol& y1, const ExprSymbol& y2, const ExprSymbol& y3, const IntervalVector& init_box, double prec)
- : CtcQuantif(ctr, Array<const ExprSymbol>(y1,y2,y3), init_box, prec) {
+ : CtcQuantif(ctr, Array<const ExprSymbol>(y1,y2,y3), init_box, prec),
+   y_sampled(IntervalVector::empty(nb_param)), y_mid(nb_param) {
 }
 
 CtcForAll::CtcForAll(const NumConstraint& ctr,  const ExprSymbol& y1, const ExprSymbol& y2, const ExprSymbol& y3, const ExprSymbol& y4, const IntervalVector& init_box, double prec)
- : CtcQuantif(ctr, Array<const ExprSymbol>(y1,y2,y3,y4), init_box, prec) {
+ : CtcQuantif(ctr, Array<const ExprSymbol>(y1,y2,y3,y4), init_box, prec),
+   y_sampled(IntervalVector::empty(nb_param)), y_mid(nb_param) {
 }
 
 CtcForAll::CtcForAll(const NumConstraint& ctr,  const ExprSymbol& y1, const ExprSymbol& y2, const ExprSymbol& y3, const ExprSymbol& y4, const ExprSymbol& y5, const IntervalVector& init_box, double prec)
- : CtcQuantif(ctr, Array<const ExprSymbol>(y1,y2,y3,y4,y5), init_box, prec) {
+ : CtcQuantif(ctr, Array<const ExprSymbol>(y1,y2,y3,y4,y5), init_box, prec),
+   y_sampled(IntervalVector::empty(nb_param)), y_mid(nb_param) {
 }
 
 CtcForAll::CtcForAll(const NumConstraint& ctr,  const ExprSymbol& y1, const ExprSymbol& y2, const ExprSymbol& y3, const ExprSymbol& y4, const ExprSymbol& y5, const ExprSymbol& y6, const IntervalVector& init_box, double prec)
- : CtcQuantif(ctr, Array<const ExprSymbol>(y1,y2,y3,y4,y5,y6), init_box, prec) {
+ : CtcQuantif(ctr, Array<const ExprSymbol>(y1,y2,y3,y4,y5,y6), init_box, prec),
+   y_sampled(IntervalVector::empty(nb_param)), y_mid(nb_param) {
 }
 
 CtcForAll::CtcForAll(const NumConstraint& ctr,  const ExprSymbol& y1, const ExprSymbol& y2, const ExprSymbol& y3, const ExprSymbol& y4, const ExprSymbol& y5, const ExprSymbol& y6, const ExprSymbol& y7, const IntervalVector& init_box, double prec)
- : CtcQuantif(ctr, Array<const ExprSymbol>(y1,y2,y3,y4,y5,y6,y7), init_box, prec) {
+ : CtcQuantif(ctr, Array<const ExprSymbol>(y1,y2,y3,y4,y5,y6,y7), init_box, prec),
+   y_sampled(IntervalVector::empty(nb_param)), y_mid(nb_param) {
 }
 
 CtcForAll::CtcForAll(const NumConstraint& ctr,  const ExprSymbol& y1, const ExprSymbol& y2, const ExprSymbol& y3, const ExprSymbol& y4, const ExprSymbol& y5, const ExprSymbol& y6, const ExprSymbol& y7, const ExprSymbol& y8, const IntervalVector& init_box, double prec)
- : CtcQuantif(ctr, Array<const ExprSymbol>(y1,y2,y3,y4,y5,y6,y7,y8), init_box, prec) {
+ : CtcQuantif(ctr, Array<const ExprSymbol>(y1,y2,y3,y4,y5,y6,y7,y8), init_box, prec),
+   y_sampled(IntervalVector::empty(nb_param)), y_mid(nb_param) {
 }
 
 CtcForAll::CtcForAll(const NumConstraint& ctr,  const ExprSymbol& y1, const ExprSymbol& y2, const ExprSymbol& y3, const ExprSymbol& y4, const ExprSymbol& y5, const ExprSymbol& y6, const ExprSymbol& y7, const ExprSymbol& y8, const ExprSymbol& y9, const IntervalVector& init_box, double prec)
- : CtcQuantif(ctr, Array<const ExprSymbol>(y1,y2,y3,y4,y5,y6,y7,y8,y9), init_box, prec) {
+ : CtcQuantif(ctr, Array<const ExprSymbol>(y1,y2,y3,y4,y5,y6,y7,y8,y9), init_box, prec),
+   y_sampled(IntervalVector::empty(nb_param)), y_mid(nb_param) {
 }
 
 CtcForAll::CtcForAll(const NumConstraint& ctr,  const ExprSymbol& y1, const ExprSymbol& y2, const ExprSymbol& y3, const ExprSymbol& y4, const ExprSymbol& y5, const ExprSymbol& y6, const ExprSymbol& y7, const ExprSymbol& y8, const ExprSymbol& y9, const ExprSymbol& y10, const IntervalVector& init_box, double prec)
- : CtcQuantif(ctr, Array<const ExprSymbol>(y1,y2,y3,y4,y5,y6,y7,y8,y9,y10), init_box, prec) {
+ : CtcQuantif(ctr, Array<const ExprSymbol>(y1,y2,y3,y4,y5,y6,y7,y8,y9,y10), init_box, prec),
+   y_sampled(IntervalVector::empty(nb_param)), y_mid(nb_param) {
 }
 
 CtcForAll::CtcForAll(const NumConstraint& ctr,  const ExprSymbol& y1, const ExprSymbol& y2, const ExprSymbol& y3, const ExprSymbol& y4, const ExprSymbol& y5, const ExprSymbol& y6, const ExprSymbol& y7, const ExprSymbol& y8, const ExprSymbol& y9, const ExprSymbol& y10, const ExprSymbol& y11, const IntervalVector& init_box, double prec)
- : CtcQuantif(ctr, Array<const ExprSymbol>(y1,y2,y3,y4,y5,y6,y7,y8,y9,y10,y11), init_box, prec) {
+ : CtcQuantif(ctr, Array<const ExprSymbol>(y1,y2,y3,y4,y5,y6,y7,y8,y9,y10,y11), init_box, prec),
+   y_sampled(IntervalVector::empty(nb_param)), y_mid(nb_param) {
 }
 
 CtcForAll::CtcForAll(const NumConstraint& ctr,  const ExprSymbol& y1, const ExprSymbol& y2, const ExprSymbol& y3, const ExprSymbol& y4, const ExprSymbol& y5, const ExprSymbol& y6, const ExprSymbol& y7, const ExprSymbol& y8, const ExprSymbol& y9, const ExprSymbol& y10, const ExprSymbol& y11, const ExprSymbol& y12, const IntervalVector& init_box, double prec)
- : CtcQuantif(ctr, Array<const ExprSymbol>(y1,y2,y3,y4,y5,y6,y7,y8,y9,y10,y11,y12), init_box, prec) {
+ : CtcQuantif(ctr, Array<const ExprSymbol>(y1,y2,y3,y4,y5,y6,y7,y8,y9,y10,y11,y12), init_box, prec),
+   y_sampled(IntervalVector::empty(nb_param)), y_mid(nb_param) {
 }
 
 CtcForAll::CtcForAll(Ctc& ctc, const BitSet& vars, const IntervalVector& init_box, double prec, bool own_ctc) :
-	CtcQuantif(ctc, vars, init_box, prec, own_ctc) {
+	CtcQuantif(ctc, vars, init_box, prec, own_ctc), y_sampled(IntervalVector::empty(nb_param)), y_mid(nb_param) {
 }
 
 CtcForAll::CtcForAll(const NumConstraint& c, const Array<const ExprSymbol>& y, const IntervalVector& y_init, double prec) :
-	CtcQuantif(c, y, y_init, prec) {
+	CtcQuantif(c, y, y_init, prec), y_sampled(IntervalVector::empty(nb_param)), y_mid(nb_param) {
 }
 
-void CtcForAll::proceed(IntervalVector& x, const IntervalVector& y) {
+void CtcForAll::sample() {
+	samples.clear();
 
-	try {
-		IntervalVector y_mid = y.mid();
-		CtcQuantif::contract(x, y_mid);
-	} catch (EmptyBoxException& e) {
-		while (!l.empty()) l.pop();
-		throw e;
-	}
-
-	if (y.max_diam()>prec) {
-		l.push(y);
-	}
-}
-
-void CtcForAll::contract(IntervalVector& box) {
-	assert(box.size()==Ctc::nb_var);
-
-	assert(l.empty()); // when an exception is thrown by this function, l is flushed.
+	stack<IntervalVector> l;
 
 	l.push(y_init);
 
@@ -99,9 +97,27 @@ void CtcForAll::contract(IntervalVector& box) {
 
 		l.pop();
 
-		// proceed with the two sub-boxes for y
-		proceed(box, cut.first);
-		proceed(box, cut.second);
+		// store the midpoints of the two sub-boxes for y
+		for (int i=0; i<nb_param; i++) samples.push_back(cut.first[i].mid());
+		if (cut.first.max_diam()>prec) l.push(cut.first);
+
+		for (int i=0; i<nb_param; i++) samples.push_back(cut.second[i].mid());
+		if (cut.second.max_diam()>prec) l.push(cut.second);
+	}
+
+	y_sampled = y_init;
+}
+
+void CtcForAll::contract(IntervalVector& box) {
+	assert(box.size()==Ctc::nb_var);
+
+	// the samples are calculated again if the initial
+	// box of the parameters has changed.
+	if (y_sampled.is_empty() || y_sampled!=y_init) sample();
+
+	for (vector<double>::const_iterator it=samples.begin(); it!=samples.end(); ) {
+		for (int i=0; i<nb_param; i++) y_mid[i]=*it++;
+		CtcQuantif::contract(box, y_mid);
 	}
 
 }
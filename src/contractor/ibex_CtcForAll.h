@@ -4,7 +4,7 @@
 // Author      : Jordan Ninin, Gilles Chabert
 // License     : See the LICENSE file
 // Created     : Jan 29, 2014
-// Last Update : Aug 21, 2014
+// Last Update : Oct 17, 2026
 //============================================================================
 
 #ifndef __IBEX_CTC_FORALL_H__
@@ -12,7 +12,7 @@
 
 #include "ibex_CtcQuantif.h"
 
-#include <stack>
+#include <vector>
 
 namespace ibex {
 
@@ -26,6 +26,10 @@ namespace ibex {
  *    y in[y] =>  c(x,y).
  *
  * where y is a vector of "parameters".
+ *
+ * The box is contracted with the midpoints of all the cells obtained by
+ * bisecting [y] up to the precision. These sample points do not depend
+ * on the box: they are calculated once and reused by the next calls.
  */
 class CtcForAll : public CtcQuantif {
 public:
@@ -135,19 +139,26 @@ public:
 
 private:
 	/**
-	 * Function call by contract to proceed a pair (x,y).
-	 *
-	 * The overall result x is updated and, if large enough, y is pushed in the list "l".
+	 * Calculate the sample points of y_init.
 	 *
-	 * \param x:   the current box "x". Corresponds, at the end, to the result of the contraction
-	 * \param y:   the current box "y"
+	 * The order is that of a depth-first bisection of y_init.
+	 */
+	void sample();
+
+	/**
+	 * The box y_init for which the samples have been calculated.
+	 */
+	IntervalVector y_sampled;
+
+	/**
+	 * The sample points (one after the other).
 	 */
-	void proceed(IntervalVector& x, const IntervalVector& y);
+	std::vector<double> samples;
 
 	/**
-	 * Stack of y
+	 * Temporary point (avoid allocation).
 	 */
-	std::stack<IntervalVector> l;
+	IntervalVector y_mid;
 
 };
 
@@ -42,41 +42,41 @@ void int_ctr_domain(Domain& d, CmpOp op) {
 
 } // end anonymous namespace
 
-CtcFwdBwd::CtcFwdBwd(Function& f, const Domain& y, FwdMode mode) : Ctc(f.nb_var()), f(f), d(f.expr().dim), hc4r(mode) {
+CtcFwdBwd::CtcFwdBwd(Function& f, const Domain& y, FwdMode mode) : Ctc(f.nb_var()), f(f), d(f.expr().dim), hc4r(mode,true) {
 	assert(f.expr().dim==y.dim);
 	d = y;
 
 	init();
 }
 
-CtcFwdBwd::CtcFwdBwd(Function& f, const Interval& y, FwdMode mode) : Ctc(f.nb_var()), f(f), d(Dim()), hc4r(mode) {
+CtcFwdBwd::CtcFwdBwd(Function& f, const Interval& y, FwdMode mode) : Ctc(f.nb_var()), f(f), d(Dim()), hc4r(mode,true) {
 	assert(f.expr().dim==d.dim);
 	d.i() = y;
 
 	init();
 }
 
-CtcFwdBwd::CtcFwdBwd(Function& f, const IntervalVector& y, FwdMode mode) : Ctc(f.nb_var()), f(f), d(f.expr().dim), hc4r(mode) {
+CtcFwdBwd::CtcFwdBwd(Function& f, const IntervalVector& y, FwdMode mode) : Ctc(f.nb_var()), f(f), d(f.expr().dim), hc4r(mode,true) {
 	assert(f.expr().dim.is_vector() && f.expr().dim.vec_size()==y.size());
 	d.v() = y;
 
 	init();
 }
 
-CtcFwdBwd::CtcFwdBwd(Function& f, const IntervalMatrix& y, FwdMode mode) : Ctc(f.nb_var()), f(f), d(f.expr().dim), hc4r(mode) {
+CtcFwdBwd::CtcFwdBwd(Function& f, const IntervalMatrix& y, FwdMode mode) : Ctc(f.nb_var()), f(f), d(f.expr().dim), hc4r(mode,true) {
 	assert(f.expr().dim==Dim::matrix(y.nb_rows(),y.nb_cols()));
 	d.m() = y;
 
 	init();
 }
 
-CtcFwdBwd::CtcFwdBwd(Function& f, CmpOp op, FwdMode mode) : Ctc(f.nb_var()), f(f), d(f.expr().dim), hc4r(mode)  {
+CtcFwdBwd::CtcFwdBwd(Function& f, CmpOp op, FwdMode mode) : Ctc(f.nb_var()), f(f), d(f.expr().dim), hc4r(mode,true)  {
 	int_ctr_domain(d,op);
 
 	init();
 }
 
-CtcFwdBwd::CtcFwdBwd(const NumConstraint& ctr, FwdMode mode) : Ctc(ctr.f.nb_var()), f(ctr.f), d(ctr.f.expr().dim), hc4r(mode) {
+CtcFwdBwd::CtcFwdBwd(const NumConstraint& ctr, FwdMode mode) : Ctc(ctr.f.nb_var()), f(ctr.f), d(ctr.f.expr().dim), hc4r(mode,true) {
 	int_ctr_domain(d,ctr.op);
 
 	init();
@@ -100,19 +100,16 @@ void CtcFwdBwd::init() {
 	}
 }
 
-void CtcFwdBwd::contract(IntervalVector& box) {
+bool CtcFwdBwd::try_contract(IntervalVector& box) {
 
 	assert(box.size()==f.nb_var());
 
-	try {
-		if (hc4r.proj(f,d,box)) {
-			set_flag(INACTIVE); // TODO: incorrect in general
-			set_flag(FIXPOINT); // TODO: incorrect if multiple occurrences
-		}
-	} catch (EmptyBoxException& e) {
-		box.set_empty();
-		throw e;
+	if (hc4r.try_proj(f,d,box)) {
+		set_flag(INACTIVE); // TODO: incorrect in general
+		set_flag(FIXPOINT); // TODO: incorrect if multiple occurrences
 	}
+
+	return !box.is_empty();
 }
 
 } // namespace ibex
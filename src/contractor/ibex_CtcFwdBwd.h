@@ -22,6 +22,9 @@ namespace ibex {
  * \ingroup contractor
  * \brief Forward-backward contractor (HC4Revise).
  *
+ * A scalar function is projected on its scalar tape in interval mode
+ * (see #ibex::HC4Revise::HC4Revise(FwdMode,bool,bool)), so the labels
+ * of the function are not updated by the contraction.
  */
 class CtcFwdBwd: public Ctc {
 
@@ -30,7 +33,7 @@ public:
 	 * \brief Build the contractor for "f(x)=0" or "f(x)<=0".
 	 *
 	 * \param op: by default: EQ.
-	 * \param mode see #ibex::HC4Revise::HC4Revise(FwdMode).
+	 * \param mode see #ibex::HC4Revise::HC4Revise(FwdMode,bool,bool).
 	 *
 	 */
 	CtcFwdBwd(Function& f, CmpOp op=EQ, FwdMode mode=INTERVAL_MODE);
@@ -66,9 +69,9 @@ public:
 	~CtcFwdBwd();
 
 	/**
-	 * \brief Contract the box.
+	 * \brief Contract the box, without exception.
 	 */
-	virtual void contract(IntervalVector& box);
+	virtual bool try_contract(IntervalVector& box);
 
 	/*
 	 * \brief Whether this contractor is idempotent (optional)
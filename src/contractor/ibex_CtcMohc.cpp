@@ -89,8 +89,10 @@ bool hc4r_ev(const Function& f, const Domain& y, IntervalVector& x, Interval& z)
 	root &= y;
 
 
-	f.backward<HC4Revise>(HC4Revise(INTERVAL_MODE));
+	HC4Revise hc4r(INTERVAL_MODE);
+	f.backward<HC4Revise>(hc4r);
 
+	if (hc4r.interrupted()) throw EmptyBoxException();
 
 	f.read_arg_domains(x);
 
@@ -6,138 +6,138 @@
 // License     : See the LICENSE file
 // Created     : Ene 8, 2013
 // Last Update : Ene 8, 2013
-//============================================================================
-
-
+//============================================================================
+
+
 #ifndef __IBEX_CTC_MOHC_H__
-#define __IBEX_CTC_MOHC_H__
-
-#include "ibex_CtcPropag.h"
-#include "ibex_ExprSplitOcc.h"
-#include "ibex_NumConstraint.h"
-#include "ibex_HC4Revise.h"
-
-#include <vector>
-#include <list>
-
+#define __IBEX_CTC_MOHC_H__
+
+#include "ibex_CtcPropag.h"
+#include "ibex_ExprSplitOcc.h"
+#include "ibex_NumConstraint.h"
+#include "ibex_HC4Revise.h"
+
+#include <vector>
+#include <list>
+
 using namespace std;
-
-
+
+
 namespace ibex {
-
-class CtcMohcRevise;
-
+
+class CtcMohcRevise;
+
 /**
  * \brief Occurrence Grouping algorithm.
  *
- * This class is an implementation of the <i>Occurrence Grouping</i> algorithm used mainly by
+ * This class is an implementation of the <i>Occurrence Grouping</i> algorithm used mainly by
  * the Mohc algorithm (see \link CtcMohc \endlink).
  * See description in <a href="http://www-sop.inria.fr/coprin/trombe/publis/og_computing_2011.pdf">[ara12]</a>.
- *
- * The following code shows how to perform the evaluation of a function f in a box.
- * ...
- * Function_OG fog(f);
- * fog.occurrence_grouping(box); //calling only once to this function, every evaluation we perform inside the box is valid
- * fog.eval(box);
+ *
+ * The following code shows how to perform the evaluation of a function f in a box.
+ * ...
+ * Function_OG fog(f);
+ * fog.occurrence_grouping(box); //calling only once to this function, every evaluation we perform inside the box is valid
+ * fog.eval(box);
  * ...
  * \author Ignacio Araya, Bertrand Neveu, Gilles Trombettoni
  * \date September 2010
  */
-class Function_OG {
-	friend class CtcMohcRevise;
-
-public:
-
-	/**
-	 * \brief Function_OG constructor
-	 *
+class Function_OG {
+	friend class CtcMohcRevise;
+
+public:
+
+	/**
+	 * \brief Function_OG constructor
+	 *
 	 * Creates an object Function_OG which takes the function f and constructs a new function fog in which each occurrence j of a variable x in f has been replaced by a sum r_a[j]*xa + r_b[j]*xb + r_c[j]*xc
 	 * \param f The original function
-	 */
-	Function_OG(const Function& f);
-
-	/**
-	 * \brief The Occurrence Grouping algorithm
-	 *
-	 * See description in <a href="http://www-sop.inria.fr/coprin/trombe/publis/og_computing_2011.pdf">[ara12]</a>.
+	 */
+	Function_OG(const Function& f);
+
+	/**
+	 * \brief The Occurrence Grouping algorithm
+	 *
+	 * See description in <a href="http://www-sop.inria.fr/coprin/trombe/publis/og_computing_2011.pdf">[ara12]</a>.
 	 * Performs the Occurrence Grouping algorithm.
-	 * \param box The box
-	 * \param y_set if it is true it indicates that the variables occuring once also should be grouped (by default it is false)
+	 * \param box The box
+	 * \param y_set if it is true it indicates that the variables occuring once also should be grouped (by default it is false)
 	 * \param _og <i>only for analysis purposes</i>
-	 */
-	bool occurrence_grouping(IntervalVector& box, bool y_set=false, bool _og=true);
-
-	/** performs an evaluation of the function using the grouping previously performed by #occurrence_grouping(IntervalVector& , bool, bool)**/
-	Interval eval(IntervalVector& box);
-
-	/** performs an evaluation of the lower/upper bound of the function using the grouping previously performed by #occurrence_grouping(IntervalVector& , bool, bool)
-	 * \param box The box
-	 * \param minrevise if it is true, it performs an evaluation of the lower bound of the box, otherwise, an evaluation of the upper bound is performed
-	 */
-	Interval eval(IntervalVector& box, bool minrevise);
-
-	/** performs a call to the MinRevise/MaxRevise algorithm using fog (see \link CtcHC4Revise \endlink, \link CtcMohc \endlink, <a href="http://www-sop.inria.fr/coprin/trombe/publis/mohc_aaai_2010.pdf">[ara10]</a>)**/
-	Interval revise(IntervalVector& box, bool minrevise);
-
-
-private:
-
-	void set_ra(int i, Interval val);
-	void set_rb(int i, Interval val);
-	void set_rc(int i, Interval val);
-
-	bool gradient(IntervalVector& box);
-
-	bool occurrence_grouping(int i, bool _og);
-
-	void _eval_leaves(IntervalVector& box, bool minrevise);
-	void _proj_leaves(IntervalVector& box);
-
-	//initialize the occurrence-based box using a normal box variable-based
-	void _setbox(IntervalVector& box);
-
-	void OG_case1(int i);
-	void OG_case2(int i, Interval inf_G_Xa, Interval inf_G_Xb, Interval sup_G_Xa, Interval sup_G_Xb);
-	void OG_case3(list<int>& X_m, list<int>& X_nm, Interval& G_m);
-
+	 */
+	bool occurrence_grouping(IntervalVector& box, bool y_set=false, bool _og=true);
+
+	/** performs an evaluation of the function using the grouping previously performed by #occurrence_grouping(IntervalVector& , bool, bool)**/
+	Interval eval(IntervalVector& box);
+
+	/** performs an evaluation of the lower/upper bound of the function using the grouping previously performed by #occurrence_grouping(IntervalVector& , bool, bool)
+	 * \param box The box
+	 * \param minrevise if it is true, it performs an evaluation of the lower bound of the box, otherwise, an evaluation of the upper bound is performed
+	 */
+	Interval eval(IntervalVector& box, bool minrevise);
+
+	/** performs a call to the MinRevise/MaxRevise algorithm using fog (see \link CtcHC4Revise \endlink, \link CtcMohc \endlink, <a href="http://www-sop.inria.fr/coprin/trombe/publis/mohc_aaai_2010.pdf">[ara10]</a>)**/
+	Interval revise(IntervalVector& box, bool minrevise);
+
+
+private:
+
+	void set_ra(int i, Interval val);
+	void set_rb(int i, Interval val);
+	void set_rc(int i, Interval val);
+
+	bool gradient(IntervalVector& box);
+
+	bool occurrence_grouping(int i, bool _og);
+
+	void _eval_leaves(IntervalVector& box, bool minrevise);
+	void _proj_leaves(IntervalVector& box);
+
+	//initialize the occurrence-based box using a normal box variable-based
+	void _setbox(IntervalVector& box);
+
+	void OG_case1(int i);
+	void OG_case2(int i, Interval inf_G_Xa, Interval inf_G_Xb, Interval sup_G_Xa, Interval sup_G_Xb);
+	void OG_case3(list<int>& X_m, list<int>& X_nm, Interval& G_m);
+
 	ExprSplitOcc eso;
 	Function _f;
 
-	IntervalVector r_a;
-	IntervalVector r_b;
-	IntervalVector r_c;
-
+	IntervalVector r_a;
+	IntervalVector r_b;
+	IntervalVector r_c;
+
 	/* maps from var i, occ j -> to var in fog.
 	 * furthermore occ[i].size() is the number of occurrences of var i */
 	vector<int>* occ;
-
-	IntervalVector _box;
-
-	/* partial derivatives w.r.t. each occurrence */
-	IntervalVector _g;
-
-	/*partial derivatives w.r.t. the original variables*/
-	IntervalVector g;
-
-	/*partial derivatives w.r.t. x_a*/
-	IntervalVector ga;
-
-	/*partial derivatives w.r.t. x_b*/
-	IntervalVector gb;
-
-	/*used for performing minrevise (resp. maxrevise),
-	 * it saves the constant: r_a * lb(xk) + r_b * ub(xk) for each occurrence xk */
-	IntervalVector aux;
-
-	/*** methods only used by \link CtcMohcRevise \endlink***/
-	Interval Newton_it(Interval b, double x_m, double f_m, int i);
-	Interval Newton_it(Interval b, double x_m, double f_m, int i, bool increasing);
-	Interval Newton_it_cert(Interval b, double x_m, double f_m, int i);
-	void MonoUnivNewton(IntervalVector& box, int i, Interval& b, bool minEval, double w, double min_width);
-	/**********************************************************/
-
-};
-
+
+	IntervalVector _box;
+
+	/* partial derivatives w.r.t. each occurrence */
+	IntervalVector _g;
+
+	/*partial derivatives w.r.t. the original variables*/
+	IntervalVector g;
+
+	/*partial derivatives w.r.t. x_a*/
+	IntervalVector ga;
+
+	/*partial derivatives w.r.t. x_b*/
+	IntervalVector gb;
+
+	/*used for performing minrevise (resp. maxrevise),
+	 * it saves the constant: r_a * lb(xk) + r_b * ub(xk) for each occurrence xk */
+	IntervalVector aux;
+
+	/*** methods only used by \link CtcMohcRevise \endlink***/
+	Interval Newton_it(Interval b, double x_m, double f_m, int i);
+	Interval Newton_it(Interval b, double x_m, double f_m, int i, bool increasing);
+	Interval Newton_it_cert(Interval b, double x_m, double f_m, int i);
+	void MonoUnivNewton(IntervalVector& box, int i, Interval& b, bool minEval, double w, double min_width);
+	/**********************************************************/
+
+};
+
 /** \ingroup contractor
  * \brief MohcRevise algorithm.
  *
@@ -146,13 +146,13 @@ private:
  *
  * \author Ignacio Araya, Bertrand Neveu, Gilles Trombettoni
  * \date September 2010
- */
-class CtcMohcRevise : public Ctc {
-
-public:
-	/**
-	 * \brief Mohc-Revise constructor
-	 *
+ */
+class CtcMohcRevise : public Ctc {
+
+public:
+	/**
+	 * \brief Mohc-Revise constructor
+	 *
 	 * Creates the Mohc-Revise contractor for handling/revising a single constraint.
 	 * \param ctr The constraint
 	 * \param epsilon Precision ratio (percentage of interval width) to rather set between 0.01 and 0.1. See class \link CtcMohc \endlink.
@@ -160,36 +160,36 @@ public:
 	 * \param tau_mohc Ratio to rather set between 0.5 and 0.9999. See class \link CtcMohc \endlink.
 	 * \param amohc If it is true, the value of tau_mohc is tuned automatically (the value given to \a tau_mohc is not taken into account). See class \link CtcMohc \endlink.
 	 */
-	CtcMohcRevise(const NumConstraint& ctr, double epsilon, double univ_newton_min_width,
+	CtcMohcRevise(const NumConstraint& ctr, double epsilon, double univ_newton_min_width,
 			double tau_mohc, bool amohc);
 
 	/** Contract the box using <i>Mohc-Revise</i> in the constraint \a ctr_mohc. */
 	virtual void contract(IntervalVector& box);
 
 	/** The constraint. */
-	const NumConstraint ctr;
-
-	/** The og function. */
+	const NumConstraint ctr;
+
+	/** The og function. */
 	Function_OG fog;
-
+
 	/** Perform \a LazyNarrow*/
 	void LazyNarrow();
 
 	/** Perform \a MonotonicBoxNarrow*/
 	void MonoBoxNarrow();
 
-	/**
+	/**
 	 * Perform \a MonotonicBoxNarrow to the i-th variable of \a ctr_mohc
 	 * \param x The interval been contracted
 	 */
 	void MonoBoxNarrow(int i);
-
+
 	/** The value related with the activation of the monotonic procedures.
 	 * If active_mono_proc is 1, we should perform the monotonic procedures.
 	 * If active_mono_proc is 0, we should not perform them.
-	 * active_mono_proc = -1 indicates that the activation should be initialized (by the private method update_active_mono_proc(..)). */
-	int active_mono_proc;
-
+	 * active_mono_proc = -1 indicates that the activation should be initialized (by the private method update_active_mono_proc(..)). */
+	int active_mono_proc;
+
 
 	//   static double tau_mono;
 
@@ -200,9 +200,9 @@ public:
 	static bool _og;
 	static bool _mohc2;
 	/**********************************************************************/
-
-
-
+
+
+
 private:
 
 	/* For contracting partially monotonic variables (generated by OG) */
@@ -225,32 +225,32 @@ private:
 	void initialize_apply();
 	void apply_fmax_to_false_except(int i);
 	void apply_fmin_to_false_except(int i);
-
-	bool hasMultOcc(Function &f);
-	bool _existence_test(int i);
-
-	void update_active_mono_proc(Interval& z);
-
+
+	bool hasMultOcc(Function &f);
+	bool _existence_test(int i);
+
+	void update_active_mono_proc(Interval& z);
+
 	enum _3vl {MAYBE,YES,NO};
 	_3vl* ApplyFmin;
 	_3vl* ApplyFmax;
 
 	//Arrays used for saving the lower and upper bounds of the variables
 	//in the monotonicboxnarrow procedure. At the end of the procedure x[i] <- Interval( Inf(LB[i]), Sup(RB[i]) )
-	IntervalVector LB;
+	IntervalVector LB;
 	IntervalVector RB;
-
-	Interval zmin,zmax;
+
+	Interval zmin,zmax;
 	IntervalVector box;
-
+
 	double tau_mohc;
 	double epsilon;
 	double univ_newton_min_width;
 	bool amohc;
-
-
-};
-
+
+
+};
+
 /** \ingroup ctcgroup
  * \brief Mohc algorithm
  *
@@ -262,14 +262,14 @@ private:
  * #include "ibex_CtcCompo.h"
  * #include "ibex_Ctc3BCid.h"
  * ...
- * CtcMohc mohc(csp); //performs the preprocessing and first call to mohc in the current box
+ * CtcMohc mohc(csp); //performs the preprocessing and first call to mohc in the current box
  * CtcMohc mohc_in_shav(csp, mohc->active_mono_proc); //the mohc algorithm which is used inside the shaving
  * CtcCompo shav_mohc(mohc,Ctc3BCid(mohc_in_shav));
  * ...
  * \endcode
  * \author Ignacio Araya, Bertrand Neveu, Gilles Trombettoni
  * \date September 2010
- */
+ */
 
 class CtcMohc : public CtcPropag {
 public:
@@ -302,7 +302,7 @@ public:
 	 * #include "ibex_CtcCompo.h"
 	 * #include "ibex_Ctc3BCid.h"
 	 * ...
-	 * CtcMohc mohc(csp); //performs the preprocessing and first call to mohc in the current box
+	 * CtcMohc mohc(csp); //performs the preprocessing and first call to mohc in the current box
 	 * CtcMohc mohc_in_shav(csp, mohc->active_mono_proc); //the mohc algorithm which is used inside the shaving
 	 * CtcCompo shav_mohc(mohc,Ctc3BCid(mohc_in_shav));
 	 * ...
@@ -310,7 +310,7 @@ public:
 	 * In this example, we have created a contractor that calls Mohc and then 3BCid(Mohc) (see \a Ctc3BCid). Each time the contractor is called,
 	 * the first instance of Mohc (mohc) will fill the active_mono_proc array that will be used then by the second
 	 * instance of mohc (mohc_in_shav).
-	 * \param csp The set of constraints.
+	 * \param csp The set of constraints.
 	 * \param active_mono_proc The array that Mohc will use (and will not update) to decide if the monotonic based procedures will be applied in MochRevise:
 	 * If active_mono_proc[f] is 1, MohcRevise performs the monotonic procedures on f.
 	 * If active_mono_proc[f] is 0, MohcRevise does not perform them.
@@ -323,24 +323,24 @@ public:
 
 	CtcMohc(const Array<NumConstraint>& csp, int* active_mono_proc, double ratio=default_ratio, bool incremental=false,  double epsilon=default_epsilon,
 			double univ_newton_min_width=default_univ_newton_min_width);
-
-	~CtcMohc();
+
+	~CtcMohc();
 
 	static const double ADAPTIVE;
-
-	/** Contract the box using <i>Mohc</i> in the set of constraints \a csp. */
-	virtual void contract(IntervalVector& box){
-
-		//initialization of the value active_mono_proc for each constraint
-		//if the first contractor was used, the values are set to -1
-		//(they are computed by the method CtcMohcRevise::update_active_mono_proc)
+
+	/** Contract the box using <i>Mohc</i> in the set of constraints \a csp, without exception. */
+	virtual bool try_contract(IntervalVector& box){
+
+		//initialization of the value active_mono_proc for each constraint
+		//if the first contractor was used, the values are set to -1
+		//(they are computed by the method CtcMohcRevise::update_active_mono_proc)
 		//otherwise, they are copied from the array active_mono_proc
 		for(int i=0;i<list.size();i++){
 			CtcMohcRevise* ctc= dynamic_cast<CtcMohcRevise*>(&list[i]);
 			ctc->active_mono_proc=(update_active_mono_proc)? -1:active_mono_proc[i];
 		}
 
-		CtcPropag::contract(box);
+		if (!CtcPropag::try_contract(box)) return false;
 
 		//the array active_mono_proc is updated
 		for(int i=0;i<list.size();i++){
@@ -348,6 +348,7 @@ public:
 			active_mono_proc[i]=ctc->active_mono_proc;
 		}
 
+		return true;
 	}
 
 	/** Default \a tau_mohc value, set to 0.5  **/
@@ -385,6 +386,6 @@ private:
 	 * is revised, its related value active_mono_proc[f] is updated.*/
 	bool update_active_mono_proc;
 
-};
-}
-#endif
+};
+}
+#endif
@@ -22,7 +22,7 @@ namespace ibex {
    CtcOptimShaving(Ctc& ctc, int s3b=default_s3b, int scid=default_scid,
 			int vhandled=-1, double var_min_width=default_var_min_width);
 			
-   virtual void contract(IntervalVector& box);
+   virtual bool try_contract(IntervalVector& box);
 	static const int LimitCIDDichotomy;
   protected:
 	virtual	bool var3BCID_dicho(IntervalVector& box, int var, double wv);
@@ -10,14 +10,204 @@
 
 #include "ibex_CtcPolytopeHull.h"
 #include "ibex_LinearRelaxFixed.h"
+#include "ibex_Thread.h"
+
+#include <vector>
 
 using namespace std;
 
 namespace ibex {
 
+#ifndef  _IBEX_WITH_NOLP_
+
+class LPThread;
+
+/*
+ * The threads solving the LPs of a CtcPolytopeHull in parallel.
+ *
+ * At each contraction (a "round"), the threads load the linear
+ * relaxation built by the contractor in their own solver and
+ * take the LPs one by one until there is no LP left (the thread
+ * of the contractor works too, with the solver of the contractor).
+ */
+class LPPool {
+public:
+	LPPool(CtcPolytopeHull& ctc, int nb_threads);
+
+	/* Stop and join the threads */
+	~LPPool();
+
+	/* Solve all the LPs w.r.t. the relaxation Ax in B */
+	void solve(const IntervalVector& box, const Matrix& A, const IntervalVector& B);
+
+	/* Solve the LPs left with lp */
+	void work(LinearSolver& lp);
+
+	CtcPolytopeHull& ctc;
+
+	/* The LPs: the kth LP minimizes (MINIMIZE) or maximizes x_var[k] */
+	vector<int> var;
+	vector<LinearSolver::Sense> sense;
+
+	/* The results of the LPs */
+	vector<LinearSolver::Status_Sol> stat;
+	vector<Interval> opt;
+
+	/* The data of the current round */
+	IntervalVector box;
+	const Matrix* A;
+	const IntervalVector* B;
+
+	/* Index of the next LP to be solved (incremented atomically) */
+	volatile int next;
+
+	/* Set when the remaining LPs are useless (infeasibility found) */
+	volatile bool stop;
+
+	Mutex mutex;
+	Condition cond;
+	int round;      // number of the current round
+	int nb_running; // number of threads working on the current round
+	bool quit;
+
+	vector<LPThread*> threads;
+};
+
+class LPThread : public Thread {
+public:
+	/* The thread owns lp */
+	LPThread(LPPool& pool, LinearSolver* lp) : pool(pool), lp(*lp) { }
+
+	~LPThread() { delete &lp; }
+
+protected:
+	void run();
+
+private:
+	/* Load the relaxation of the current round in lp */
+	bool load();
+
+	LPPool& pool;
+	LinearSolver& lp;
+};
+
+bool LPThread::load() {
+	try {
+		lp.cleanConst();
+		lp.initBoundVar(pool.box);
+		const Matrix& A=*pool.A;
+		const IntervalVector& B=*pool.B;
+		for (int i=pool.ctc.nb_var; i<A.nb_rows(); i++) {
+			Vector row=A.row(i);
+			// the rows of a relaxation are one-sided (see LinearSolver::addConstraint)
+			if (B[i].lb()<=-LinearSolver::default_max_bound)
+				lp.addConstraint(row,LEQ,B[i].ub());
+			else
+				lp.addConstraint(row,GEQ,B[i].lb());
+		}
+		return true;
+	} catch(LPException&) {
+		return false;
+	}
+}
+
+void LPThread::run() {
+	int my_round=0;
+	while (true) {
+		{
+			Lock lock(pool.mutex);
+			while (pool.round==my_round && !pool.quit)
+				pool.cond.wait(pool.mutex);
+			if (pool.quit) return;
+			my_round=pool.round;
+		}
+
+		if (load()) pool.work(lp);
+
+		Lock lock(pool.mutex);
+		if (--pool.nb_running==0) pool.cond.broadcast();
+	}
+}
+
+LPPool::LPPool(CtcPolytopeHull& ctc, int nb_threads) : ctc(ctc), box(ctc.nb_var), A(NULL), B(NULL),
+		next(0), stop(false), round(0), nb_running(0), quit(false) {
+
+	for (int i=0; i<ctc.nb_var; i++) {
+		// in the case of lower_bounding, only the left bound of y is contracted
+		if (ctc.cmode==CtcPolytopeHull::ONLY_Y && i!=ctc.goal_var) continue;
+
+		var.push_back(i);
+		sense.push_back(LinearSolver::MINIMIZE);
+
+		// in case of optimization, the right bound of y is not contracted
+		if (ctc.cmode==CtcPolytopeHull::ALL_BOX && i!=ctc.goal_var) {
+			var.push_back(i);
+			sense.push_back(LinearSolver::MAXIMIZE);
+		}
+	}
+
+	stat.resize(var.size());
+	opt.resize(var.size());
+
+	for (int i=1; i<nb_threads; i++) {
+		threads.push_back(new LPThread(*this, new LinearSolver(ctc.nb_var, ctc.lr.nb_ctr(), ctc.max_iter, ctc.time_out, ctc.eps)));
+		threads.back()->start();
+	}
+}
+
+LPPool::~LPPool() {
+	{
+		Lock lock(mutex);
+		quit=true;
+		cond.broadcast();
+	}
+	for (vector<LPThread*>::iterator it=threads.begin(); it!=threads.end(); it++) {
+		(*it)->join();
+		delete *it;
+	}
+}
+
+void LPPool::solve(const IntervalVector& box, const Matrix& A, const IntervalVector& B) {
+	{
+		Lock lock(mutex);
+		this->box=box;
+		this->A=&A;
+		this->B=&B;
+		next=0;
+		stop=false;
+		nb_running=threads.size();
+		round++;
+		cond.broadcast();
+	}
+
+	work(*ctc.mylinearsolver);
+
+	Lock lock(mutex);
+	while (nb_running>0)
+		cond.wait(mutex);
+}
+
+void LPPool::work(LinearSolver& lp) {
+	int k;
+	while (!stop && (k=__sync_fetch_and_add(&next,1))<(int) var.size()) {
+		double bound=sense[k]==LinearSolver::MINIMIZE? box[var[k]].lb() : box[var[k]].ub();
+		stat[k]=ctc.run_simplex(lp, box, sense[k], var[k], opt[k], bound);
+		// the other LPs are infeasible too
+		if (stat[k]==LinearSolver::INFEASIBLE || stat[k]==LinearSolver::INFEASIBLE_NOTPROVED)
+			stop=true;
+	}
+}
+
+#else
+
+class LPPool { };
+
+#endif /// end _IBEX_WITH_NOLP_
+
 CtcPolytopeHull::CtcPolytopeHull(LinearRelax& lr, ctc_mode cmode, int max_iter, int time_out, double eps, Interval limit_diam) :
 		Ctc(lr.nb_var()), lr(lr), goal_var(lr.goal_var()), cmode(cmode),
-		limit_diam_box(eps>limit_diam.lb()? eps : limit_diam.lb(), limit_diam.ub()), own_lr(false) {
+		limit_diam_box(eps>limit_diam.lb()? eps : limit_diam.lb(), limit_diam.ub()), own_lr(false),
+		max_iter(max_iter), time_out(time_out), eps(eps), pool(NULL) {
 
 	 mylinearsolver = new LinearSolver(nb_var, lr.nb_ctr(), max_iter, time_out, eps);
 
@@ -25,19 +215,26 @@ CtcPolytopeHull::CtcPolytopeHull(LinearRelax& lr, ctc_mode cmode, int max_iter,
 
 CtcPolytopeHull::CtcPolytopeHull(const Matrix& A, const Vector& b, int max_iter, int time_out, double eps, Interval limit_diam) :
 		Ctc(A.nb_cols()), lr(*new LinearRelaxFixed(A,b)), goal_var(lr.goal_var()), cmode(ALL_BOX),
-		limit_diam_box(eps>limit_diam.lb()? eps : limit_diam.lb(), limit_diam.ub()), own_lr(true) {
+		limit_diam_box(eps>limit_diam.lb()? eps : limit_diam.lb(), limit_diam.ub()), own_lr(true),
+		max_iter(max_iter), time_out(time_out), eps(eps), pool(NULL) {
 
 	 mylinearsolver = new LinearSolver(nb_var, lr.nb_ctr(), max_iter, time_out, eps);
 
 }
 
 CtcPolytopeHull::~CtcPolytopeHull() {
+	if (pool!=NULL) delete pool;
 	if (mylinearsolver!=NULL) delete mylinearsolver;
 	if (own_lr) delete &lr;
 }
 
 #ifndef  _IBEX_WITH_NOLP_
 
+void CtcPolytopeHull::set_nb_threads(int nb_threads) {
+	if (pool!=NULL) delete pool;
+	pool = nb_threads>1? new LPPool(*this,nb_threads) : NULL;
+}
+
 void CtcPolytopeHull::contract(IntervalVector& box) {
 
 	if (!(limit_diam_box.contains(box.max_diam()))) return;
@@ -53,7 +250,8 @@ void CtcPolytopeHull::contract(IntervalVector& box) {
 		//cout << "[polytope-hull] end of LR" << endl;
 		if(cont<1)  return;
 
-		optimizer(box);
+		if (pool) parallel_optimizer(box);
+		else optimizer(box);
 
 		//mylinearsolver->writeFile("LP.lp");
 		//system ("cat LP.lp");
@@ -104,7 +302,7 @@ void CtcPolytopeHull::optimizer(IntervalVector& box) {
 		if (infnexti==0 && inf_bound[i]==0)  // computing the left bound : minimizing x_i
 		{
 			inf_bound[i]=1;
-			stat = run_simplex(box, LinearSolver::MINIMIZE, i, opt,box[i].lb());
+			stat = run_simplex(*mylinearsolver, box, LinearSolver::MINIMIZE, i, opt,box[i].lb());
 			//cout << "[polytope-hull]->[optimize] simplex for left bound returns stat:" << stat <<  " opt: " << opt << endl;
 			if (stat == LinearSolver::OPTIMAL) {
 				if(opt.lb()>box[i].ub()) {
@@ -152,7 +350,7 @@ void CtcPolytopeHull::optimizer(IntervalVector& box) {
 		}
 		else if (infnexti==1 && sup_bound[i]==0) { // computing the right bound :  maximizing x_i
 			sup_bound[i]=1;
-			stat= run_simplex(box, LinearSolver::MAXIMIZE, i, opt, box[i].ub());
+			stat= run_simplex(*mylinearsolver, box, LinearSolver::MAXIMIZE, i, opt, box[i].ub());
 			//cout << "[polytope-hull]->[optimize] simplex for right bound returns stat=" << stat << " opt=" << opt << endl;
 			if( stat == LinearSolver::OPTIMAL) {
 				if(opt.ub() <box[i].lb()) {
@@ -204,26 +402,64 @@ void CtcPolytopeHull::optimizer(IntervalVector& box) {
 
 }
 
-LinearSolver::Status_Sol CtcPolytopeHull::run_simplex(IntervalVector& box, LinearSolver::Sense sense, int var, Interval& obj, double bound) {
+void CtcPolytopeHull::parallel_optimizer(IntervalVector& box) {
+
+	// the relaxation, shared by the threads
+	Matrix A(mylinearsolver->getNbRows(),nb_var);
+	IntervalVector B(mylinearsolver->getNbRows());
+	try {
+		mylinearsolver->getCoefConstraint(A);
+		mylinearsolver->getB(B);
+	} catch(LPException&) {
+		return;
+	}
+
+	pool->solve(box,A,B);
+
+	// merge the bounds
+	for (unsigned int k=0; k<pool->var.size(); k++) {
+		int i=pool->var[k];
+		const Interval& opt=pool->opt[k];
+
+		switch (pool->stat[k]) {
+		case LinearSolver::INFEASIBLE:
+			// the infeasibility is proved, the EmptyBox exception is raised
+			throw EmptyBoxException();
+		case LinearSolver::OPTIMAL:
+			if (pool->sense[k]==LinearSolver::MINIMIZE) {
+				if (opt.lb()>box[i].ub()) throw EmptyBoxException();
+				if (opt.lb()>box[i].lb()) box[i]=Interval(opt.lb(),box[i].ub());
+			} else {
+				if (opt.ub()<box[i].lb()) throw EmptyBoxException();
+				if (opt.ub()<box[i].ub()) box[i]=Interval(box[i].lb(),opt.ub());
+			}
+			break;
+		default:
+			break;
+		}
+	}
+}
+
+LinearSolver::Status_Sol CtcPolytopeHull::run_simplex(LinearSolver& lp, IntervalVector& box, LinearSolver::Sense sense, int var, Interval& obj, double bound) {
 
 	int nvar=nb_var;
-	int nctr=mylinearsolver->getNbRows();
+	int nctr=lp.getNbRows();
 	// the linear solver is always called in a minimization mode : in case of maximization of var , the opposite of var is minimized
 	if(sense==LinearSolver::MINIMIZE)
-		mylinearsolver->setVarObj(var, 1.0);
+		lp.setVarObj(var, 1.0);
 	else
-		mylinearsolver->setVarObj(var, -1.0);
+		lp.setVarObj(var, -1.0);
 
 	LinearSolver::Status_Sol stat = LinearSolver::UNKNOWN;
 	try {
-		//	mylinearsolver->writeFile("coucou.lp");
+		//	lp.writeFile("coucou.lp");
 		//	system("cat coucou.lp");
-		stat = mylinearsolver->solve();
+		stat = lp.solve();
 		//cout << "[polytope-hull]->[run_simplex] solver returns " << stat << endl;
 
 		if(stat == LinearSolver::OPTIMAL) {
-			if( ((sense==LinearSolver::MINIMIZE) && (  mylinearsolver->getObjValue() <=bound)) ||
-					((sense==LinearSolver::MAXIMIZE) && ((-mylinearsolver->getObjValue())>=bound))) {
+			if( ((sense==LinearSolver::MINIMIZE) && (  lp.getObjValue() <=bound)) ||
+					((sense==LinearSolver::MAXIMIZE) && ((-lp.getObjValue())>=bound))) {
 				stat = LinearSolver::UNKNOWN;
 			}
 		}
@@ -232,41 +468,41 @@ LinearSolver::Status_Sol CtcPolytopeHull::run_simplex(IntervalVector& box, Linea
 		if(stat == LinearSolver::OPTIMAL) {
 
 			// the dual solution : used to compute the bound
-			Vector dual_solution(mylinearsolver->getNbRows());
-			mylinearsolver->getDualSol(dual_solution);
+			Vector dual_solution(lp.getNbRows());
+			lp.getDualSol(dual_solution);
 
-			Matrix A_trans (nb_var,mylinearsolver->getNbRows()) ;
-			mylinearsolver->getCoefConstraint_trans(A_trans);
+			Matrix A_trans (nb_var,lp.getNbRows()) ;
+			lp.getCoefConstraint_trans(A_trans);
 
-			/*	IntervalMatrix IA_trans (nb_var,mylinearsolver->getNbRows());
+			/*	IntervalMatrix IA_trans (nb_var,lp.getNbRows());
 			for (int i=0;i<nvar; i++){
 			  for(int j=0; j<nctr; j++)
 				IA_trans[i][j]= A_trans[i][j];
 			}*/
-			IntervalVector B(mylinearsolver->getNbRows());
-			mylinearsolver->getB(B);
+			IntervalVector B(lp.getNbRows());
+			lp.getB(B);
 
 			bool minimization=false;
 			if (sense==LinearSolver::MINIMIZE)	minimization=true;
 
 			//	  cout << "B " << B << endl;
 			//	  cout << "A_trans " << IA_trans << endl;
-			NeumaierShcherbina_postprocessing( mylinearsolver->getNbRows(), var, obj, box, A_trans, B, dual_solution, minimization);
+			NeumaierShcherbina_postprocessing( lp.getNbRows(), var, obj, box, A_trans, B, dual_solution, minimization);
 		}
 
 		// infeasibility test  cf Neumaier Shcherbina paper
 		if(stat == LinearSolver::INFEASIBLE_NOTPROVED) {
 
-			Vector infeasible_dir(mylinearsolver->getNbRows());
-			mylinearsolver->getInfeasibleDir(infeasible_dir);
+			Vector infeasible_dir(lp.getNbRows());
+			lp.getInfeasibleDir(infeasible_dir);
 
-			Matrix A_trans (nb_var,mylinearsolver->getNbRows()) ;
-			mylinearsolver->getCoefConstraint_trans(A_trans);
+			Matrix A_trans (nb_var,lp.getNbRows()) ;
+			lp.getCoefConstraint_trans(A_trans);
 
-			IntervalVector B(mylinearsolver->getNbRows());
-			mylinearsolver->getB(B);
+			IntervalVector B(lp.getNbRows());
+			lp.getB(B);
 
-			if (NeumaierShcherbina_infeasibilitytest (mylinearsolver->getNbRows(), box, A_trans, B, infeasible_dir)) {
+			if (NeumaierShcherbina_infeasibilitytest (lp.getNbRows(), box, A_trans, B, infeasible_dir)) {
 				stat = LinearSolver::INFEASIBLE;
 			}
 		}
@@ -275,7 +511,7 @@ LinearSolver::Status_Sol CtcPolytopeHull::run_simplex(IntervalVector& box, Linea
 		stat = LinearSolver::UNKNOWN;
 	}
 	// Reset the objective of the LP solver
-	mylinearsolver->setVarObj(var, 0.0);
+	lp.setVarObj(var, 0.0);
 
 	return stat;
 
@@ -401,6 +637,8 @@ bool CtcPolytopeHull::choose_next_variable(IntervalVector & box, int & nexti, in
 
 void CtcPolytopeHull::contract(IntervalVector& box) { }
 
+void CtcPolytopeHull::set_nb_threads(int nb_threads) { }
+
 
 #endif /// end _IBEX_WITH_NOLP_
 
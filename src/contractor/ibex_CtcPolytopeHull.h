@@ -17,6 +17,8 @@
 
 namespace ibex {
 
+class LPPool;
+
 /**
  * \brief Contract the bounds of a box with respect to a polytope.
  *
@@ -64,6 +66,21 @@ public:
 
 	virtual void contract(IntervalVector& box);
 
+	/**
+	 * \brief Solve the LPs with several threads.
+	 *
+	 * The 2n LPs (the lower and upper bound of each variable) are
+	 * independent once the linear relaxation is built: they are then dealt
+	 * to \a nb_threads threads (including the calling one), each with its
+	 * own linear solver loaded with the same constraints. The bounds are
+	 * all calculated w.r.t. the initial box and merged at the end (the
+	 * Achterberg heuristic of the sequential mode that skips some LPs is
+	 * not applied).
+	 *
+	 * With nb_threads=1 (the default), the LPs are solved one after the other.
+	 */
+	void set_nb_threads(int nb_threads);
+
 	virtual ~CtcPolytopeHull();
 
 protected:
@@ -87,13 +104,18 @@ protected:
 	/**
 	 * Call to linear solver
 	 */
-	LinearSolver::Status_Sol run_simplex(IntervalVector &box, LinearSolver::Sense sense, int var, Interval & obj, double bound);
+	LinearSolver::Status_Sol run_simplex(LinearSolver& lp, IntervalVector &box, LinearSolver::Sense sense, int var, Interval & obj, double bound);
 
 	/**
 	 * TODO: add comment
 	 */
 	void optimizer(IntervalVector &box);
 
+	/**
+	 * Solve all the LPs in parallel (see #set_nb_threads(int))
+	 */
+	void parallel_optimizer(IntervalVector &box);
+
 
 #endif /// end _IBEX_WITH_NOLP_
 
@@ -126,8 +148,17 @@ protected:
 	LinearSolver *mylinearsolver;
 
 private:
+	friend class LPPool;
+
 	bool own_lr;
 
+	/* Parameters of the linear solvers */
+	const int max_iter;
+	const int time_out;
+	const double eps;
+
+	/* The threads solving the LPs (NULL if sequential) */
+	LPPool* pool;
 };
 
 } // end namespace ibex
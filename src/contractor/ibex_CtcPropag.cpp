@@ -39,7 +39,7 @@ CtcPropag::CtcPropag(const Array<Ctc>& cl, double ratio, bool incremental) :
 }
 
 
-void  CtcPropag::contract(IntervalVector& box) {
+bool CtcPropag::try_contract(IntervalVector& box) {
 
 	assert(box.size()==nb_var);
 
@@ -71,8 +71,8 @@ void  CtcPropag::contract(IntervalVector& box) {
 
 		for (int i=0; i<nb_var; i++) {
 			if (!impact() || (*impact())[i]) {
-				set<int> ctrs=g.output_ctrs(i);
-				for (set<int>::iterator c=ctrs.begin(); c!=ctrs.end(); c++)
+				IndexRange ctrs=g.output_ctrs(i);
+				for (const int* c=ctrs.begin(); c!=ctrs.end(); c++)
 					agenda.push(*c);
 			}
 		}
@@ -100,12 +100,12 @@ void  CtcPropag::contract(IntervalVector& box) {
 
 		agenda.pop(c);
 
-		set<int> vars=g.output_vars(c);
+		IndexRange vars=g.output_vars(c);
 
 		// ===================== fine propagation =========================
 		// reset the old box to the current domains just before contraction
 		if (!accumulate) {
-			for (set<int>::iterator v=vars.begin(); v!=vars.end(); v++) {
+			for (const int* v=vars.begin(); v!=vars.end(); v++) {
 				old_box[*v] = box[*v];
 			}
 		}
@@ -113,26 +113,24 @@ void  CtcPropag::contract(IntervalVector& box) {
 
 		//cout << "Contraction with " << c << endl;
 
-		try {
-			list[c].contract(box, _impact, flags);
-			if (flags[INACTIVE]) {
-				active.remove(c);
-			}
-		}
-		catch (EmptyBoxException& e) {
+		if (!list[c].try_contract(box, _impact, flags)) {
 			agenda.flush();
 			//cout << "=========== End propagation ==========" << endl;
 			//cout << "   empty!" << endl;
-			throw e;
+			return false;
+		}
+
+		if (flags[INACTIVE]) {
+			active.remove(c);
 		}
 
-		for (set<int>::iterator it=vars.begin(); it!=vars.end(); it++) {
+		for (const int* it=vars.begin(); it!=vars.end(); it++) {
 			int v=*it;
 			//cout << "   " << old_box[v] << " % " << box[v] << "   " << old_box[v].ratiodelta(box[v]) << endl;
 			//if (old_box[v].rel_distance(box[v])>=ratio) {
 			if (old_box[v].ratiodelta(box[v])>=ratio) {
-				set<int> ctrs=g.output_ctrs(v);
-				for (set<int>::iterator c2=ctrs.begin(); c2!=ctrs.end(); c2++) {
+				IndexRange ctrs=g.output_ctrs(v);
+				for (const int* c2=ctrs.begin(); c2!=ctrs.end(); c2++) {
 					if ((c!=*c2 && active[*c2]) || (c==*c2 && !flags[FIXPOINT]))
 						agenda.push(*c2);
 				}
@@ -156,6 +154,7 @@ void  CtcPropag::contract(IntervalVector& box) {
 	 * small w.r.t the ratio here. */
 	//   if (!reducted) box = propbox; // restore domains
 
+	return true;
 }
 
 const double CtcPropag::default_ratio = __IBEX_DEFAULT_RATIO_PROPAG;
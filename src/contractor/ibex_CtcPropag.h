@@ -47,7 +47,7 @@ public:
 	CtcPropag(const Array<Ctc>& cl, double ratio=default_ratio, bool incr=false);
 
 	/**
-	 * \brief Enforces propagation (e.g.: HC4 or BOX) fitering.
+	 * \brief Enforces propagation (e.g.: HC4 or BOX) fitering, without exception.
 	 *
 	 * Call #contract(IntervalVector&, const BitSet&) with the mask
 	 * set to all the variables.
@@ -55,9 +55,9 @@ public:
 	 * impacted variables only (instead of from all the variables).
 	 *
 	 * \see #contract(IntervalVector&, const BitSet&).
-	 * \throw #ibex::EmptyBoxException - if inconsistency is detected.
+	 * \return false iff inconsistency is detected.
 	 */
-	virtual void contract(IntervalVector& box);
+	virtual bool try_contract(IntervalVector& box);
 
 	/** The list of contractors to propagate */
 	Array<Ctc> list;
@@ -22,6 +22,16 @@ namespace ibex {
  */
 class BwdAlgorithm {
 
+public:
+	/**
+	 * \brief True if the backward phase must stop.
+	 *
+	 * Checked before each node of the backward phase. Always false
+	 * by default; can be redefined by the subclass (e.g., when a
+	 * projection is empty, see #ibex::HC4Revise).
+	 */
+	bool interrupted() const { return false; }
+
 protected:
 	/** TO BE DEFINED (by the subclass) */
 	void index_bwd(const ExprIndex&, ExprLabel& exprL, const ExprLabel& result);
@@ -11,6 +11,7 @@
 
 #include "ibex_CompiledFunction.h"
 #include "ibex_Function.h"
+#include "ibex_ScalarTape.h"
 #include <algorithm>
 
 using std::cout;
@@ -24,11 +25,11 @@ bool compare(const ExprNode* x, const ExprNode* y) { return (x->height>y->height
 
 }
 
-CompiledFunction::CompiledFunction() : 	n(0), code(NULL), nb_args(NULL), args(NULL) {
+CompiledFunction::CompiledFunction() : 	n(0), code(NULL), nb_args(NULL), args(NULL), tape(NULL) {
 
 }
 
-void CompiledFunction::compile(const ExprNode& y) {
+void CompiledFunction::compile(const Array<const ExprSymbol>& x, const ExprNode& y) {
 
 	n=y.size;
 	code=new operation[n];
@@ -43,6 +44,8 @@ void CompiledFunction::compile(const ExprNode& y) {
 	for (ptr=0; ptr<n; ptr++) {
 		visit(nodes[ptr]);
 	}
+
+	tape=ScalarTape::build(x,*this);
 	//cout << f.name << " : n=" << n << " nb_args[" << 0 << "]=" << nb_args[0] << endl;
 }
 
@@ -53,6 +56,7 @@ CompiledFunction::~CompiledFunction() {
 	for (int i=0; i<n; i++) delete[] args[i];
 	delete[] args;
 	delete[] nb_args;
+	if (tape) delete tape;
 }
 
 void CompiledFunction::visit(const ExprNode& e) {
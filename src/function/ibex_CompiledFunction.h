@@ -22,6 +22,7 @@
 namespace ibex {
 
 class Function;
+class ScalarTape;
 
 /**
  * \ingroup symbolic
@@ -36,8 +37,11 @@ public:
 	/**
 	 * Create a compiled version of the function \a f, where
 	 * each node is decorated with an object of type "T" via the decorator \a d.
+	 *
+	 * If the function is scalar (or a vector of scalar expressions),
+	 * the tape is also built (see #ibex::ScalarTape).
 	 */
-	void compile(const ExprNode& y);
+	void compile(const Array<const ExprSymbol>& x, const ExprNode& y);
 
 	/**
 	 * \brier Delete this.
@@ -53,6 +57,14 @@ public:
 	template<class V>
 	ExprLabel& forward(const V& algo) const;
 
+	/**
+	 * Run the forward phase with the labels \a l instead of the decorations
+	 * of the nodes. The labels of the ith node and its arguments must be
+	 * l[i][0], l[i][1], etc. (see #ibex::EvalContext).
+	 */
+	template<class V>
+	ExprLabel& forward(const V& algo, ExprLabel*** l) const;
+
 	/**
 	 * Run the backward phase.  V must be a subclass of BwdAlgorithm.
 	 * Note that the type V is just passed in order to have static linkage.
@@ -60,12 +72,32 @@ public:
 	template<class V>
 	void backward(const V& algo) const;
 
+	/**
+	 * Run the backward phase with the labels \a l instead of the
+	 * decorations of the nodes.
+	 */
+	template<class V>
+	void backward(const V& algo, ExprLabel*** l) const;
+
 	/**
 	 * Print the structure to the standard output.
 	 */
 	void print() const;
 
+	/**
+	 * \brief The scalar tape (NULL if the function is not scalar).
+	 */
+	const ScalarTape* scalar_tape() const;
+
+	/**
+	 * \brief The tape of a vector-valued function (NULL if the function
+	 * is not a vector of scalar expressions).
+	 */
+	const ScalarTape* vector_tape() const;
+
 	friend class Function;
+	friend class EvalContext;
+	friend class ScalarTape;
 
 protected:
 	typedef enum {
@@ -139,117 +171,137 @@ protected:
 	mutable ExprLabel*** args;
 
 	mutable int ptr;
+
+	ScalarTape* tape;
 };
 
+inline const ScalarTape* CompiledFunction::scalar_tape() const {
+	return tape && code[0]!=VEC ? tape : NULL;
+}
+
+inline const ScalarTape* CompiledFunction::vector_tape() const {
+	return tape && code[0]==VEC ? tape : NULL;
+}
+
 template<class V>
-ExprLabel& CompiledFunction::forward(const V& algo) const {
+inline ExprLabel& CompiledFunction::forward(const V& algo) const {
+	return forward(algo,args);
+}
+
+template<class V>
+ExprLabel& CompiledFunction::forward(const V& algo, ExprLabel*** l) const {
 	assert(dynamic_cast<const FwdAlgorithm* >(&algo)!=NULL);
 
 	for (int i=n-1; i>=0; i--) {
 		switch(code[i]) {
-		case IDX:    ((V&) algo).index_fwd((ExprIndex&)    nodes[i], *args[i][1],  *args[i][0]); break;
-		case VEC:    ((V&) algo).vector_fwd((ExprVector&)  nodes[i], (const ExprLabel**) &(args[i][1]),*args[i][0]); break;
-		case SYM:    ((V&) algo).symbol_fwd((ExprSymbol&)  nodes[i],               *args[i][0]); break;
-		case CST:    ((V&) algo).cst_fwd  ((ExprConstant&) nodes[i],               *args[i][0]); break;
-		case APPLY:  ((V&) algo).apply_fwd((ExprApply&)    nodes[i], &(args[i][1]),*args[i][0]); break;
-		case CHI:    ((V&) algo).chi_fwd  ((ExprChi&)      nodes[i], *args[i][1], *args[i][2],  *args[i][3],*args[i][0]); break;
-		case ADD:    ((V&) algo).add_fwd  ((ExprAdd&)      nodes[i], *args[i][1], *args[i][2], *args[i][0]); break;
-		case ADD_V:  ((V&) algo).add_V_fwd  ((ExprAdd&)    nodes[i], *args[i][1], *args[i][2], *args[i][0]); break;
-		case ADD_M:  ((V&) algo).add_M_fwd  ((ExprAdd&)    nodes[i], *args[i][1], *args[i][2], *args[i][0]); break;
-		case MUL:    ((V&) algo).mul_fwd  ((ExprMul&)      nodes[i], *args[i][1], *args[i][2], *args[i][0]); break;
-		case MUL_SV: ((V&) algo).mul_SV_fwd ((ExprMul&)    nodes[i], *args[i][1], *args[i][2], *args[i][0]); break;
-		case MUL_SM: ((V&) algo).mul_SM_fwd ((ExprMul&)    nodes[i], *args[i][1], *args[i][2], *args[i][0]); break;
-		case MUL_VV: ((V&) algo).mul_VV_fwd ((ExprMul&)    nodes[i], *args[i][1], *args[i][2], *args[i][0]); break;
-		case MUL_MV: ((V&) algo).mul_MV_fwd ((ExprMul&)    nodes[i], *args[i][1], *args[i][2], *args[i][0]); break;
-		case MUL_MM: ((V&) algo).mul_MM_fwd ((ExprMul&)    nodes[i], *args[i][1], *args[i][2], *args[i][0]); break;
-		case MUL_VM: ((V&) algo).mul_VM_fwd ((ExprMul&)    nodes[i], *args[i][1], *args[i][2], *args[i][0]); break;
-		case SUB:    ((V&) algo).sub_fwd  ((ExprSub&)      nodes[i], *args[i][1], *args[i][2], *args[i][0]); break;
-		case SUB_V:  ((V&) algo).sub_V_fwd  ((ExprSub&)    nodes[i], *args[i][1], *args[i][2], *args[i][0]); break;
-		case SUB_M:  ((V&) algo).sub_M_fwd  ((ExprSub&)    nodes[i], *args[i][1], *args[i][2], *args[i][0]); break;
-		case DIV:    ((V&) algo).div_fwd  ((ExprDiv&)      nodes[i], *args[i][1], *args[i][2], *args[i][0]); break;
-		case MAX:    ((V&) algo).max_fwd  ((ExprMax&)      nodes[i], *args[i][1], *args[i][2], *args[i][0]); break;
-		case MIN:    ((V&) algo).min_fwd  ((ExprMin&)      nodes[i], *args[i][1], *args[i][2], *args[i][0]); break;
-		case ATAN2:  ((V&) algo).atan2_fwd((ExprAtan2&)    nodes[i], *args[i][1], *args[i][2], *args[i][0]); break;
-		case MINUS:  ((V&) algo).minus_fwd((ExprMinus&)    nodes[i], *args[i][1],                   *args[i][0]); break;
-		case TRANS_V:((V&) algo).trans_V_fwd((ExprTrans&)  nodes[i], *args[i][1],                   *args[i][0]); break;
-		case TRANS_M:((V&) algo).trans_M_fwd((ExprTrans&)  nodes[i], *args[i][1],                   *args[i][0]); break;
-		case SIGN:   ((V&) algo).sign_fwd ((ExprSign&)     nodes[i], *args[i][1],                   *args[i][0]); break;
-		case ABS:    ((V&) algo).abs_fwd  ((ExprAbs&)      nodes[i], *args[i][1],                   *args[i][0]); break;
-		case POWER:  ((V&) algo).power_fwd((ExprPower&)    nodes[i], *args[i][1],                   *args[i][0]); break;
-		case SQR:    ((V&) algo).sqr_fwd  ((ExprSqr&)      nodes[i], *args[i][1],                   *args[i][0]); break;
-		case SQRT:   ((V&) algo).sqrt_fwd ((ExprSqrt&)     nodes[i], *args[i][1],                   *args[i][0]); break;
-		case EXP:    ((V&) algo).exp_fwd  ((ExprExp&)      nodes[i], *args[i][1],                   *args[i][0]); break;
-		case LOG:    ((V&) algo).log_fwd  ((ExprLog&)      nodes[i], *args[i][1],                   *args[i][0]); break;
-		case COS:    ((V&) algo).cos_fwd  ((ExprCos&)      nodes[i], *args[i][1],                   *args[i][0]); break;
-		case SIN:    ((V&) algo).sin_fwd  ((ExprSin&)      nodes[i], *args[i][1],                   *args[i][0]); break;
-		case TAN:    ((V&) algo).tan_fwd  ((ExprTan&)      nodes[i], *args[i][1],                   *args[i][0]); break;
-		case COSH:   ((V&) algo).cosh_fwd ((ExprCosh&)     nodes[i], *args[i][1],                   *args[i][0]); break;
-		case SINH:   ((V&) algo).sinh_fwd ((ExprSinh&)     nodes[i], *args[i][1],                   *args[i][0]); break;
-		case TANH:   ((V&) algo).tanh_fwd ((ExprTanh&)     nodes[i], *args[i][1],                   *args[i][0]); break;
-		case ACOS:   ((V&) algo).acos_fwd ((ExprAcos&)     nodes[i], *args[i][1],                   *args[i][0]); break;
-		case ASIN:   ((V&) algo).asin_fwd ((ExprAsin&)     nodes[i], *args[i][1],                   *args[i][0]); break;
-		case ATAN:   ((V&) algo).atan_fwd ((ExprAtan&)     nodes[i], *args[i][1],                   *args[i][0]); break;
-		case ACOSH:  ((V&) algo).acosh_fwd((ExprAcosh&)    nodes[i], *args[i][1],                   *args[i][0]); break;
-		case ASINH:  ((V&) algo).asinh_fwd((ExprAsinh&)    nodes[i], *args[i][1],                   *args[i][0]); break;
-		case ATANH:  ((V&) algo).atanh_fwd((ExprAtanh&)    nodes[i], *args[i][1],                   *args[i][0]); break;
+		case IDX:    ((V&) algo).index_fwd((ExprIndex&)    nodes[i], *l[i][1],  *l[i][0]); break;
+		case VEC:    ((V&) algo).vector_fwd((ExprVector&)  nodes[i], (const ExprLabel**) &(l[i][1]),*l[i][0]); break;
+		case SYM:    ((V&) algo).symbol_fwd((ExprSymbol&)  nodes[i],               *l[i][0]); break;
+		case CST:    ((V&) algo).cst_fwd  ((ExprConstant&) nodes[i],               *l[i][0]); break;
+		case APPLY:  ((V&) algo).apply_fwd((ExprApply&)    nodes[i], &(l[i][1]),*l[i][0]); break;
+		case CHI:    ((V&) algo).chi_fwd  ((ExprChi&)      nodes[i], *l[i][1], *l[i][2],  *l[i][3],*l[i][0]); break;
+		case ADD:    ((V&) algo).add_fwd  ((ExprAdd&)      nodes[i], *l[i][1], *l[i][2], *l[i][0]); break;
+		case ADD_V:  ((V&) algo).add_V_fwd  ((ExprAdd&)    nodes[i], *l[i][1], *l[i][2], *l[i][0]); break;
+		case ADD_M:  ((V&) algo).add_M_fwd  ((ExprAdd&)    nodes[i], *l[i][1], *l[i][2], *l[i][0]); break;
+		case MUL:    ((V&) algo).mul_fwd  ((ExprMul&)      nodes[i], *l[i][1], *l[i][2], *l[i][0]); break;
+		case MUL_SV: ((V&) algo).mul_SV_fwd ((ExprMul&)    nodes[i], *l[i][1], *l[i][2], *l[i][0]); break;
+		case MUL_SM: ((V&) algo).mul_SM_fwd ((ExprMul&)    nodes[i], *l[i][1], *l[i][2], *l[i][0]); break;
+		case MUL_VV: ((V&) algo).mul_VV_fwd ((ExprMul&)    nodes[i], *l[i][1], *l[i][2], *l[i][0]); break;
+		case MUL_MV: ((V&) algo).mul_MV_fwd ((ExprMul&)    nodes[i], *l[i][1], *l[i][2], *l[i][0]); break;
+		case MUL_MM: ((V&) algo).mul_MM_fwd ((ExprMul&)    nodes[i], *l[i][1], *l[i][2], *l[i][0]); break;
+		case MUL_VM: ((V&) algo).mul_VM_fwd ((ExprMul&)    nodes[i], *l[i][1], *l[i][2], *l[i][0]); break;
+		case SUB:    ((V&) algo).sub_fwd  ((ExprSub&)      nodes[i], *l[i][1], *l[i][2], *l[i][0]); break;
+		case SUB_V:  ((V&) algo).sub_V_fwd  ((ExprSub&)    nodes[i], *l[i][1], *l[i][2], *l[i][0]); break;
+		case SUB_M:  ((V&) algo).sub_M_fwd  ((ExprSub&)    nodes[i], *l[i][1], *l[i][2], *l[i][0]); break;
+		case DIV:    ((V&) algo).div_fwd  ((ExprDiv&)      nodes[i], *l[i][1], *l[i][2], *l[i][0]); break;
+		case MAX:    ((V&) algo).max_fwd  ((ExprMax&)      nodes[i], *l[i][1], *l[i][2], *l[i][0]); break;
+		case MIN:    ((V&) algo).min_fwd  ((ExprMin&)      nodes[i], *l[i][1], *l[i][2], *l[i][0]); break;
+		case ATAN2:  ((V&) algo).atan2_fwd((ExprAtan2&)    nodes[i], *l[i][1], *l[i][2], *l[i][0]); break;
+		case MINUS:  ((V&) algo).minus_fwd((ExprMinus&)    nodes[i], *l[i][1],                   *l[i][0]); break;
+		case TRANS_V:((V&) algo).trans_V_fwd((ExprTrans&)  nodes[i], *l[i][1],                   *l[i][0]); break;
+		case TRANS_M:((V&) algo).trans_M_fwd((ExprTrans&)  nodes[i], *l[i][1],                   *l[i][0]); break;
+		case SIGN:   ((V&) algo).sign_fwd ((ExprSign&)     nodes[i], *l[i][1],                   *l[i][0]); break;
+		case ABS:    ((V&) algo).abs_fwd  ((ExprAbs&)      nodes[i], *l[i][1],                   *l[i][0]); break;
+		case POWER:  ((V&) algo).power_fwd((ExprPower&)    nodes[i], *l[i][1],                   *l[i][0]); break;
+		case SQR:    ((V&) algo).sqr_fwd  ((ExprSqr&)      nodes[i], *l[i][1],                   *l[i][0]); break;
+		case SQRT:   ((V&) algo).sqrt_fwd ((ExprSqrt&)     nodes[i], *l[i][1],                   *l[i][0]); break;
+		case EXP:    ((V&) algo).exp_fwd  ((ExprExp&)      nodes[i], *l[i][1],                   *l[i][0]); break;
+		case LOG:    ((V&) algo).log_fwd  ((ExprLog&)      nodes[i], *l[i][1],                   *l[i][0]); break;
+		case COS:    ((V&) algo).cos_fwd  ((ExprCos&)      nodes[i], *l[i][1],                   *l[i][0]); break;
+		case SIN:    ((V&) algo).sin_fwd  ((ExprSin&)      nodes[i], *l[i][1],                   *l[i][0]); break;
+		case TAN:    ((V&) algo).tan_fwd  ((ExprTan&)      nodes[i], *l[i][1],                   *l[i][0]); break;
+		case COSH:   ((V&) algo).cosh_fwd ((ExprCosh&)     nodes[i], *l[i][1],                   *l[i][0]); break;
+		case SINH:   ((V&) algo).sinh_fwd ((ExprSinh&)     nodes[i], *l[i][1],                   *l[i][0]); break;
+		case TANH:   ((V&) algo).tanh_fwd ((ExprTanh&)     nodes[i], *l[i][1],                   *l[i][0]); break;
+		case ACOS:   ((V&) algo).acos_fwd ((ExprAcos&)     nodes[i], *l[i][1],                   *l[i][0]); break;
+		case ASIN:   ((V&) algo).asin_fwd ((ExprAsin&)     nodes[i], *l[i][1],                   *l[i][0]); break;
+		case ATAN:   ((V&) algo).atan_fwd ((ExprAtan&)     nodes[i], *l[i][1],                   *l[i][0]); break;
+		case ACOSH:  ((V&) algo).acosh_fwd((ExprAcosh&)    nodes[i], *l[i][1],                   *l[i][0]); break;
+		case ASINH:  ((V&) algo).asinh_fwd((ExprAsinh&)    nodes[i], *l[i][1],                   *l[i][0]); break;
+		case ATANH:  ((V&) algo).atanh_fwd((ExprAtanh&)    nodes[i], *l[i][1],                   *l[i][0]); break;
 		default: 	 assert(false);
 		}
 	}
-	return *args[0][0];
+	return *l[0][0];
+}
+
+template<class V>
+inline void CompiledFunction::backward(const V& algo) const {
+	backward(algo,args);
 }
 
 template<class V>
-void CompiledFunction::backward(const V& algo) const {
+void CompiledFunction::backward(const V& algo, ExprLabel*** l) const {
 
 	assert(dynamic_cast<const BwdAlgorithm* >(&algo)!=NULL);
 
-	for (int i=0; i<n; i++) {
+	for (int i=0; i<n && !((V&) algo).interrupted(); i++) {
 		switch(code[i]) {
-		case IDX:    ((V&) algo).index_bwd((ExprIndex&)    nodes[i], *args[i][1],   *args[i][0]); break;
-		case VEC:    ((V&) algo).vector_bwd((ExprVector&)  nodes[i], &(args[i][1]), *args[i][0]); break;
-		case SYM:    ((V&) algo).symbol_bwd((ExprSymbol&)  nodes[i],                *args[i][0]); break;
-		case CST:    ((V&) algo).cst_bwd  ((ExprConstant&) nodes[i],                *args[i][0]); break;
-		case APPLY:  ((V&) algo).apply_bwd  ((ExprApply&)  nodes[i], &(args[i][1]), *args[i][0]); break;
-		case CHI:    ((V&) algo).chi_bwd    ((ExprChi&)    nodes[i], *args[i][1], *args[i][2], *args[i][3], *args[i][0]); break;
-		case ADD:    ((V&) algo).add_bwd    ((ExprAdd&)    nodes[i], *args[i][1], *args[i][2], *args[i][0]); break;
-		case ADD_V:  ((V&) algo).add_V_bwd  ((ExprAdd&)    nodes[i], *args[i][1], *args[i][2], *args[i][0]); break;
-		case ADD_M:  ((V&) algo).add_M_bwd  ((ExprAdd&)    nodes[i], *args[i][1], *args[i][2], *args[i][0]); break;
-		case MUL:    ((V&) algo).mul_bwd    ((ExprMul&)    nodes[i], *args[i][1], *args[i][2], *args[i][0]); break;
-		case MUL_SV: ((V&) algo).mul_SV_bwd ((ExprMul&)    nodes[i], *args[i][1], *args[i][2], *args[i][0]); break;
-		case MUL_SM: ((V&) algo).mul_SM_bwd ((ExprMul&)    nodes[i], *args[i][1], *args[i][2], *args[i][0]); break;
-		case MUL_VV: ((V&) algo).mul_VV_bwd ((ExprMul&)    nodes[i], *args[i][1], *args[i][2], *args[i][0]); break;
-		case MUL_MV: ((V&) algo).mul_MV_bwd ((ExprMul&)    nodes[i], *args[i][1], *args[i][2], *args[i][0]); break;
-		case MUL_MM: ((V&) algo).mul_MM_bwd ((ExprMul&)    nodes[i], *args[i][1], *args[i][2], *args[i][0]); break;
-		case MUL_VM: ((V&) algo).mul_VM_bwd ((ExprMul&)    nodes[i], *args[i][1], *args[i][2], *args[i][0]); break;
-		case SUB:    ((V&) algo).sub_bwd    ((ExprSub&)    nodes[i], *args[i][1], *args[i][2], *args[i][0]); break;
-		case SUB_V:  ((V&) algo).sub_V_bwd  ((ExprSub&)    nodes[i], *args[i][1], *args[i][2], *args[i][0]); break;
-		case SUB_M:  ((V&) algo).sub_M_bwd  ((ExprSub&)    nodes[i], *args[i][1], *args[i][2], *args[i][0]); break;
-		case DIV:    ((V&) algo).div_bwd  ((ExprDiv&)      nodes[i], *args[i][1], *args[i][2], *args[i][0]); break;
-		case MAX:    ((V&) algo).max_bwd  ((ExprMax&)      nodes[i], *args[i][1], *args[i][2], *args[i][0]); break;
-		case MIN:    ((V&) algo).min_bwd  ((ExprMin&)      nodes[i], *args[i][1], *args[i][2], *args[i][0]); break;
-		case ATAN2:  ((V&) algo).atan2_bwd((ExprAtan2&)    nodes[i], *args[i][1], *args[i][2], *args[i][0]); break;
-		case MINUS:  ((V&) algo).minus_bwd((ExprMinus&)    nodes[i], *args[i][1],                   *args[i][0]); break;
-		case TRANS_V:((V&) algo).trans_V_bwd((ExprTrans&)  nodes[i], *args[i][1],                   *args[i][0]); break;
-		case TRANS_M:((V&) algo).trans_M_bwd((ExprTrans&)  nodes[i], *args[i][1],                   *args[i][0]); break;
-		case SIGN:   ((V&) algo).sign_bwd ((ExprSign&)     nodes[i], *args[i][1],                   *args[i][0]); break;
-		case ABS:    ((V&) algo).abs_bwd  ((ExprAbs&)      nodes[i], *args[i][1],                   *args[i][0]); break;
-		case POWER:  ((V&) algo).power_bwd((ExprPower&)    nodes[i], *args[i][1],                   *args[i][0]); break;
-		case SQR:    ((V&) algo).sqr_bwd  ((ExprSqr&)      nodes[i], *args[i][1],                   *args[i][0]); break;
-		case SQRT:   ((V&) algo).sqrt_bwd ((ExprSqrt&)     nodes[i], *args[i][1],                   *args[i][0]); break;
-		case EXP:    ((V&) algo).exp_bwd  ((ExprExp&)      nodes[i], *args[i][1],                   *args[i][0]); break;
-		case LOG:    ((V&) algo).log_bwd  ((ExprLog&)      nodes[i], *args[i][1],                   *args[i][0]); break;
-		case COS:    ((V&) algo).cos_bwd  ((ExprCos&)      nodes[i], *args[i][1],                   *args[i][0]); break;
-		case SIN:    ((V&) algo).sin_bwd  ((ExprSin&)      nodes[i], *args[i][1],                   *args[i][0]); break;
-		case TAN:    ((V&) algo).tan_bwd  ((ExprTan&)      nodes[i], *args[i][1],                   *args[i][0]); break;
-		case COSH:   ((V&) algo).cosh_bwd ((ExprCosh&)     nodes[i], *args[i][1],                   *args[i][0]); break;
-		case SINH:   ((V&) algo).sinh_bwd ((ExprSinh&)     nodes[i], *args[i][1],                   *args[i][0]); break;
-		case TANH:   ((V&) algo).tanh_bwd ((ExprTanh&)     nodes[i], *args[i][1],                   *args[i][0]); break;
-		case ACOS:   ((V&) algo).acos_bwd ((ExprAcos&)     nodes[i], *args[i][1],                   *args[i][0]); break;
-		case ASIN:   ((V&) algo).asin_bwd ((ExprAsin&)     nodes[i], *args[i][1],                   *args[i][0]); break;
-		case ATAN:   ((V&) algo).atan_bwd ((ExprAtan&)     nodes[i], *args[i][1],                   *args[i][0]); break;
-		case ACOSH:  ((V&) algo).acosh_bwd((ExprAcosh&)    nodes[i], *args[i][1],                   *args[i][0]); break;
-		case ASINH:  ((V&) algo).asinh_bwd((ExprAsinh&)    nodes[i], *args[i][1],                   *args[i][0]); break;
-		case ATANH:  ((V&) algo).atanh_bwd((ExprAtanh&)    nodes[i], *args[i][1],                   *args[i][0]); break;
+		case IDX:    ((V&) algo).index_bwd((ExprIndex&)    nodes[i], *l[i][1],   *l[i][0]); break;
+		case VEC:    ((V&) algo).vector_bwd((ExprVector&)  nodes[i], &(l[i][1]), *l[i][0]); break;
+		case SYM:    ((V&) algo).symbol_bwd((ExprSymbol&)  nodes[i],                *l[i][0]); break;
+		case CST:    ((V&) algo).cst_bwd  ((ExprConstant&) nodes[i],                *l[i][0]); break;
+		case APPLY:  ((V&) algo).apply_bwd  ((ExprApply&)  nodes[i], &(l[i][1]), *l[i][0]); break;
+		case CHI:    ((V&) algo).chi_bwd    ((ExprChi&)    nodes[i], *l[i][1], *l[i][2], *l[i][3], *l[i][0]); break;
+		case ADD:    ((V&) algo).add_bwd    ((ExprAdd&)    nodes[i], *l[i][1], *l[i][2], *l[i][0]); break;
+		case ADD_V:  ((V&) algo).add_V_bwd  ((ExprAdd&)    nodes[i], *l[i][1], *l[i][2], *l[i][0]); break;
+		case ADD_M:  ((V&) algo).add_M_bwd  ((ExprAdd&)    nodes[i], *l[i][1], *l[i][2], *l[i][0]); break;
+		case MUL:    ((V&) algo).mul_bwd    ((ExprMul&)    nodes[i], *l[i][1], *l[i][2], *l[i][0]); break;
+		case MUL_SV: ((V&) algo).mul_SV_bwd ((ExprMul&)    nodes[i], *l[i][1], *l[i][2], *l[i][0]); break;
+		case MUL_SM: ((V&) algo).mul_SM_bwd ((ExprMul&)    nodes[i], *l[i][1], *l[i][2], *l[i][0]); break;
+		case MUL_VV: ((V&) algo).mul_VV_bwd ((ExprMul&)    nodes[i], *l[i][1], *l[i][2], *l[i][0]); break;
+		case MUL_MV: ((V&) algo).mul_MV_bwd ((ExprMul&)    nodes[i], *l[i][1], *l[i][2], *l[i][0]); break;
+		case MUL_MM: ((V&) algo).mul_MM_bwd ((ExprMul&)    nodes[i], *l[i][1], *l[i][2], *l[i][0]); break;
+		case MUL_VM: ((V&) algo).mul_VM_bwd ((ExprMul&)    nodes[i], *l[i][1], *l[i][2], *l[i][0]); break;
+		case SUB:    ((V&) algo).sub_bwd    ((ExprSub&)    nodes[i], *l[i][1], *l[i][2], *l[i][0]); break;
+		case SUB_V:  ((V&) algo).sub_V_bwd  ((ExprSub&)    nodes[i], *l[i][1], *l[i][2], *l[i][0]); break;
+		case SUB_M:  ((V&) algo).sub_M_bwd  ((ExprSub&)    nodes[i], *l[i][1], *l[i][2], *l[i][0]); break;
+		case DIV:    ((V&) algo).div_bwd  ((ExprDiv&)      nodes[i], *l[i][1], *l[i][2], *l[i][0]); break;
+		case MAX:    ((V&) algo).max_bwd  ((ExprMax&)      nodes[i], *l[i][1], *l[i][2], *l[i][0]); break;
+		case MIN:    ((V&) algo).min_bwd  ((ExprMin&)      nodes[i], *l[i][1], *l[i][2], *l[i][0]); break;
+		case ATAN2:  ((V&) algo).atan2_bwd((ExprAtan2&)    nodes[i], *l[i][1], *l[i][2], *l[i][0]); break;
+		case MINUS:  ((V&) algo).minus_bwd((ExprMinus&)    nodes[i], *l[i][1],                   *l[i][0]); break;
+		case TRANS_V:((V&) algo).trans_V_bwd((ExprTrans&)  nodes[i], *l[i][1],                   *l[i][0]); break;
+		case TRANS_M:((V&) algo).trans_M_bwd((ExprTrans&)  nodes[i], *l[i][1],                   *l[i][0]); break;
+		case SIGN:   ((V&) algo).sign_bwd ((ExprSign&)     nodes[i], *l[i][1],                   *l[i][0]); break;
+		case ABS:    ((V&) algo).abs_bwd  ((ExprAbs&)      nodes[i], *l[i][1],                   *l[i][0]); break;
+		case POWER:  ((V&) algo).power_bwd((ExprPower&)    nodes[i], *l[i][1],                   *l[i][0]); break;
+		case SQR:    ((V&) algo).sqr_bwd  ((ExprSqr&)      nodes[i], *l[i][1],                   *l[i][0]); break;
+		case SQRT:   ((V&) algo).sqrt_bwd ((ExprSqrt&)     nodes[i], *l[i][1],                   *l[i][0]); break;
+		case EXP:    ((V&) algo).exp_bwd  ((ExprExp&)      nodes[i], *l[i][1],                   *l[i][0]); break;
+		case LOG:    ((V&) algo).log_bwd  ((ExprLog&)      nodes[i], *l[i][1],                   *l[i][0]); break;
+		case COS:    ((V&) algo).cos_bwd  ((ExprCos&)      nodes[i], *l[i][1],                   *l[i][0]); break;
+		case SIN:    ((V&) algo).sin_bwd  ((ExprSin&)      nodes[i], *l[i][1],                   *l[i][0]); break;
+		case TAN:    ((V&) algo).tan_bwd  ((ExprTan&)      nodes[i], *l[i][1],                   *l[i][0]); break;
+		case COSH:   ((V&) algo).cosh_bwd ((ExprCosh&)     nodes[i], *l[i][1],                   *l[i][0]); break;
+		case SINH:   ((V&) algo).sinh_bwd ((ExprSinh&)     nodes[i], *l[i][1],                   *l[i][0]); break;
+		case TANH:   ((V&) algo).tanh_bwd ((ExprTanh&)     nodes[i], *l[i][1],                   *l[i][0]); break;
+		case ACOS:   ((V&) algo).acos_bwd ((ExprAcos&)     nodes[i], *l[i][1],                   *l[i][0]); break;
+		case ASIN:   ((V&) algo).asin_bwd ((ExprAsin&)     nodes[i], *l[i][1],                   *l[i][0]); break;
+		case ATAN:   ((V&) algo).atan_bwd ((ExprAtan&)     nodes[i], *l[i][1],                   *l[i][0]); break;
+		case ACOSH:  ((V&) algo).acosh_bwd((ExprAcosh&)    nodes[i], *l[i][1],                   *l[i][0]); break;
+		case ASINH:  ((V&) algo).asinh_bwd((ExprAsinh&)    nodes[i], *l[i][1],                   *l[i][0]); break;
+		case ATANH:  ((V&) algo).atanh_bwd((ExprAtanh&)    nodes[i], *l[i][1],                   *l[i][0]); break;
 		default: 	 assert(false);
 		}
 	}
@@ -19,7 +19,7 @@ namespace ibex {
 
 void Decorator::decorate(const Array<const ExprSymbol>& x, const ExprNode& y) {
 
-	if (y.deco.d!=NULL) return; // already decorated
+	if (label(y).d!=NULL) return; // already decorated
 
 	// we cannot just call visit(f.expr()) because:
 	//
@@ -33,15 +33,19 @@ void Decorator::decorate(const Array<const ExprSymbol>& x, const ExprNode& y) {
 	for (int i=0; i<x.size(); i++) {
 		//visit((const ExprNode&) x); // don't (because of case 2- above)
 		map.insert(x[i],true);
-		x[i].deco.d = new Domain(x[i].dim);
-		x[i].deco.g = new Domain(x[i].dim);
-		x[i].deco.p = new Domain(x[i].dim);
-		x[i].deco.af2 = new Affine2Domain(x[i].dim);
+		label(x[i]).d = new Domain(x[i].dim);
+		label(x[i]).g = new Domain(x[i].dim);
+		label(x[i]).p = new Domain(x[i].dim);
+		label(x[i]).af2 = new Affine2Domain(x[i].dim);
 	}
 
 	visit(y); // cast -> we know *this will not be modified
 }
 
+ExprLabel& Decorator::label(const ExprNode& e) {
+	return e.deco;
+}
+
 void Decorator::visit(const ExprNode& e) {
 	if (!map.found(e)) {
 		map.insert(e,true);
@@ -53,36 +57,36 @@ void Decorator::visit(const ExprIndex& idx) {
 
 	visit(idx.expr);
 
-	Domain& d=(Domain&) *idx.expr.deco.d;
-	Domain& g=(Domain&) *idx.expr.deco.g;
-	Domain& di=(Domain&) *idx.expr.deco.p;
-	Affine2Domain& af2=(Affine2Domain&) *idx.expr.deco.af2;
+	Domain& d=(Domain&) *label(idx.expr).d;
+	Domain& g=(Domain&) *label(idx.expr).g;
+	Domain& di=(Domain&) *label(idx.expr).p;
+	Affine2Domain& af2=(Affine2Domain&) *label(idx.expr).af2;
 
 	switch (idx.expr.type()) {
 	case Dim::SCALAR:
-		idx.deco.d = new Domain(d.i());
-		idx.deco.g = new Domain(g.i());
-		idx.deco.p = new Domain(di.i());
-		idx.deco.af2 = new Affine2Domain(af2.i());
+		label(idx).d = new Domain(d.i());
+		label(idx).g = new Domain(g.i());
+		label(idx).p = new Domain(di.i());
+		label(idx).af2 = new Affine2Domain(af2.i());
 		break;
 	case Dim::ROW_VECTOR:
 	case Dim::COL_VECTOR:
-		idx.deco.d = new Domain(d.v()[idx.index]);
-		idx.deco.g = new Domain(g.v()[idx.index]);
-		idx.deco.p = new Domain(di.v()[idx.index]);
-		idx.deco.af2 = new Affine2Domain(af2.v()[idx.index]);
+		label(idx).d = new Domain(d.v()[idx.index]);
+		label(idx).g = new Domain(g.v()[idx.index]);
+		label(idx).p = new Domain(di.v()[idx.index]);
+		label(idx).af2 = new Affine2Domain(af2.v()[idx.index]);
 		break;
 	case Dim::MATRIX:
-		idx.deco.d = new Domain(d.m()[idx.index],true);
-		idx.deco.g = new Domain(g.m()[idx.index],true);
-		idx.deco.p = new Domain(di.m()[idx.index],true);
-		idx.deco.af2 = new Affine2Domain(af2.m()[idx.index],true);
+		label(idx).d = new Domain(d.m()[idx.index],true);
+		label(idx).g = new Domain(g.m()[idx.index],true);
+		label(idx).p = new Domain(di.m()[idx.index],true);
+		label(idx).af2 = new Affine2Domain(af2.m()[idx.index],true);
 		break;
 	case Dim::MATRIX_ARRAY:
-		idx.deco.d = new Domain(d.ma()[idx.index]);
-		idx.deco.g = new Domain(g.ma()[idx.index]);
-		idx.deco.p = new Domain(di.ma()[idx.index]);
-		idx.deco.af2 = new Affine2Domain(af2.ma()[idx.index]);
+		label(idx).d = new Domain(d.ma()[idx.index]);
+		label(idx).g = new Domain(g.ma()[idx.index]);
+		label(idx).p = new Domain(di.ma()[idx.index]);
+		label(idx).af2 = new Affine2Domain(af2.ma()[idx.index]);
 		break;
 	}
 
@@ -93,10 +97,10 @@ void Decorator::visit(const ExprLeaf& e) {
 }
 
 void Decorator::visit(const ExprConstant& e) {
-	e.deco.d = new Domain(e.dim);
-	e.deco.g = new Domain(e.dim);
-	e.deco.p = new Domain(e.dim);
-	e.deco.af2 = new Affine2Domain(e.dim);
+	label(e).d = new Domain(e.dim);
+	label(e).g = new Domain(e.dim);
+	label(e).p = new Domain(e.dim);
+	label(e).af2 = new Affine2Domain(e.dim);
 }
 
 void Decorator::visit(const ExprSymbol& e) {
@@ -108,10 +112,10 @@ void Decorator::visit(const ExprSymbol& e) {
 void Decorator::visit(const ExprBinaryOp& b) {
 	visit(b.left);
 	visit(b.right);
-	b.deco.d = new Domain(b.dim);
-	b.deco.g = new Domain(b.dim);
-	b.deco.p = new Domain(b.dim);
-	b.deco.af2 = new Affine2Domain(b.dim);
+	label(b).d = new Domain(b.dim);
+	label(b).g = new Domain(b.dim);
+	label(b).p = new Domain(b.dim);
+	label(b).af2 = new Affine2Domain(b.dim);
 }
 
 void Decorator::visit(const ExprUnaryOp& u) {
@@ -119,27 +123,27 @@ void Decorator::visit(const ExprUnaryOp& u) {
 	const ExprTrans* t=dynamic_cast<const ExprTrans*>(&u);
 
 	if (t && u.dim.is_vector()) {
-		u.deco.d = new Domain(*u.expr.deco.d,true);
-		u.deco.g = new Domain(*u.expr.deco.g,true);
-		u.deco.p = new Domain(*u.expr.deco.p,true);
-		u.deco.af2 = new Affine2Domain(*u.expr.deco.af2,true);
+		label(u).d = new Domain(*label(u.expr).d,true);
+		label(u).g = new Domain(*label(u.expr).g,true);
+		label(u).p = new Domain(*label(u.expr).p,true);
+		label(u).af2 = new Affine2Domain(*label(u.expr).af2,true);
 	} else {
 		/* TODO: seems impossible to have references
 		 in case of matrices... */
-		u.deco.d = new Domain(u.dim);
-		u.deco.g = new Domain(u.dim);
-		u.deco.p = new Domain(u.dim);
-		u.deco.af2 = new Affine2Domain(u.dim);
+		label(u).d = new Domain(u.dim);
+		label(u).g = new Domain(u.dim);
+		label(u).p = new Domain(u.dim);
+		label(u).af2 = new Affine2Domain(u.dim);
 	}
 }
 
 void Decorator::visit(const ExprNAryOp& a) {
 	for (int i=0; i<a.nb_args; i++)
 		visit(a.arg(i));
-	a.deco.d = new Domain(a.dim);
-	a.deco.g = new Domain(a.dim);
-	a.deco.p = new Domain(a.dim);
-	a.deco.af2 = new Affine2Domain(a.dim);
+	label(a).d = new Domain(a.dim);
+	label(a).g = new Domain(a.dim);
+	label(a).p = new Domain(a.dim);
+	label(a).af2 = new Affine2Domain(a.dim);
 
 	/* we could also be more efficient by making symbolLabels of a.deco->fevl
 		 * direct references to the arguments' domain.
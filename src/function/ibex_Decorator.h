@@ -14,6 +14,7 @@
 #include "ibex_Domain.h"
 #include "ibex_ExprVisitor.h"
 #include "ibex_NodeMap.h"
+#include "ibex_ExprLabel.h"
 #include "ibex_Affine2Domain.h"
 
 namespace ibex {
@@ -48,6 +49,9 @@ public:
 	virtual ~Decorator() { }
 
 protected:
+	/* The label to be initialized for a node (by default: its decoration) */
+	virtual ExprLabel& label(const ExprNode& e);
+
 	/* Visit an expression. */
 	virtual void visit(const ExprNode& n);
 	/* Visit an indexed expression. */
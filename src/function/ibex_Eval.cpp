@@ -11,6 +11,7 @@
 
 #include "ibex_Eval.h"
 #include "ibex_Expr.h"
+#include "ibex_EvalContext.h"
 
 #include <typeinfo>
 namespace ibex {
@@ -79,6 +80,18 @@ Domain& Eval::eval(const Function &f, const IntervalVector& box) const {
 	return *f.expr().deco.d;
 }
 
+Domain& Eval::eval(const Function &f, const IntervalVector& box, EvalContext& c) const {
+
+	c.write_arg_domains(box);
+
+	try {
+		f.forward<Eval>(*this,c);
+	} catch(EmptyBoxException&) {
+		c.root().set_empty();
+	}
+	return c.root();
+}
+
 void Eval::vector_fwd(const ExprVector& v, const ExprLabel** compL, ExprLabel& y) {
 
 	assert(v.type()!=Dim::SCALAR);
@@ -44,6 +44,13 @@ public:
 	 */
 	Domain& eval(const Function&, const IntervalVector& box) const;
 
+	/**
+	 * \brief Run the forward algorithm with an input box, in the context \a c.
+	 *
+	 * The function is not modified (see #ibex::EvalContext).
+	 */
+	Domain& eval(const Function&, const IntervalVector& box, EvalContext& c) const;
+
 	inline void index_fwd(const ExprIndex&, const ExprLabel& x, ExprLabel& y);
 	       void vector_fwd(const ExprVector&, const ExprLabel** compL, ExprLabel& y);
 	inline void cst_fwd(const ExprConstant&, ExprLabel& y);
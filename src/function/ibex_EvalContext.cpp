@@ -0,0 +1,142 @@
+/* ============================================================================
+ * I B E X - Evaluation context of a function
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : IBEX contributors
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "ibex_EvalContext.h"
+#include "ibex_Exception.h"
+#include "ibex_ScalarTape.h"
+
+#include <map>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+/*
+ * Decorates the labels of a context instead of the nodes.
+ */
+class ContextDecorator : public Decorator {
+public:
+	ContextDecorator(const NodeMap<int>& pos, ExprLabel* labels) : pos(pos), labels(labels) { }
+
+protected:
+	ExprLabel& label(const ExprNode& e) {
+		return labels[pos[e]];
+	}
+
+	const NodeMap<int>& pos;
+	ExprLabel* labels;
+};
+
+} // end anonymous namespace
+
+EvalContext::EvalContext(const Function& f) : f(f), args(NULL),
+		slot(f.cf.scalar_tape()? new Interval[f.cf.scalar_tape()->nb_slots()] : NULL), size(f.nb_nodes()), labels(NULL),
+		arg_domains(f.nb_arg()), arg_deriv(f.nb_arg()) {
+
+	int n=f.nb_nodes();
+
+	// position of each node in the compiled function
+	NodeMap<int> pos;
+	for (int i=0; i<n; i++) {
+		if (dynamic_cast<const ExprApply*>(&f.node(i)))
+			ibex_error("EvalContext: function calls are not supported");
+		pos.insert(f.node(i),i);
+	}
+
+	// the symbols that do not occur in the expression
+	// are put after the nodes
+	for (int i=0; i<f.nb_arg(); i++) {
+		if (!pos.found(f.arg(i)))
+			pos.insert(f.arg(i),size++);
+	}
+
+	labels=new ExprLabel[size];
+
+	ContextDecorator(pos,labels).decorate(f.args(),f.expr());
+
+	// position of the label of each node in the compiled function
+	map<const ExprLabel*,int> label_pos;
+	for (int i=0; i<n; i++)
+		label_pos.insert(pair<const ExprLabel*,int>(&f.node(i).deco,i));
+
+	args=new ExprLabel**[n];
+	for (int i=0; i<n; i++) {
+		int nb_args=f.cf.nb_args[i];
+		args[i]=new ExprLabel*[nb_args+1];
+		for (int j=0; j<=nb_args; j++)
+			args[i][j]=&labels[label_pos[f.cf.args[i][j]]];
+	}
+
+	for (int i=0; i<f.nb_arg(); i++) {
+		arg_domains.set_ref(i,*labels[pos[f.arg(i)]].d);
+		arg_deriv.set_ref(i,*labels[pos[f.arg(i)]].g);
+	}
+
+	// the used variables are generated now (and not by the
+	// first call to write_arg_domains, that may be concurrent)
+	f.nb_used_vars();
+}
+
+EvalContext::~EvalContext() {
+	for (int i=0; i<f.nb_nodes(); i++)
+		delete[] args[i];
+	delete[] args;
+	delete[] labels;
+	if (slot) delete[] slot;
+}
+
+void EvalContext::write_arg_domains(const IntervalVector& box, bool grad) {
+	if (f.all_args_scalar()) {
+		int j;
+		if (grad)
+			for (int i=0; i<f.nb_used_vars(); i++) {
+				j=f.used_var(i);
+				arg_deriv[j].i()=box[j];
+			}
+		else
+			for (int i=0; i<f.nb_used_vars(); i++) {
+				j=f.used_var(i);
+				arg_domains[j].i()=box[j];
+			}
+	}
+	else
+		load(grad? arg_deriv : arg_domains, box, f.nb_used_vars(), f._used_var);
+}
+
+void EvalContext::write_arg_domains(const Array<const Domain>& d, bool grad) {
+	load(grad? arg_deriv : arg_domains, d, f.nb_used_vars(), f._used_var);
+}
+
+void EvalContext::read_arg_domains(IntervalVector& box, bool grad) const {
+	if (f.all_args_scalar()) {
+		int j;
+		if (grad)
+			for (int i=0; i<f.nb_used_vars(); i++) {
+				j=f.used_var(i);
+				box[j]=arg_deriv[j].i();
+			}
+		else
+			for (int i=0; i<f.nb_used_vars(); i++) {
+				j=f.used_var(i);
+				box[j]=arg_domains[j].i();
+			}
+	}
+	else
+		load(box, grad? arg_deriv : arg_domains, f.nb_used_vars(), f._used_var);
+}
+
+void EvalContext::read_arg_domains(Array<Domain>& d, bool grad) const {
+	load(d, grad? arg_deriv : arg_domains, f.nb_used_vars(), f._used_var);
+}
+
+} // end namespace ibex
@@ -0,0 +1,156 @@
+/* ============================================================================
+ * I B E X - Evaluation context of a function
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : IBEX contributors
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __IBEX_EVAL_CONTEXT_H__
+#define __IBEX_EVAL_CONTEXT_H__
+
+#include "ibex_Function.h"
+
+namespace ibex {
+
+/**
+ * \ingroup symbolic
+ *
+ * \brief Evaluation context (workspace) of a function.
+ *
+ * The forward/backward algorithms (#ibex::Eval, #ibex::Gradient, #ibex::HC4Revise)
+ * store intermediate domains in the decorations of the nodes (see #ibex::ExprNode::deco).
+ * These decorations are shared by all the users of a function, so that two threads cannot
+ * evaluate the same function at the same time.
+ *
+ * An evaluation context owns its own copy of these labels, in a flat array indexed
+ * by the position of the nodes in the compiled function (see #ibex::Function::node(int)).
+ * Evaluating a function with a context does not modify the function: several threads
+ * can call (for instance) f.eval(box,c1) and f.eval(box,c2) at the same time, provided
+ * that each thread has its own context.
+ *
+ * Example:
+ * \code
+ * EvalContext c(f);          // one context per thread
+ * Interval y=f.eval(box,c);
+ * f.gradient(box,g,c);
+ * HC4Revise().proj(f,Domain(Interval::ZERO),box,c);
+ * \endcode
+ *
+ * \note The context must be built before the threads are started (the construction
+ * of a context is not thread-safe). The same holds for the first call to
+ * #ibex::Fnc::nb_used_vars().
+ *
+ * \warning Functions that call other functions (see #ibex::ExprApply) are not supported.
+ */
+class EvalContext {
+public:
+	/**
+	 * \brief Create a context for the function f.
+	 */
+	EvalContext(const Function& f);
+
+	/**
+	 * \brief Delete *this.
+	 */
+	~EvalContext();
+
+	/**
+	 * \brief The label of the ith node of the function.
+	 */
+	ExprLabel& label(int i) const;
+
+	/**
+	 * \brief The domain of the root node (the result of the last forward evaluation).
+	 */
+	Domain& root() const;
+
+	/**
+	 * \brief Load domains into the arguments.
+	 *
+	 * \param grad - true<=>update "g" (gradient) false <=>update "d" (domain)
+	 */
+	void write_arg_domains(const IntervalVector& box, bool grad=false);
+
+	/**
+	 * \brief Load domains into the arguments.
+	 *
+	 * \param grad - true<=>update "g" (gradient) false <=>update "d" (domain)
+	 */
+	void write_arg_domains(const Array<const Domain>& d, bool grad=false);
+
+	/**
+	 * \brief Load the domains of the arguments into \a box.
+	 *
+	 * \param grad - true<=>read "g" (gradient) false <=>read "d" (domain)
+	 */
+	void read_arg_domains(IntervalVector& box, bool grad=false) const;
+
+	/**
+	 * \brief Load the domains of the arguments into \a d.
+	 *
+	 * \param grad - true<=>read "g" (gradient) false <=>read "d" (domain)
+	 */
+	void read_arg_domains(Array<Domain>& d, bool grad=false) const;
+
+	/**
+	 * \brief The function.
+	 */
+	const Function& f;
+
+	/**
+	 * \brief The labels of the arguments of the nodes (same structure as in
+	 * #ibex::CompiledFunction, but pointing to the labels of this context).
+	 */
+	ExprLabel*** args;
+
+	/**
+	 * \brief The slots of the scalar tape of the function (NULL if the
+	 * function is not scalar, see #ibex::ScalarTape).
+	 */
+	Interval* const slot;
+
+private:
+	EvalContext(const EvalContext&); // forbidden
+
+	/* Number of labels (the nodes of f and the symbols that do not occur in f) */
+	int size;
+
+	/* The labels */
+	ExprLabel* labels;
+
+	/* The domains of the arguments */
+	Array<Domain> arg_domains;
+
+	/* The derivatives of the arguments */
+	Array<Domain> arg_deriv;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline ExprLabel& EvalContext::label(int i) const {
+	return labels[i];
+}
+
+inline Domain& EvalContext::root() const {
+	return *labels[0].d;
+}
+
+template<class V>
+inline ExprLabel& Function::forward(const V& algo, EvalContext& c) const {
+	assert(&c.f==this);
+	return cf.forward<V>(algo,c.args);
+}
+
+template<class V>
+inline void Function::backward(const V& algo, EvalContext& c) const {
+	assert(&c.f==this);
+	cf.backward<V>(algo,c.args);
+}
+
+} // end namespace ibex
+
+#endif // __IBEX_EVAL_CONTEXT_H__
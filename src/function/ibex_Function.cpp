@@ -16,6 +16,9 @@
 #include "ibex_HC4Revise.h"
 #include "ibex_InHC4Revise.h"
 #include "ibex_Gradient.h"
+#include "ibex_EvalContext.h"
+#include "ibex_ScalarTape.h"
+#include "ibex_SparseJacobian.h"
 #include "ibex_FunctionBuild.cpp_"
 
 using namespace std;
@@ -57,6 +60,18 @@ Domain& Function::eval_domain(const IntervalVector& box) const {
 }
 
 
+void Function::eval_batch(const IntervalMatrix& x, IntervalVector& y) const {
+	assert(x.nb_rows()==nb_var());
+	assert(y.size()==x.nb_cols());
+
+	const ScalarTape* tape=cf.scalar_tape();
+	if (tape)
+		tape->forward(x,y);
+	else
+		for (int k=0; k<x.nb_cols(); k++)
+			y[k]=eval(x.col(k));
+}
+
 Domain& Function::eval_affine2_domain(const IntervalVector& box) const {
 	return Affine2Eval().eval(*this,box);
 }
@@ -207,6 +222,28 @@ void Function::backward(const Domain& y, IntervalVector& x) const {
 	HC4Revise().proj(*this,y,x);
 }
 
+Domain& Function::eval_domain(const IntervalVector& box, EvalContext& c) const {
+	return Eval().eval(*this,box,c);
+}
+
+Interval Function::eval(const IntervalVector& box, EvalContext& c) const {
+	return eval_domain(box,c).i();
+}
+
+IntervalVector Function::eval_vector(const IntervalVector& box, EvalContext& c) const {
+	return expr().dim.is_scalar() ? IntervalVector(1,eval_domain(box,c).i()) : eval_domain(box,c).v();
+}
+
+void Function::gradient(const IntervalVector& x, IntervalVector& g, EvalContext& c) const {
+	assert(g.size()==nb_var());
+	assert(x.size()==nb_var());
+	Gradient().gradient(*this,x,g,c);
+}
+
+void Function::backward(const Domain& y, IntervalVector& x, EvalContext& c) const {
+	HC4Revise().proj(*this,y,x,c);
+}
+
 void Function::ibwd(const Domain& y, IntervalVector& x) const {
 	InHC4Revise().ibwd(*this,y,x);
 }
@@ -236,6 +273,32 @@ void Function::jacobian(const IntervalVector& x, IntervalMatrix& J) const {
 	}
 }
 
+void Function::jacobian(const IntervalVector& x, SparseJacobian& J) const {
+	assert(x.size()==nb_var());
+	assert(J.nb_rows()==image_dim() && J.nb_cols()==nb_var());
+
+	const ScalarTape* tape=cf.vector_tape();
+
+	if (tape && tape->jacobian(x,J._color,J._nb_colors,J.compressed)) {
+		// decompression: the entry (i,j) is the derivative of
+		// the ith component in the direction of the color of j
+		for (int i=0; i<J.m; i++) {
+			const Interval* Ci=&J.compressed[i*J._nb_colors];
+			for (int k=J._row_begin[i]; k<J._row_begin[i+1]; k++)
+				J._val[k]=Ci[J._color[J._col[k]]];
+		}
+		return;
+	}
+
+	// calculate the gradient of each component of f
+	IntervalVector g(nb_var());
+	for (int i=0; i<J.m; i++) {
+		(J.m==1? *this : (*this)[i]).gradient(x,g);
+		for (int k=J._row_begin[i]; k<J._row_begin[i+1]; k++)
+			J._val[k]=g[J._col[k]];
+	}
+}
+
 void Function::print(std::ostream& os) const {
 	if (name!=NULL) os << name << ":";
 	os << "(";
@@ -24,6 +24,8 @@
 namespace ibex {
 
 class System;
+class EvalContext;
+class SparseJacobian;
 
 /**
  * \ingroup function
@@ -417,15 +419,18 @@ public:
 	/**
 	 * \brief Copy mode (see copy constructor)
 	 */
-	typedef enum { COPY, DIFF } copy_mode;
+	typedef enum { COPY, DIFF, SIMPLIFY } copy_mode;
 
 	/**
 	 * \brief Build a function from another function.
 	 *
 	 * The new function can either be a clone of the function
-	 * in argument (COPY mode), or its differential (DIFF mode).
+	 * in argument (COPY mode), its differential (DIFF mode)
+	 * or a simplified clone (SIMPLIFY mode): constant subexpressions
+	 * are folded and common subexpressions are shared
+	 * (see #ibex::ExprCopy::copy(const Array<const ExprSymbol>&, const Array<const ExprSymbol>&, const ExprNode&, bool)).
 	 *
-	 * \param mode: either Function::COPY or Function::DIFF.
+	 * \param mode: either Function::COPY, Function::DIFF or Function::SIMPLIFY.
 	 *
 	 * The resulting function is independent from *this
 	 * (no reference shared). In particular, in copy mode,
@@ -540,6 +545,20 @@ public:
 	template<class V>
 	void backward(const V& algo) const;
 
+	/**
+	 * \brief Run a forward algorithm with the labels of the context \a c.
+	 *
+	 * The nodes of the function are not modified (see #ibex::EvalContext).
+	 */
+	template<class V>
+	ExprLabel& forward(const V& algo, EvalContext& c) const;
+
+	/**
+	 * \brief Run a backward algorithm with the labels of the context \a c.
+	 */
+	template<class V>
+	void backward(const V& algo, EvalContext& c) const;
+
 	// ======================== for Forward/Backward algorithms ====================
 
 	/**
@@ -621,11 +640,35 @@ public:
 	virtual void jacobian(const IntervalVector& x, IntervalMatrix& J) const;
 	// =============================================================================
 
+	/**
+	 * \brief Calculate the Jacobian matrix of f, in sparse form.
+	 *
+	 * If f is a vector of scalar expressions (see #ibex::ScalarTape), the
+	 * matrix is obtained in a single forward sweep of the expression, with
+	 * J.nb_colors() derivatives per node (one per color of variables).
+	 * Otherwise, the gradient of each component is calculated separately.
+	 *
+	 * \param J - the matrix, built with this function (see #ibex::SparseJacobian).
+	 */
+	void jacobian(const IntervalVector& x, SparseJacobian& J) const;
+
 	/**
 	 * \brief Calculate f(box) using interval arithmetic.
 	 */
 	Domain& eval_domain(const IntervalVector& box) const;
 
+	/**
+	 * \brief Calculate f on several boxes using interval arithmetic.
+	 *
+	 * The kth column of \a x is the kth box (\a x has nb_var() rows)
+	 * and f(kth box) is stored in \a y[k]. If f is scalar
+	 * (see #ibex::ScalarTape), each operation of f is performed
+	 * once for all the boxes.
+	 *
+	 * \pre f must be real-valued and \a y must have as many components as \a x has columns.
+	 */
+	void eval_batch(const IntervalMatrix& x, IntervalVector& y) const;
+
 	/**
 	 * \brief Calculate f(box) using affine arithmetic.
 	 */
@@ -731,6 +774,42 @@ public:
 	 */
 	void backward(const IntervalMatrix& y, IntervalVector& x) const;
 
+	// ================== thread-safe variants (see EvalContext) ==================
+
+	/**
+	 * \brief Calculate f(box) using interval arithmetic, in the context \a c.
+	 */
+	Domain& eval_domain(const IntervalVector& box, EvalContext& c) const;
+
+	/**
+	 * \brief Calculate f(box) using interval arithmetic, in the context \a c.
+	 *
+	 * \pre f must be real-valued
+	 */
+	Interval eval(const IntervalVector& box, EvalContext& c) const;
+
+	/**
+	 * \brief Calculate f(box) using interval arithmetic, in the context \a c.
+	 *
+	 * \pre f must be vector-valued
+	 */
+	IntervalVector eval_vector(const IntervalVector& box, EvalContext& c) const;
+
+	/**
+	 * \brief Calculate the gradient of f on the box \a x, in the context \a c.
+	 *
+	 * \pre f must be real-valued
+	 */
+	void gradient(const IntervalVector& x, IntervalVector& g, EvalContext& c) const;
+
+	/**
+	 * \brief Contract x w.r.t. f(x)=y, in the context \a c.
+	 * \throw EmptyBoxException if x is empty.
+	 */
+	void backward(const Domain& y, IntervalVector& x, EvalContext& c) const;
+
+	// ============================================================================
+
 	/**
 	 * \brief Inner projection f(x)=y onto x.
 	 */
@@ -813,6 +892,8 @@ private:
 
 	Function& operator=(const Function&);       // forbidden
 
+	friend class EvalContext;
+
 	/*
 	 * \brief Apply default Decoration (and compile) the function.
 	 *
@@ -11,6 +11,7 @@
 
 #include "ibex_Gradient.h"
 #include "ibex_Eval.h"
+#include "ibex_EvalContext.h"
 
 namespace ibex {
 
@@ -64,6 +65,28 @@ void Gradient::gradient(const Function& f, const IntervalVector& box, IntervalVe
 	f.read_arg_domains(g,true);
 }
 
+void Gradient::gradient(const Function& f, const IntervalVector& box, IntervalVector& g, EvalContext& c) const {
+	assert(f.expr().dim.is_scalar());
+
+	Eval().eval(f,box,c);
+
+	g.clear();
+
+	c.write_arg_domains(g,true);
+
+	try {
+		f.forward<Gradient>(*this,c);
+	} catch(EmptyBoxException&) {
+		g.set_empty();
+		return;
+	}
+
+	c.label(0).g->i()=1.0;
+
+	f.backward<Gradient>(*this,c);
+
+	c.read_arg_domains(g,true);
+}
 
 void Gradient::jacobian(const Function& f, const Array<Domain>& d, IntervalMatrix& J) const {
 	assert(f.expr().dim.is_vector());
@@ -34,6 +34,13 @@ public:
 	 */
 	void gradient(const Function& f, const IntervalVector& box, IntervalVector& g) const;
 
+	/**
+	 * \brief Calculate the gradient of f on the box \a box, in the context \a c.
+	 *
+	 * The function is not modified (see #ibex::EvalContext).
+	 */
+	void gradient(const Function& f, const IntervalVector& box, IntervalVector& g, EvalContext& c) const;
+
 	/**
 	 * \brief Calculate the Jacobian on the domains \a d and store the result in \a J.
 	 */
@@ -11,12 +11,14 @@
 #include "ibex_HC4Revise.h"
 #include "ibex_Eval.h"
 #include "ibex_Affine2Eval.h"
+#include "ibex_EvalContext.h"
+#include "ibex_ScalarTape.h"
 
 namespace ibex {
 
 const double HC4Revise::RATIO = 0.1;
 
-HC4Revise::HC4Revise(FwdMode mode) : fwd_mode(mode) {
+HC4Revise::HC4Revise(FwdMode mode, bool tape, bool incremental) : fwd_mode(mode), tape(tape), incremental(incremental), empty(false) {
 
 }
 
@@ -33,13 +35,33 @@ HC4Revise::HC4Revise(FwdMode mode) : fwd_mode(mode) {
 #define EVAL(f,x) if (fwd_mode==INTERVAL_MODE) Eval().eval(f,x); else Affine2Eval().eval(f,x);
 
 bool HC4Revise::proj(const Function& f, const Domain& y, IntervalVector& x) {
-	EVAL(f,x);
+	bool inactive=try_proj(f,y,x);
+	if (x.is_empty()) throw EmptyBoxException();
+	return inactive;
+}
+
+bool HC4Revise::try_proj(const Function& f, const Domain& y, IntervalVector& x) {
+	empty=false;
+
+	if (tape && fwd_mode==INTERVAL_MODE) {
+		const ScalarTape* t=f.cf.scalar_tape();
+		if (t) return proj(*t,y.i(),x,t->slot);
+	}
+
+	try {
+		EVAL(f,x);
+	} catch(EmptyBoxException&) {
+		// only with affine arithmetic
+		// (interval evaluation catches the exception)
+		x.set_empty();
+		return false;
+	}
 
 	//std::cout << "forward:" << std::endl; f.cf.print();
 
 	Domain& root=*f.expr().deco.d;
 
-	if (root.is_empty()) { x.set_empty(); throw EmptyBoxException(); }
+	if (root.is_empty()) { x.set_empty(); return false; }
 
 	switch(y.dim.type()) {
 	case Dim::SCALAR:       if (root.i().is_subset(y.i())) return true; break;
@@ -51,23 +73,94 @@ bool HC4Revise::proj(const Function& f, const Domain& y, IntervalVector& x) {
 
 	root &= y;
 
-	f.backward<HC4Revise>(*this);
+	try {
+		f.backward<HC4Revise>(*this);
+	} catch(EmptyBoxException&) {
+		// only with affine arithmetic
+		// (forward evaluation of a function call)
+		empty=true;
+	}
 
 	//std::cout << "backward:" << std::endl; f.cf.print();
 
+	if (empty) { x.set_empty(); return false; }
+
 	f.read_arg_domains(x);
 
 	return false;
 }
 
+bool HC4Revise::proj(const Function& f, const Domain& y, IntervalVector& x, EvalContext& c) {
+	bool inactive=try_proj(f,y,x,c);
+	if (x.is_empty()) throw EmptyBoxException();
+	return inactive;
+}
+
+bool HC4Revise::try_proj(const Function& f, const Domain& y, IntervalVector& x, EvalContext& c) {
+	empty=false;
+
+	if (tape) {
+		const ScalarTape* t=f.cf.scalar_tape();
+		if (t) return proj(*t,y.i(),x,c.slot);
+	}
+
+	Eval().eval(f,x,c);
+
+	Domain& root=c.root();
+
+	if (root.is_empty()) { x.set_empty(); return false; }
+
+	switch(y.dim.type()) {
+	case Dim::SCALAR:       if (root.i().is_subset(y.i())) return true; break;
+	case Dim::ROW_VECTOR:
+	case Dim::COL_VECTOR:   if (root.v().is_subset(y.v())) return true; break;
+	case Dim::MATRIX:       if (root.m().is_subset(y.m())) return true; break;
+	case Dim::MATRIX_ARRAY: assert(false); /* impossible */ break;
+	}
+
+	root &= y;
+
+	f.backward<HC4Revise>(*this,c);
+
+	if (empty) { x.set_empty(); return false; }
+
+	c.read_arg_domains(x);
+
+	return false;
+}
+
+bool HC4Revise::proj(const ScalarTape& tape, const Interval& y, IntervalVector& x, Interval* slot) {
+
+	// the domains kept in the tape are only used with its own slots
+	bool inc=incremental && slot==tape.slot;
+
+	if (!(inc? tape.incremental_forward(x,slot) : tape.forward(x,slot))) { x.set_empty(); return false; }
+
+	Interval& root=tape.root(slot);
+
+	if (root.is_empty()) { x.set_empty(); return false; }
+
+	if (root.is_subset(y)) return true;
+
+	root &= y;
+
+	if (!(inc? tape.incremental_backward(slot) : tape.backward(slot))) { empty=true; x.set_empty(); return false; }
+
+	tape.read(slot,x);
+
+	return false;
+}
+
 void HC4Revise::proj(const Function& f, const Domain& y, ExprLabel** x) {
 	EVAL(f,x);
 	*f.expr().deco.d &= y;
 
-	// if next instruction throws an EmptyBoxException,
-	// it will be caught by proj(...,IntervalVector& x).
+	// if the projection is empty, the backward phase
+	// of the caller is interrupted as well.
 	f.backward<HC4Revise>(*this);
 
+	if (empty) return;
+
 	Array<Domain> argD(f.nb_arg());
 
 	for (int i=0; i<f.nb_arg(); i++) {
@@ -80,16 +173,16 @@ void HC4Revise::proj(const Function& f, const Domain& y, ExprLabel** x) {
 void HC4Revise::vector_bwd(const ExprVector& v, ExprLabel** compL, const ExprLabel& y) {
 	if (v.dim.is_vector()) {
 		for (int i=0; i<v.length(); i++)
-			if ((compL[i]->d->i() &= y.d->v()[i]).is_empty()) throw EmptyBoxException();
+			if ((compL[i]->d->i() &= y.d->v()[i]).is_empty()) { interrupt(); return; }
 	}
 	else {
 		if (v.row_vector())
 			for (int i=0; i<v.length(); i++) {
-				if ((compL[i]->d->v()&=y.d->m().col(i)).is_empty()) throw EmptyBoxException();
+				if ((compL[i]->d->v()&=y.d->m().col(i)).is_empty()) { interrupt(); return; }
 			}
 		else
 			for (int i=0; i<v.length(); i++) {
-				if ((compL[i]->d->v()&=y.d->m().row(i)).is_empty()) throw EmptyBoxException();
+				if ((compL[i]->d->v()&=y.d->m().row(i)).is_empty()) { interrupt(); return; }
 			}
 	}
 }
@@ -31,8 +31,18 @@ public:
 	 *
 	 * \param mode  the arithmetic for forward evaluation. By default: interval arithmetic.
 	 * Accepted values are: INTERVAL_MODE or AFFINE2_MODE.
+	 * \param tape  if true, a scalar function is projected (in interval mode) on
+	 * its scalar tape (see #ibex::ScalarTape), which is faster. The result is the same
+	 * but the labels of the function (or of the evaluation context) are then not updated:
+	 * the domains of the nodes after the projection are only in the tape.
+	 * By default: false.
+	 * \param incremental  if true (by default), the forward evaluation on the tape
+	 * only recalculates the nodes that depend on the variables whose
+	 * domain has changed since the last projection of this function, and the backward
+	 * phase skips the nodes that are not narrowed (see #ibex::ScalarTape::incremental_forward).
+	 * The result is the same. Not used when an evaluation context is given.
 	 */
-	HC4Revise(FwdMode mode=INTERVAL_MODE);
+	HC4Revise(FwdMode mode=INTERVAL_MODE, bool tape=false, bool incremental=true);
 
 	//void bwd(const Function& f, const Domain& y, Array<Domain>& x);
 
@@ -47,6 +57,39 @@ public:
 	 */
 	bool proj(const Function& f, const Domain& y, IntervalVector& x);
 
+	/**
+	 * \brief Project f(x)=y onto x, without exception.
+	 *
+	 * Same as #proj(const Function&, const Domain&, IntervalVector&) except that
+	 * no #ibex::EmptyBoxException is thrown: if the projection is empty, x is just
+	 * set to the empty set (and false is returned).
+	 */
+	bool try_proj(const Function& f, const Domain& y, IntervalVector& x);
+
+	/**
+	 * \brief Project f(x)=y onto x, in the context \a c.
+	 *
+	 * Same as #proj(const Function&, const Domain&, IntervalVector&) but the function
+	 * is not modified (see #ibex::EvalContext).
+	 *
+	 * \note The forward evaluation is always performed with interval arithmetic.
+	 */
+	bool proj(const Function& f, const Domain& y, IntervalVector& x, EvalContext& c);
+
+	/**
+	 * \brief Project f(x)=y onto x, in the context \a c, without exception.
+	 *
+	 * \see #try_proj(const Function&, const Domain&, IntervalVector&).
+	 */
+	bool try_proj(const Function& f, const Domain& y, IntervalVector& x, EvalContext& c);
+
+	/**
+	 * \brief True if the last backward phase has found an empty projection.
+	 *
+	 * The backward phase is then stopped (see #ibex::BwdAlgorithm::interrupted()).
+	 */
+	bool interrupted() const;
+
 	/**
 	 * \brief Ratio for the contraction of a
 	 * matrix-vector / matrix-matrix multiplication.
@@ -59,51 +102,81 @@ public:
 	inline void symbol_bwd(const ExprSymbol& , const ExprLabel& )                             { /* nothing to do */ }
 	inline void cst_bwd   (const ExprConstant&, const ExprLabel& )                                  { /* nothing to do */ }
 	inline void apply_bwd (const ExprApply& a, ExprLabel** x, const ExprLabel& y)                   { proj(a.func,*y.d,x); }
-	inline void chi_bwd   (const ExprChi&,ExprLabel& a,ExprLabel& b,ExprLabel& c,const ExprLabel& f){ if (!(bwd_chi(f.d->i(),a.d->i(),b.d->i(),c.d->i()))) throw EmptyBoxException();  }
-	inline void add_bwd   (const ExprAdd&,     ExprLabel& x1, ExprLabel& x2, const ExprLabel& y)    { if (!(bwd_add(y.d->i(),x1.d->i(),x2.d->i()))) throw EmptyBoxException();  }
-	inline void add_V_bwd  (const ExprAdd&,    ExprLabel& x1, ExprLabel& x2, const ExprLabel& y)    { if (!(bwd_add(y.d->v(),x1.d->v(),x2.d->v()))) throw EmptyBoxException();  }
-	inline void add_M_bwd  (const ExprAdd&,    ExprLabel& x1, ExprLabel& x2, const ExprLabel& y)    { if (!(bwd_add(y.d->m(),x1.d->m(),x2.d->m()))) throw EmptyBoxException();  }
-	inline void mul_bwd    (const ExprMul&,    ExprLabel& x1, ExprLabel& x2, const ExprLabel& y)    { if (!(bwd_mul(y.d->i(),x1.d->i(),x2.d->i()))) throw EmptyBoxException();  }
-	inline void mul_SV_bwd (const ExprMul&,    ExprLabel& x1, ExprLabel& x2, const ExprLabel& y)    { if (!(bwd_mul(y.d->v(),x1.d->i(),x2.d->v()))) throw EmptyBoxException();  }
-	inline void mul_SM_bwd (const ExprMul&,    ExprLabel& x1, ExprLabel& x2, const ExprLabel& y)    { if (!(bwd_mul(y.d->m(),x1.d->i(),x2.d->m()))) throw EmptyBoxException();  }
-	inline void mul_VV_bwd (const ExprMul&,    ExprLabel& x1, ExprLabel& x2, const ExprLabel& y)    { if (!(bwd_mul(y.d->i(),x1.d->v(),x2.d->v()))) throw EmptyBoxException();  }
-	inline void mul_MV_bwd (const ExprMul&,    ExprLabel& x1, ExprLabel& x2, const ExprLabel& y)    { if (!(bwd_mul(y.d->v(),x1.d->m(),x2.d->v(), RATIO))) throw EmptyBoxException();  }
-	inline void mul_VM_bwd (const ExprMul&,    ExprLabel& x1, ExprLabel& x2, const ExprLabel& y)    { if (!(bwd_mul(y.d->v(),x1.d->v(),x2.d->m(), RATIO))) throw EmptyBoxException();  }
-	inline void mul_MM_bwd (const ExprMul&,    ExprLabel& x1, ExprLabel& x2, const ExprLabel& y)    { if (!(bwd_mul(y.d->m(),x1.d->m(),x2.d->m(), RATIO))) throw EmptyBoxException();  }
-	inline void sub_bwd   (const ExprSub&,     ExprLabel& x1, ExprLabel& x2, const ExprLabel& y)    { if (!(bwd_sub(y.d->i(),x1.d->i(),x2.d->i()))) throw EmptyBoxException();  }
-	inline void sub_V_bwd (const ExprSub&,     ExprLabel& x1, ExprLabel& x2, const ExprLabel& y)    { if (!(bwd_sub(y.d->v(),x1.d->v(),x2.d->v()))) throw EmptyBoxException();  }
-	inline void sub_M_bwd (const ExprSub&,     ExprLabel& x1, ExprLabel& x2, const ExprLabel& y)    { if (!(bwd_sub(y.d->m(),x1.d->m(),x2.d->m()))) throw EmptyBoxException();  }
-	inline void div_bwd   (const ExprDiv&,     ExprLabel& x1, ExprLabel& x2, const ExprLabel& y)    { if (!(bwd_div(y.d->i(),x1.d->i(),x2.d->i()))) throw EmptyBoxException();  }
-	inline void max_bwd   (const ExprMax&,     ExprLabel& x1, ExprLabel& x2, const ExprLabel& y)    { if (!(bwd_max(y.d->i(),x1.d->i(),x2.d->i()))) throw EmptyBoxException();  }
-	inline void min_bwd   (const ExprMin&,     ExprLabel& x1, ExprLabel& x2, const ExprLabel& y)    { if (!(bwd_min(y.d->i(),x1.d->i(),x2.d->i()))) throw EmptyBoxException();  }
-	inline void atan2_bwd (const ExprAtan2& , ExprLabel& x1, ExprLabel& x2, const ExprLabel& y)    { if (!(bwd_atan2(y.d->i(),x1.d->i(),x2.d->i()))) throw EmptyBoxException();  }
-	inline void minus_bwd (const ExprMinus& , ExprLabel& x, const ExprLabel& y)                    { if ((x.d->i() &=-y.d->i()).is_empty()) throw EmptyBoxException();  }
-    inline void trans_V_bwd(const ExprTrans& ,ExprLabel& x, const ExprLabel& y)                    { if ((x.d->v() &= y.d->v()).is_empty()) throw EmptyBoxException();  }
-    inline void trans_M_bwd(const ExprTrans& ,ExprLabel& x, const ExprLabel& y)                    { if ((x.d->m() &= y.d->m().transpose()).is_empty()) throw EmptyBoxException();  }
-	inline void sign_bwd  (const ExprSign& ,  ExprLabel& x, const ExprLabel& y)                    { if (!(bwd_sign(y.d->i(),x.d->i()))) throw EmptyBoxException();  }
-	inline void abs_bwd   (const ExprAbs& ,   ExprLabel& x, const ExprLabel& y)                    { if (!(bwd_abs(y.d->i(),x.d->i()))) throw EmptyBoxException();  }
-	inline void power_bwd (const ExprPower& e, ExprLabel& x, const ExprLabel& y)                    { if (!(bwd_pow(y.d->i(),e.expon, x.d->i()))) throw EmptyBoxException();  }
-	inline void sqr_bwd   (const ExprSqr& ,   ExprLabel& x, const ExprLabel& y)                    { if (!(bwd_sqr(y.d->i(),x.d->i()))) throw EmptyBoxException();  }
-	inline void sqrt_bwd  (const ExprSqrt& ,  ExprLabel& x, const ExprLabel& y)                    { if (!(bwd_sqrt(y.d->i(),x.d->i()))) throw EmptyBoxException();  }
-	inline void exp_bwd   (const ExprExp& ,   ExprLabel& x, const ExprLabel& y)                    { if (!(bwd_exp(y.d->i(),x.d->i()))) throw EmptyBoxException();  }
-	inline void log_bwd   (const ExprLog& ,   ExprLabel& x, const ExprLabel& y)                    { if (!(bwd_log(y.d->i(),x.d->i()))) throw EmptyBoxException();  }
-	inline void cos_bwd   (const ExprCos& ,   ExprLabel& x, const ExprLabel& y)                    { if (!(bwd_cos(y.d->i(),x.d->i()))) throw EmptyBoxException();  }
-	inline void sin_bwd   (const ExprSin& ,   ExprLabel& x, const ExprLabel& y)                    { if (!(bwd_sin(y.d->i(),x.d->i()))) throw EmptyBoxException();  }
-	inline void tan_bwd   (const ExprTan& ,   ExprLabel& x, const ExprLabel& y)                    { if (!(bwd_tan(y.d->i(),x.d->i()))) throw EmptyBoxException();  }
-	inline void cosh_bwd  (const ExprCosh& ,  ExprLabel& x, const ExprLabel& y)                    { if (!(bwd_cosh(y.d->i(),x.d->i()))) throw EmptyBoxException();  }
-	inline void sinh_bwd  (const ExprSinh& ,  ExprLabel& x, const ExprLabel& y)                    { if (!(bwd_sinh(y.d->i(),x.d->i()))) throw EmptyBoxException();  }
-	inline void tanh_bwd  (const ExprTanh& ,  ExprLabel& x, const ExprLabel& y)                    { if (!(bwd_tanh(y.d->i(),x.d->i()))) throw EmptyBoxException();  }
-	inline void acos_bwd  (const ExprAcos& ,  ExprLabel& x, const ExprLabel& y)                    { if (!(bwd_acos(y.d->i(),x.d->i()))) throw EmptyBoxException();  }
-	inline void asin_bwd  (const ExprAsin& ,  ExprLabel& x, const ExprLabel& y)                    { if (!(bwd_asin(y.d->i(),x.d->i()))) throw EmptyBoxException();  }
-	inline void atan_bwd  (const ExprAtan& ,  ExprLabel& x, const ExprLabel& y)                    { if (!(bwd_atan(y.d->i(),x.d->i()))) throw EmptyBoxException();  }
-	inline void acosh_bwd (const ExprAcosh& , ExprLabel& x, const ExprLabel& y)                    { if (!(bwd_acosh(y.d->i(),x.d->i()))) throw EmptyBoxException();  }
-	inline void asinh_bwd (const ExprAsinh& , ExprLabel& x, const ExprLabel& y)                    { if (!(bwd_asinh(y.d->i(),x.d->i()))) throw EmptyBoxException();  }
-	inline void atanh_bwd (const ExprAtanh& , ExprLabel& x, const ExprLabel& y)                    { if (!(bwd_atanh(y.d->i(),x.d->i()))) throw EmptyBoxException();  }
+	inline void chi_bwd   (const ExprChi&,ExprLabel& a,ExprLabel& b,ExprLabel& c,const ExprLabel& f){ if (!(bwd_chi(f.d->i(),a.d->i(),b.d->i(),c.d->i()))) interrupt();  }
+	inline void add_bwd   (const ExprAdd&,     ExprLabel& x1, ExprLabel& x2, const ExprLabel& y)    { if (!(bwd_add(y.d->i(),x1.d->i(),x2.d->i()))) interrupt();  }
+	inline void add_V_bwd  (const ExprAdd&,    ExprLabel& x1, ExprLabel& x2, const ExprLabel& y)    { if (!(bwd_add(y.d->v(),x1.d->v(),x2.d->v()))) interrupt();  }
+	inline void add_M_bwd  (const ExprAdd&,    ExprLabel& x1, ExprLabel& x2, const ExprLabel& y)    { if (!(bwd_add(y.d->m(),x1.d->m(),x2.d->m()))) interrupt();  }
+	inline void mul_bwd    (const ExprMul&,    ExprLabel& x1, ExprLabel& x2, const ExprLabel& y)    { if (!(bwd_mul(y.d->i(),x1.d->i(),x2.d->i()))) interrupt();  }
+	inline void mul_SV_bwd (const ExprMul&,    ExprLabel& x1, ExprLabel& x2, const ExprLabel& y)    { if (!(bwd_mul(y.d->v(),x1.d->i(),x2.d->v()))) interrupt();  }
+	inline void mul_SM_bwd (const ExprMul&,    ExprLabel& x1, ExprLabel& x2, const ExprLabel& y)    { if (!(bwd_mul(y.d->m(),x1.d->i(),x2.d->m()))) interrupt();  }
+	inline void mul_VV_bwd (const ExprMul&,    ExprLabel& x1, ExprLabel& x2, const ExprLabel& y)    { if (!(bwd_mul(y.d->i(),x1.d->v(),x2.d->v()))) interrupt();  }
+	inline void mul_MV_bwd (const ExprMul&,    ExprLabel& x1, ExprLabel& x2, const ExprLabel& y)    { if (!(bwd_mul(y.d->v(),x1.d->m(),x2.d->v(), RATIO))) interrupt();  }
+	inline void mul_VM_bwd (const ExprMul&,    ExprLabel& x1, ExprLabel& x2, const ExprLabel& y)    { if (!(bwd_mul(y.d->v(),x1.d->v(),x2.d->m(), RATIO))) interrupt();  }
+	inline void mul_MM_bwd (const ExprMul&,    ExprLabel& x1, ExprLabel& x2, const ExprLabel& y)    { if (!(bwd_mul(y.d->m(),x1.d->m(),x2.d->m(), RATIO))) interrupt();  }
+	inline void sub_bwd   (const ExprSub&,     ExprLabel& x1, ExprLabel& x2, const ExprLabel& y)    { if (!(bwd_sub(y.d->i(),x1.d->i(),x2.d->i()))) interrupt();  }
+	inline void sub_V_bwd (const ExprSub&,     ExprLabel& x1, ExprLabel& x2, const ExprLabel& y)    { if (!(bwd_sub(y.d->v(),x1.d->v(),x2.d->v()))) interrupt();  }
+	inline void sub_M_bwd (const ExprSub&,     ExprLabel& x1, ExprLabel& x2, const ExprLabel& y)    { if (!(bwd_sub(y.d->m(),x1.d->m(),x2.d->m()))) interrupt();  }
+	inline void div_bwd   (const ExprDiv&,     ExprLabel& x1, ExprLabel& x2, const ExprLabel& y)    { if (!(bwd_div(y.d->i(),x1.d->i(),x2.d->i()))) interrupt();  }
+	inline void max_bwd   (const ExprMax&,     ExprLabel& x1, ExprLabel& x2, const ExprLabel& y)    { if (!(bwd_max(y.d->i(),x1.d->i(),x2.d->i()))) interrupt();  }
+	inline void min_bwd   (const ExprMin&,     ExprLabel& x1, ExprLabel& x2, const ExprLabel& y)    { if (!(bwd_min(y.d->i(),x1.d->i(),x2.d->i()))) interrupt();  }
+	inline void atan2_bwd (const ExprAtan2& , ExprLabel& x1, ExprLabel& x2, const ExprLabel& y)    { if (!(bwd_atan2(y.d->i(),x1.d->i(),x2.d->i()))) interrupt();  }
+	inline void minus_bwd (const ExprMinus& , ExprLabel& x, const ExprLabel& y)                    { if ((x.d->i() &=-y.d->i()).is_empty()) interrupt();  }
+    inline void trans_V_bwd(const ExprTrans& ,ExprLabel& x, const ExprLabel& y)                    { if ((x.d->v() &= y.d->v()).is_empty()) interrupt();  }
+    inline void trans_M_bwd(const ExprTrans& ,ExprLabel& x, const ExprLabel& y)                    { if ((x.d->m() &= y.d->m().transpose()).is_empty()) interrupt();  }
+	inline void sign_bwd  (const ExprSign& ,  ExprLabel& x, const ExprLabel& y)                    { if (!(bwd_sign(y.d->i(),x.d->i()))) interrupt();  }
+	inline void abs_bwd   (const ExprAbs& ,   ExprLabel& x, const ExprLabel& y)                    { if (!(bwd_abs(y.d->i(),x.d->i()))) interrupt();  }
+	inline void power_bwd (const ExprPower& e, ExprLabel& x, const ExprLabel& y)                    { if (!(bwd_pow(y.d->i(),e.expon, x.d->i()))) interrupt();  }
+	inline void sqr_bwd   (const ExprSqr& ,   ExprLabel& x, const ExprLabel& y)                    { if (!(bwd_sqr(y.d->i(),x.d->i()))) interrupt();  }
+	inline void sqrt_bwd  (const ExprSqrt& ,  ExprLabel& x, const ExprLabel& y)                    { if (!(bwd_sqrt(y.d->i(),x.d->i()))) interrupt();  }
+	inline void exp_bwd   (const ExprExp& ,   ExprLabel& x, const ExprLabel& y)                    { if (!(bwd_exp(y.d->i(),x.d->i()))) interrupt();  }
+	inline void log_bwd   (const ExprLog& ,   ExprLabel& x, const ExprLabel& y)                    { if (!(bwd_log(y.d->i(),x.d->i()))) interrupt();  }
+	inline void cos_bwd   (const ExprCos& ,   ExprLabel& x, const ExprLabel& y)                    { if (!(bwd_cos(y.d->i(),x.d->i()))) interrupt();  }
+	inline void sin_bwd   (const ExprSin& ,   ExprLabel& x, const ExprLabel& y)                    { if (!(bwd_sin(y.d->i(),x.d->i()))) interrupt();  }
+	inline void tan_bwd   (const ExprTan& ,   ExprLabel& x, const ExprLabel& y)                    { if (!(bwd_tan(y.d->i(),x.d->i()))) interrupt();  }
+	inline void cosh_bwd  (const ExprCosh& ,  ExprLabel& x, const ExprLabel& y)                    { if (!(bwd_cosh(y.d->i(),x.d->i()))) interrupt();  }
+	inline void sinh_bwd  (const ExprSinh& ,  ExprLabel& x, const ExprLabel& y)                    { if (!(bwd_sinh(y.d->i(),x.d->i()))) interrupt();  }
+	inline void tanh_bwd  (const ExprTanh& ,  ExprLabel& x, const ExprLabel& y)                    { if (!(bwd_tanh(y.d->i(),x.d->i()))) interrupt();  }
+	inline void acos_bwd  (const ExprAcos& ,  ExprLabel& x, const ExprLabel& y)                    { if (!(bwd_acos(y.d->i(),x.d->i()))) interrupt();  }
+	inline void asin_bwd  (const ExprAsin& ,  ExprLabel& x, const ExprLabel& y)                    { if (!(bwd_asin(y.d->i(),x.d->i()))) interrupt();  }
+	inline void atan_bwd  (const ExprAtan& ,  ExprLabel& x, const ExprLabel& y)                    { if (!(bwd_atan(y.d->i(),x.d->i()))) interrupt();  }
+	inline void acosh_bwd (const ExprAcosh& , ExprLabel& x, const ExprLabel& y)                    { if (!(bwd_acosh(y.d->i(),x.d->i()))) interrupt();  }
+	inline void asinh_bwd (const ExprAsinh& , ExprLabel& x, const ExprLabel& y)                    { if (!(bwd_asinh(y.d->i(),x.d->i()))) interrupt();  }
+	inline void atanh_bwd (const ExprAtanh& , ExprLabel& x, const ExprLabel& y)                    { if (!(bwd_atanh(y.d->i(),x.d->i()))) interrupt();  }
 
 protected:
 	void proj(const Function& f, const Domain& y, ExprLabel** x);
+
+	/**
+	 * \brief Project f(x)=y onto x using the scalar tape of f.
+	 */
+	bool proj(const ScalarTape& tape, const Interval& y, IntervalVector& x, Interval* slot);
+
+	/**
+	 * \brief Stop the backward phase (empty projection).
+	 */
+	void interrupt();
+
 	FwdMode fwd_mode;
+
+	/* Forward-backward with the scalar tape */
+	bool tape;
+
+	/* Incremental forward-backward with the scalar tape */
+	bool incremental;
+
+	/* True if an empty projection has been found */
+	bool empty;
 };
 
+/*================================== inline implementations ========================================*/
+
+inline bool HC4Revise::interrupted() const {
+	return empty;
+}
+
+inline void HC4Revise::interrupt() {
+	empty=true;
+}
+
 } /* namespace ibex */
 #endif /* __IBEX_HC4_REVISE_H__ */
@@ -0,0 +1,464 @@
+/* ============================================================================
+ * I B E X - Scalar tape of a compiled function
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : IBEX contributors
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "ibex_ScalarTape.h"
+
+#include <vector>
+
+using namespace std;
+
+namespace ibex {
+
+ScalarTape::ScalarTape(int nb_slots, int size, int nb_vars, int nb_csts, int nb_roots) : slot(new Interval[nb_slots]),
+		_nb_slots(nb_slots), size(size), code(new Instr[size]), nb_vars(nb_vars),
+		var_slot(new int[nb_vars]), var_index(new int[nb_vars]), cst(new Interval[nb_csts]),
+		_nb_roots(nb_roots), root_slot(new int[nb_roots]) {
+
+}
+
+ScalarTape::~ScalarTape() {
+	delete[] slot;
+	delete[] code;
+	delete[] var_slot;
+	delete[] var_index;
+	delete[] cst;
+	delete[] root_slot;
+}
+
+ScalarTape* ScalarTape::build(const Array<const ExprSymbol>& x, const CompiledFunction& cf) {
+
+	int n=cf.n;
+
+	// offset of each argument in the box
+	vector<int> offset(x.size());
+	int box_size=0;
+	for (int k=0; k<x.size(); k++) {
+		offset[k]=box_size;
+		box_size+=x[k].dim.size();
+	}
+
+	NodeMap<int> pos;
+	for (int i=0; i<n; i++)
+		pos.insert(cf.nodes[i],i);
+
+	vector<int> slot(n,-1);           // slot of each node (-1 for vector symbols)
+	vector<int> var_slot(box_size,-1); // slot of each component of the box
+	int nb_vars=0;
+	int size=0;
+	int nb_csts=0;
+
+	// check that the function is scalar and
+	// assign the slots (from the leaves to the root)
+	for (int i=n-1; i>=0; i--) {
+		const ExprNode& e=cf.nodes[i];
+		int var=-1;
+
+		switch(cf.code[i]) {
+		case CompiledFunction::SYM:
+			if (e.dim.is_scalar()) var=offset[((const ExprSymbol&) e).key];
+			else if (!e.dim.is_vector()) return NULL;
+			// a vector symbol has no slot (it must be indexed)
+			break;
+		case CompiledFunction::IDX:
+		{
+			const ExprIndex& idx=(const ExprIndex&) e;
+			const ExprSymbol* s=dynamic_cast<const ExprSymbol*>(&idx.expr);
+			if (!s || !s->dim.is_vector() || !idx.dim.is_scalar()) return NULL;
+			var=offset[s->key]+idx.index;
+		}
+		break;
+		case CompiledFunction::CST:
+			if (!e.dim.is_scalar()) return NULL;
+			slot[i]=i; size++; nb_csts++;
+			break;
+		case CompiledFunction::VEC:
+			// only allowed at the root, with scalar components
+			if (i>0 || !e.dim.is_vector()) return NULL;
+			for (int j=0; j<((const ExprVector&) e).length(); j++)
+				if (!((const ExprVector&) e).arg(j).dim.is_scalar()) return NULL;
+			break;
+		case CompiledFunction::APPLY:
+		case CompiledFunction::ADD_V: case CompiledFunction::ADD_M:
+		case CompiledFunction::SUB_V: case CompiledFunction::SUB_M:
+		case CompiledFunction::MUL_SV: case CompiledFunction::MUL_SM: case CompiledFunction::MUL_VV:
+		case CompiledFunction::MUL_MV: case CompiledFunction::MUL_MM: case CompiledFunction::MUL_VM:
+		case CompiledFunction::TRANS_V: case CompiledFunction::TRANS_M:
+			return NULL;
+		default:
+			// scalar operator (the arguments are checked below)
+			if (!e.dim.is_scalar()) return NULL;
+			slot[i]=i; size++;
+		}
+
+		if (var!=-1) {
+			if (var_slot[var]==-1) {
+				var_slot[var]=i;
+				nb_vars++;
+			}
+			slot[i]=var_slot[var];
+		}
+	}
+
+	int nb_roots=cf.code[0]==CompiledFunction::VEC ? ((const ExprVector&) cf.nodes[0]).length() : 1;
+
+	// the root is a vector symbol
+	if (nb_roots==1 && slot[0]==-1) return NULL;
+
+	ScalarTape* tape=new ScalarTape(n,size,nb_vars,nb_csts,nb_roots);
+
+	int v=0;
+	for (int j=0; j<box_size; j++) {
+		if (var_slot[j]!=-1) {
+			tape->var_slot[v]=var_slot[j];
+			tape->var_index[v++]=j;
+		}
+	}
+
+	// slot of the ith argument of a node
+	#define ARG(e) slot[pos[e]]
+
+	int k=0;
+	int c=0;
+	for (int i=0; i<n; i++) {
+		if (cf.code[i]==CompiledFunction::SYM || cf.code[i]==CompiledFunction::IDX || cf.code[i]==CompiledFunction::VEC)
+			continue;
+
+		const ExprNode& e=cf.nodes[i];
+		Instr& instr=tape->code[k];
+		instr.x1=instr.x2=instr.x3=0;
+
+		switch(cf.code[i]) {
+		case CompiledFunction::CST:
+			tape->cst[c]=((const ExprConstant&) e).get_value();
+			instr.x1=c++;
+			break;
+		case CompiledFunction::CHI:
+		{
+			const ExprChi& chi=(const ExprChi&) e;
+			instr.x1=ARG(chi.arg(0));
+			instr.x2=ARG(chi.arg(1));
+			instr.x3=ARG(chi.arg(2));
+		}
+		break;
+		case CompiledFunction::ADD:   case CompiledFunction::MUL:   case CompiledFunction::SUB:
+		case CompiledFunction::DIV:   case CompiledFunction::MAX:   case CompiledFunction::MIN:
+		case CompiledFunction::ATAN2:
+		{
+			const ExprBinaryOp& b=(const ExprBinaryOp&) e;
+			instr.x1=ARG(b.left);
+			instr.x2=ARG(b.right);
+		}
+		break;
+		case CompiledFunction::POWER:
+		{
+			const ExprPower& p=(const ExprPower&) e;
+			instr.x1=ARG(p.expr);
+			instr.x2=p.expon;
+		}
+		break;
+		default:
+			instr.x1=ARG(((const ExprUnaryOp&) e).expr);
+		}
+
+		// an argument without slot is a vector symbol
+		// used without index (e.g., in x*x, where x is a vector)
+		if (instr.x1==-1 || (cf.code[i]!=CompiledFunction::POWER && (instr.x2==-1 || instr.x3==-1))) {
+			delete tape;
+			return NULL;
+		}
+
+		instr.op=cf.code[i];
+		instr.y=slot[i];
+		k++;
+	}
+
+	if (cf.code[0]==CompiledFunction::VEC) {
+		const ExprVector& vec=(const ExprVector&) cf.nodes[0];
+		for (int j=0; j<nb_roots; j++) {
+			// a component can be a vector symbol (e.g., (x,x[0]) with x vector)
+			if ((tape->root_slot[j]=ARG(vec.arg(j)))==-1) {
+				delete tape;
+				return NULL;
+			}
+		}
+	} else
+		tape->root_slot[0]=slot[0];
+
+	#undef ARG
+
+	assert(k==size);
+
+	return tape;
+}
+
+bool ScalarTape::incremental_forward(const IntervalVector& box, Interval* slot) const {
+
+	// the first time, all the nodes are evaluated
+	bool all=inc_slot.empty();
+	if (all) {
+		inc_slot.resize(_nb_slots);
+		inc_changed.resize(_nb_slots);
+	}
+
+	Interval* dom=&inc_slot[0];
+	char* changed=&inc_changed[0];
+
+	for (int v=0; v<nb_vars; v++) {
+		Interval& x=dom[var_slot[v]];
+		const Interval& b=box[var_index[v]];
+		changed[var_slot[v]]=(all || x!=b);
+		x=b;
+	}
+
+	for (int k=size-1; k>=0; k--) {
+		const Instr& c=code[k];
+		if (all || depends(c,changed)) {
+			Interval old=dom[c.y];
+			if (!fwd(c,dom)) {
+				// the domains of the next nodes are not calculated
+				inc_slot.clear();
+				return false;
+			}
+			// the nodes above are not evaluated again if the domain is the same
+			changed[c.y]=(all || dom[c.y]!=old);
+		} else
+			changed[c.y]=false;
+	}
+
+	for (int i=0; i<_nb_slots; i++)
+		slot[i]=dom[i];
+
+	return true;
+}
+
+bool ScalarTape::incremental_backward(Interval* slot) const {
+
+	const Interval* dom=&inc_slot[0];
+
+	for (int k=0; k<size; k++) {
+		const Instr& c=code[k];
+		// a projection from the forward domain does not contract the arguments
+		// (unless the operator is partial)
+		if (slot[c.y]==dom[c.y] && !partial(c)) continue;
+		if (!bwd(c,slot)) return false;
+	}
+
+	return true;
+}
+
+// the slots of the pth node in the batch
+#define X(p) (&slot[(p)*n])
+// y[i]=op(x1[i]) for all the boxes
+#define UNARY(op)          { const Interval* x1=X(c.x1); for (int i=0; i<n; i++) y[i]=op(x1[i]); }
+// idem, but the box is removed if the result is empty
+#define UNARY_PARTIAL(op)  { const Interval* x1=X(c.x1); for (int i=0; i<n; i++) { if ((y[i]=op(x1[i])).is_empty()) batch_empty[i]=true; } }
+// y[i]=x1[i] op x2[i] for all the boxes
+#define BINARY(op)         { const Interval* x1=X(c.x1); const Interval* x2=X(c.x2); for (int i=0; i<n; i++) y[i]=x1[i] op x2[i]; }
+// y[i]=op(x1[i],x2[i]) for all the boxes
+#define BINARY_FUNC(op)    { const Interval* x1=X(c.x1); const Interval* x2=X(c.x2); for (int i=0; i<n; i++) y[i]=op(x1[i],x2[i]); }
+
+void ScalarTape::forward(const IntervalMatrix& x, IntervalVector& y_) const {
+
+	int n=x.nb_cols();
+	assert(y_.size()==n);
+
+	if ((int) batch_slot.size()<_nb_slots*n)
+		batch_slot.resize(_nb_slots*n);
+	batch_empty.assign(n,false);
+
+	// the slots of the kth node are batch_slot[k*n]...batch_slot[k*n+n-1]
+	Interval* slot=&batch_slot[0];
+
+	for (int v=0; v<nb_vars; v++) {
+		Interval* y=&slot[var_slot[v]*n];
+		const IntervalVector& xv=x[var_index[v]];
+		for (int i=0; i<n; i++) y[i]=xv[i];
+	}
+
+	for (int k=size-1; k>=0; k--) {
+		const Instr& c=code[k];
+		Interval* y=X(c.y);
+
+		switch(c.op) {
+		case CompiledFunction::CST:   for (int i=0; i<n; i++) y[i]=cst[c.x1]; break;
+		case CompiledFunction::CHI:   { const Interval* x1=X(c.x1); const Interval* x2=X(c.x2); const Interval* x3=X(c.x3);
+		                                for (int i=0; i<n; i++) y[i]=chi(x1[i],x2[i],x3[i]); } break;
+		case CompiledFunction::ADD:   BINARY(+); break;
+		case CompiledFunction::MUL:   BINARY(*); break;
+		case CompiledFunction::SUB:   BINARY(-); break;
+		case CompiledFunction::DIV:   BINARY(/); break;
+		case CompiledFunction::MAX:   BINARY_FUNC(max); break;
+		case CompiledFunction::MIN:   BINARY_FUNC(min); break;
+		case CompiledFunction::ATAN2: BINARY_FUNC(atan2); break;
+		case CompiledFunction::MINUS: UNARY(-); break;
+		case CompiledFunction::SIGN:  UNARY(sign); break;
+		case CompiledFunction::ABS:   UNARY(abs); break;
+		case CompiledFunction::POWER: { const Interval* x1=X(c.x1); for (int i=0; i<n; i++) y[i]=pow(x1[i],c.x2); } break;
+		case CompiledFunction::SQR:   UNARY(sqr); break;
+		case CompiledFunction::SQRT:  UNARY_PARTIAL(sqrt); break;
+		case CompiledFunction::EXP:   UNARY(exp); break;
+		case CompiledFunction::LOG:   UNARY_PARTIAL(log); break;
+		case CompiledFunction::COS:   UNARY(cos); break;
+		case CompiledFunction::SIN:   UNARY(sin); break;
+		case CompiledFunction::TAN:   UNARY_PARTIAL(tan); break;
+		case CompiledFunction::COSH:  UNARY(cosh); break;
+		case CompiledFunction::SINH:  UNARY(sinh); break;
+		case CompiledFunction::TANH:  UNARY(tanh); break;
+		case CompiledFunction::ACOS:  UNARY_PARTIAL(acos); break;
+		case CompiledFunction::ASIN:  UNARY_PARTIAL(asin); break;
+		case CompiledFunction::ATAN:  UNARY(atan); break;
+		case CompiledFunction::ACOSH: UNARY_PARTIAL(acosh); break;
+		case CompiledFunction::ASINH: UNARY(asinh); break;
+		case CompiledFunction::ATANH: UNARY_PARTIAL(atanh); break;
+		default:                      assert(false);
+		}
+	}
+
+	const Interval* root=X(root_slot[0]);
+	for (int i=0; i<n; i++)
+		if (batch_empty[i]) y_[i].set_empty();
+		else y_[i]=root[i];
+}
+
+#undef X
+#undef UNARY
+#undef UNARY_PARTIAL
+#undef BINARY
+#undef BINARY_FUNC
+
+bool ScalarTape::jacobian(const IntervalVector& box, const int* color, int nb_colors, Interval* J) const {
+
+	if (!forward(box,slot)) return false;
+
+	int K=nb_colors;
+
+	if ((int) dslot.size()<_nb_slots*K)
+		dslot.resize(_nb_slots*K);
+
+	// the derivatives of the pth node are dslot[p*K]...dslot[p*K+K-1]
+	Interval* d=&dslot[0];
+
+	// seeds
+	for (int v=0; v<nb_vars; v++) {
+		Interval* dy=&d[var_slot[v]*K];
+		for (int j=0; j<K; j++) dy[j]=Interval::ZERO;
+		dy[color[var_index[v]]]=Interval::ONE;
+	}
+
+	for (int k=size-1; k>=0; k--) {
+		const Instr& c=code[k];
+		Interval* dy=&d[c.y*K];
+
+		// derivatives of y w.r.t. x1, x2 and x3
+		Interval g1,g2,g3;
+		// number of arguments
+		int nb_args=1;
+
+		switch(c.op) {
+		case CompiledFunction::CST:
+			for (int j=0; j<K; j++) dy[j]=Interval::ZERO;
+			continue;
+		case CompiledFunction::CHI:
+		{
+			const Interval& a=slot[c.x1];
+			// same as Gradient::chi_bwd
+			if (a.ub()<=0)      { g2=Interval::ONE;    g3=Interval::ZERO; }
+			else if (a.lb()>0)  { g2=Interval::ZERO;   g3=Interval::ONE; }
+			else                { g2=Interval(0,1);    g3=Interval(0,1); }
+			g1=Interval::ZERO;
+			nb_args=3;
+		}
+		break;
+		case CompiledFunction::ADD:   g1=Interval::ONE; g2=Interval::ONE;  nb_args=2; break;
+		case CompiledFunction::SUB:   g1=Interval::ONE; g2=-Interval::ONE; nb_args=2; break;
+		case CompiledFunction::MUL:   g1=slot[c.x2]; g2=slot[c.x1]; nb_args=2; break;
+		case CompiledFunction::DIV:   g1=1.0/slot[c.x2]; g2=-slot[c.x1]/sqr(slot[c.x2]); nb_args=2; break;
+		case CompiledFunction::MAX:
+		case CompiledFunction::MIN:
+		{
+			// the first argument is selected if a>b, where (a,b)=(x1,x2)
+			// for max and (a,b)=(x2,x1) for min
+			const Interval& a=c.op==CompiledFunction::MAX ? slot[c.x1] : slot[c.x2];
+			const Interval& b=c.op==CompiledFunction::MAX ? slot[c.x2] : slot[c.x1];
+			if (a.lb()>b.ub())      { g1=Interval::ONE;  g2=Interval::ZERO; }
+			else if (b.lb()>a.ub()) { g1=Interval::ZERO; g2=Interval::ONE; }
+			else                    { g1=Interval(0,1);  g2=Interval(0,1); }
+			nb_args=2;
+		}
+		break;
+		case CompiledFunction::ATAN2:
+		{
+			// atan2(x1,x2) = angle of (x2,x1)
+			Interval r=sqr(slot[c.x1])+sqr(slot[c.x2]);
+			g1=slot[c.x2]/r;
+			g2=-slot[c.x1]/r;
+			nb_args=2;
+		}
+		break;
+		case CompiledFunction::MINUS: g1=-Interval::ONE; break;
+		case CompiledFunction::SIGN:  g1=slot[c.x1].contains(0) ? Interval::POS_REALS : Interval::ZERO; break;
+		case CompiledFunction::ABS:
+		{
+			const Interval& x=slot[c.x1];
+			g1= x.lb()>=0 ? Interval::ONE : (x.ub()<=0 ? -Interval::ONE : Interval(-1,1));
+		}
+		break;
+		case CompiledFunction::POWER: g1=c.x2*pow(slot[c.x1],c.x2-1); break;
+		case CompiledFunction::SQR:   g1=2.0*slot[c.x1]; break;
+		case CompiledFunction::SQRT:  g1=0.5/sqrt(slot[c.x1]); break;
+		case CompiledFunction::EXP:   g1=exp(slot[c.x1]); break;
+		case CompiledFunction::LOG:   g1=1.0/slot[c.x1]; break;
+		case CompiledFunction::COS:   g1=-sin(slot[c.x1]); break;
+		case CompiledFunction::SIN:   g1=cos(slot[c.x1]); break;
+		case CompiledFunction::TAN:   g1=1.0+sqr(tan(slot[c.x1])); break;
+		case CompiledFunction::COSH:  g1=sinh(slot[c.x1]); break;
+		case CompiledFunction::SINH:  g1=cosh(slot[c.x1]); break;
+		case CompiledFunction::TANH:  g1=1.0-sqr(tanh(slot[c.x1])); break;
+		case CompiledFunction::ACOS:  g1=-1.0/sqrt(1.0-sqr(slot[c.x1])); break;
+		case CompiledFunction::ASIN:  g1=1.0/sqrt(1.0-sqr(slot[c.x1])); break;
+		case CompiledFunction::ATAN:  g1=1.0/(1.0+sqr(slot[c.x1])); break;
+		case CompiledFunction::ACOSH: g1=1.0/sqrt(sqr(slot[c.x1])-1.0); break;
+		case CompiledFunction::ASINH: g1=1.0/sqrt(1.0+sqr(slot[c.x1])); break;
+		case CompiledFunction::ATANH: g1=1.0/(1.0-sqr(slot[c.x1])); break;
+		default:                      assert(false);
+		}
+
+		// chain rule
+		const Interval* dx1=&d[c.x1*K];
+		switch(nb_args) {
+		case 1:
+			for (int j=0; j<K; j++) dy[j]=dx1[j]*g1;
+			break;
+		case 2:
+		{
+			const Interval* dx2=&d[c.x2*K];
+			for (int j=0; j<K; j++) dy[j]=dx1[j]*g1+dx2[j]*g2;
+		}
+		break;
+		default:
+		{
+			// chi: the condition x1 is not derived
+			const Interval* dx2=&d[c.x2*K];
+			const Interval* dx3=&d[c.x3*K];
+			for (int j=0; j<K; j++) dy[j]=dx2[j]*g2+dx3[j]*g3;
+		}
+		}
+	}
+
+	for (int i=0; i<_nb_roots; i++) {
+		const Interval* dr=&d[root_slot[i]*K];
+		for (int j=0; j<K; j++) J[i*K+j]=dr[j];
+	}
+
+	return true;
+}
+
+} // end namespace ibex
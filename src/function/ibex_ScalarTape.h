@@ -0,0 +1,362 @@
+/* ============================================================================
+ * I B E X - Scalar tape of a compiled function
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : IBEX contributors
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __IBEX_SCALAR_TAPE_H__
+#define __IBEX_SCALAR_TAPE_H__
+
+#include "ibex_CompiledFunction.h"
+#include "ibex_IntervalVector.h"
+#include "ibex_IntervalMatrix.h"
+
+#include <vector>
+
+namespace ibex {
+
+/**
+ * \ingroup symbolic
+ *
+ * \brief Register-based tape of a scalar function.
+ *
+ * When all the nodes of a function are scalar (the only non-scalar
+ * nodes allowed are vector symbols, accessed via indices, like x[0]),
+ * the compiled function is lowered to a flat sequence of instructions
+ * working directly on an array of intervals ("slots"), one slot per node.
+ * This avoids the indirections of #ibex::CompiledFunction (labels,
+ * domains and node references).
+ *
+ * The ith slot contains the domain of the ith node except for the
+ * components of the symbols (like x or x[0]) that all share the same slot.
+ * Hence, contracting a slot in the backward phase contracts the
+ * variable everywhere in the expression, as with labels.
+ *
+ * The tape is used by #ibex::HC4Revise in interval mode, on request
+ * (see #ibex::HC4Revise::HC4Revise(FwdMode,bool,bool)), e.g., by #ibex::CtcFwdBwd.
+ * Note that the labels of the function are not updated in this case.
+ *
+ * The root of the function can also be a vector of scalar expressions
+ * (typically, the function of a system of equations). The tape has then
+ * one root per component and is only used for differentiation
+ * (see #jacobian(const IntervalVector&, const int*, int, Interval*) const).
+ */
+class ScalarTape {
+public:
+	/**
+	 * \brief Build the tape of a compiled function.
+	 *
+	 * \param x - the arguments of the function
+	 * \return NULL if the function is not scalar (or a vector of scalar expressions).
+	 */
+	static ScalarTape* build(const Array<const ExprSymbol>& x, const CompiledFunction& cf);
+
+	/**
+	 * \brief Delete *this.
+	 */
+	~ScalarTape();
+
+	/**
+	 * \brief Number of slots.
+	 */
+	int nb_slots() const;
+
+	/**
+	 * \brief Number of roots (1 if the function is scalar, the
+	 * number of components otherwise).
+	 */
+	int nb_roots() const;
+
+	/**
+	 * \brief Forward evaluation of the function on \a box.
+	 *
+	 * Same as #ibex::Eval (in interval arithmetic).
+	 * \return false if the evaluation is empty (outside the definition domain).
+	 */
+	bool forward(const IntervalVector& box, Interval* slot) const;
+
+	/**
+	 * \brief Compressed Jacobian matrix (forward vector mode).
+	 *
+	 * The jth variable is given the direction (seed) e_{color[j]} so that
+	 * all the derivatives are obtained in a single forward sweep, with
+	 * \a nb_colors derivatives per node. The result is the nb_roots() x nb_colors
+	 * matrix J*S (where S[j][color[j]]=1), stored row by row in \a J.
+	 * If two variables with the same color never occur in the same
+	 * component, J*S is simply a compressed form of the Jacobian matrix.
+	 *
+	 * \return false if the evaluation is empty (outside the definition domain).
+	 */
+	bool jacobian(const IntervalVector& box, const int* color, int nb_colors, Interval* J) const;
+
+	/**
+	 * \brief Forward evaluation of the function on several boxes.
+	 *
+	 * The kth column of \a x is the kth box, i.e., \a x[j] contains the
+	 * jth component of all the boxes (structure-of-arrays layout).
+	 * Each instruction is executed once for the whole batch.
+	 *
+	 * The kth result is stored in \a y[k] (the empty interval if the kth
+	 * box is outside the definition domain). Same as #forward(const IntervalVector&, Interval*)
+	 * applied to each box.
+	 */
+	void forward(const IntervalMatrix& x, IntervalVector& y) const;
+
+	/**
+	 * \brief The slot of the root node (of the first root if
+	 * the function is vector-valued).
+	 */
+	Interval& root(Interval* slot) const;
+
+	/**
+	 * \brief Backward projection (the root slot must be set).
+	 *
+	 * Same as #ibex::HC4Revise.
+	 * \return false if the projection is empty.
+	 */
+	bool backward(Interval* slot) const;
+
+	/**
+	 * \brief Incremental forward evaluation of the function on \a box.
+	 *
+	 * Same as #forward(const IntervalVector&, Interval*) except that only
+	 * the nodes that depend on a variable whose domain has changed since
+	 * the last call are evaluated again. The domains of the other nodes
+	 * are those of the last call (they are stored in the tape).
+	 *
+	 * The domains are then copied into \a slot for #incremental_backward(Interval*).
+	 */
+	bool incremental_forward(const IntervalVector& box, Interval* slot) const;
+
+	/**
+	 * \brief Backward projection after an incremental forward evaluation.
+	 *
+	 * Same as #backward(Interval*) except that a node whose domain has not
+	 * been narrowed since the forward evaluation is not projected onto its
+	 * arguments (this would not contract them), unless its operator is only
+	 * defined on a part of the real line (sqrt, log, acos, ...).
+	 */
+	bool incremental_backward(Interval* slot) const;
+
+	/**
+	 * \brief Load the domains of the variables into \a box.
+	 */
+	void read(const Interval* slot, IntervalVector& box) const;
+
+	/**
+	 * \brief Slots of the tape (used when no evaluation context is given).
+	 */
+	Interval* const slot;
+
+private:
+	/*
+	 * An instruction: slot[y]=op(slot[x1],slot[x2],slot[x3]).
+	 * For POWER, x2 is the exponent. For CST, x1 is the index of the constant.
+	 */
+	struct Instr {
+		CompiledFunction::operation op;
+		int y, x1, x2, x3;
+	};
+
+	ScalarTape(int nb_slots, int size, int nb_vars, int nb_csts, int nb_roots);
+
+	/* Execute the instruction c (forward). Return false if the result is empty. */
+	bool fwd(const Instr& c, Interval* slot) const;
+
+	/* Project the instruction c (backward). Return false if the projection is empty. */
+	bool bwd(const Instr& c, Interval* slot) const;
+
+	/* True if one of the arguments of c is in a changed slot */
+	bool depends(const Instr& c, const char* changed) const;
+
+	/* True if the operator of c is only defined on a part of the real line.
+	 * Its backward projection can contract the argument even if the result
+	 * is the image by the forward evaluation (e.g., x=[-1,4] and sqrt(x)=[0,2]). */
+	static bool partial(const Instr& c);
+
+	ScalarTape(const ScalarTape&); // forbidden
+
+	/* Number of slots */
+	const int _nb_slots;
+
+	/* Number of instructions */
+	int size;
+
+	/* The instructions, by decreasing height */
+	Instr* code;
+
+	/* Number of variables (components of the box) in the expression */
+	int nb_vars;
+
+	/* Slot of the ith variable */
+	int* var_slot;
+
+	/* Index in the box of the ith variable */
+	int* var_index;
+
+	/* The constants */
+	Interval* cst;
+
+	/* Number of roots */
+	const int _nb_roots;
+
+	/* Slot of each root */
+	int* root_slot;
+
+	/* Slots of the batch evaluation (nb_slots x batch size) */
+	mutable std::vector<Interval> batch_slot;
+
+	/* Boxes of the batch that are outside of the definition domain */
+	mutable std::vector<bool> batch_empty;
+
+	/* Derivatives of the nodes (nb_slots x nb_colors) */
+	mutable std::vector<Interval> dslot;
+
+	/* Domains of the nodes given by the last incremental forward evaluation
+	 * (empty if they have to be calculated from scratch) */
+	mutable std::vector<Interval> inc_slot;
+
+	/* Whether the domain of each slot has changed in the last incremental evaluation */
+	mutable std::vector<char> inc_changed;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline int ScalarTape::nb_slots() const {
+	return _nb_slots;
+}
+
+inline int ScalarTape::nb_roots() const {
+	return _nb_roots;
+}
+
+inline Interval& ScalarTape::root(Interval* slot) const {
+	return slot[root_slot[0]];
+}
+
+inline bool ScalarTape::fwd(const Instr& c, Interval* slot) const {
+	Interval& y=slot[c.y];
+	switch(c.op) {
+	case CompiledFunction::CST:   y=cst[c.x1]; break;
+	case CompiledFunction::CHI:   y=chi(slot[c.x1],slot[c.x2],slot[c.x3]); break;
+	case CompiledFunction::ADD:   y=slot[c.x1]+slot[c.x2]; break;
+	case CompiledFunction::MUL:   y=slot[c.x1]*slot[c.x2]; break;
+	case CompiledFunction::SUB:   y=slot[c.x1]-slot[c.x2]; break;
+	case CompiledFunction::DIV:   y=slot[c.x1]/slot[c.x2]; break;
+	case CompiledFunction::MAX:   y=max(slot[c.x1],slot[c.x2]); break;
+	case CompiledFunction::MIN:   y=min(slot[c.x1],slot[c.x2]); break;
+	case CompiledFunction::ATAN2: y=atan2(slot[c.x1],slot[c.x2]); break;
+	case CompiledFunction::MINUS: y=-slot[c.x1]; break;
+	case CompiledFunction::SIGN:  y=sign(slot[c.x1]); break;
+	case CompiledFunction::ABS:   y=abs(slot[c.x1]); break;
+	case CompiledFunction::POWER: y=pow(slot[c.x1],c.x2); break;
+	case CompiledFunction::SQR:   y=sqr(slot[c.x1]); break;
+	case CompiledFunction::SQRT:  if ((y=sqrt(slot[c.x1])).is_empty()) return false; break;
+	case CompiledFunction::EXP:   y=exp(slot[c.x1]); break;
+	case CompiledFunction::LOG:   if ((y=log(slot[c.x1])).is_empty()) return false; break;
+	case CompiledFunction::COS:   y=cos(slot[c.x1]); break;
+	case CompiledFunction::SIN:   y=sin(slot[c.x1]); break;
+	case CompiledFunction::TAN:   if ((y=tan(slot[c.x1])).is_empty()) return false; break;
+	case CompiledFunction::COSH:  y=cosh(slot[c.x1]); break;
+	case CompiledFunction::SINH:  y=sinh(slot[c.x1]); break;
+	case CompiledFunction::TANH:  y=tanh(slot[c.x1]); break;
+	case CompiledFunction::ACOS:  if ((y=acos(slot[c.x1])).is_empty()) return false; break;
+	case CompiledFunction::ASIN:  if ((y=asin(slot[c.x1])).is_empty()) return false; break;
+	case CompiledFunction::ATAN:  y=atan(slot[c.x1]); break;
+	case CompiledFunction::ACOSH: if ((y=acosh(slot[c.x1])).is_empty()) return false; break;
+	case CompiledFunction::ASINH: y=asinh(slot[c.x1]); break;
+	case CompiledFunction::ATANH: if ((y=atanh(slot[c.x1])).is_empty()) return false; break;
+	default:                      assert(false);
+	}
+	return true;
+}
+
+inline bool ScalarTape::bwd(const Instr& c, Interval* slot) const {
+	const Interval& y=slot[c.y];
+	switch(c.op) {
+	case CompiledFunction::CST:   break;
+	case CompiledFunction::CHI:   if (!bwd_chi(y,slot[c.x1],slot[c.x2],slot[c.x3])) return false; break;
+	case CompiledFunction::ADD:   if (!bwd_add(y,slot[c.x1],slot[c.x2])) return false; break;
+	case CompiledFunction::MUL:   if (!bwd_mul(y,slot[c.x1],slot[c.x2])) return false; break;
+	case CompiledFunction::SUB:   if (!bwd_sub(y,slot[c.x1],slot[c.x2])) return false; break;
+	case CompiledFunction::DIV:   if (!bwd_div(y,slot[c.x1],slot[c.x2])) return false; break;
+	case CompiledFunction::MAX:   if (!bwd_max(y,slot[c.x1],slot[c.x2])) return false; break;
+	case CompiledFunction::MIN:   if (!bwd_min(y,slot[c.x1],slot[c.x2])) return false; break;
+	case CompiledFunction::ATAN2: if (!bwd_atan2(y,slot[c.x1],slot[c.x2])) return false; break;
+	case CompiledFunction::MINUS: if ((slot[c.x1] &= -y).is_empty()) return false; break;
+	case CompiledFunction::SIGN:  if (!bwd_sign(y,slot[c.x1])) return false; break;
+	case CompiledFunction::ABS:   if (!bwd_abs(y,slot[c.x1])) return false; break;
+	case CompiledFunction::POWER: if (!bwd_pow(y,c.x2,slot[c.x1])) return false; break;
+	case CompiledFunction::SQR:   if (!bwd_sqr(y,slot[c.x1])) return false; break;
+	case CompiledFunction::SQRT:  if (!bwd_sqrt(y,slot[c.x1])) return false; break;
+	case CompiledFunction::EXP:   if (!bwd_exp(y,slot[c.x1])) return false; break;
+	case CompiledFunction::LOG:   if (!bwd_log(y,slot[c.x1])) return false; break;
+	case CompiledFunction::COS:   if (!bwd_cos(y,slot[c.x1])) return false; break;
+	case CompiledFunction::SIN:   if (!bwd_sin(y,slot[c.x1])) return false; break;
+	case CompiledFunction::TAN:   if (!bwd_tan(y,slot[c.x1])) return false; break;
+	case CompiledFunction::COSH:  if (!bwd_cosh(y,slot[c.x1])) return false; break;
+	case CompiledFunction::SINH:  if (!bwd_sinh(y,slot[c.x1])) return false; break;
+	case CompiledFunction::TANH:  if (!bwd_tanh(y,slot[c.x1])) return false; break;
+	case CompiledFunction::ACOS:  if (!bwd_acos(y,slot[c.x1])) return false; break;
+	case CompiledFunction::ASIN:  if (!bwd_asin(y,slot[c.x1])) return false; break;
+	case CompiledFunction::ATAN:  if (!bwd_atan(y,slot[c.x1])) return false; break;
+	case CompiledFunction::ACOSH: if (!bwd_acosh(y,slot[c.x1])) return false; break;
+	case CompiledFunction::ASINH: if (!bwd_asinh(y,slot[c.x1])) return false; break;
+	case CompiledFunction::ATANH: if (!bwd_atanh(y,slot[c.x1])) return false; break;
+	default:                      assert(false);
+	}
+	return true;
+}
+
+inline bool ScalarTape::depends(const Instr& c, const char* changed) const {
+	switch(c.op) {
+	case CompiledFunction::CST:   return false;
+	case CompiledFunction::CHI:   return changed[c.x1] || changed[c.x2] || changed[c.x3];
+	case CompiledFunction::ADD:   case CompiledFunction::MUL:   case CompiledFunction::SUB:
+	case CompiledFunction::DIV:   case CompiledFunction::MAX:   case CompiledFunction::MIN:
+	case CompiledFunction::ATAN2: return changed[c.x1] || changed[c.x2];
+	default:                      return changed[c.x1]; // note: x2 is the exponent for POWER
+	}
+}
+
+inline bool ScalarTape::partial(const Instr& c) {
+	switch(c.op) {
+	case CompiledFunction::SQRT:  case CompiledFunction::LOG:   case CompiledFunction::ACOS:
+	case CompiledFunction::ASIN:  case CompiledFunction::ACOSH: case CompiledFunction::ATANH:
+	                              return true;
+	default:                      return false;
+	}
+}
+
+inline bool ScalarTape::forward(const IntervalVector& box, Interval* slot) const {
+
+	for (int v=0; v<nb_vars; v++)
+		slot[var_slot[v]]=box[var_index[v]];
+
+	for (int k=size-1; k>=0; k--)
+		if (!fwd(code[k],slot)) return false;
+
+	return true;
+}
+
+inline bool ScalarTape::backward(Interval* slot) const {
+
+	for (int k=0; k<size; k++)
+		if (!bwd(code[k],slot)) return false;
+
+	return true;
+}
+
+inline void ScalarTape::read(const Interval* slot, IntervalVector& box) const {
+	for (int v=0; v<nb_vars; v++)
+		box[var_index[v]]=slot[var_slot[v]];
+}
+
+} // end namespace ibex
+
+#endif // __IBEX_SCALAR_TAPE_H__
@@ -0,0 +1,105 @@
+/* ============================================================================
+ * I B E X - Sparse Jacobian matrix
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : IBEX contributors
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "ibex_SparseJacobian.h"
+
+#include <vector>
+
+using namespace std;
+
+namespace ibex {
+
+SparseJacobian::SparseJacobian(const Function& f) : m(f.image_dim()), n(f.nb_var()),
+		_row_begin(new int[m+1]), _color(new int[n]), _nb_colors(0) {
+
+	// ============== pattern ==============
+	_row_begin[0]=0;
+	for (int i=0; i<m; i++) {
+		_row_begin[i+1]=_row_begin[i]+(m==1? f : f[i]).nb_used_vars();
+	}
+
+	_col=new int[nnz()];
+	_val=new Interval[nnz()];
+
+	// the rows of each column
+	vector<vector<int> > rows(n);
+
+	for (int i=0; i<m; i++) {
+		const Function& fi=(m==1? f : f[i]);
+		for (int k=0; k<fi.nb_used_vars(); k++) {
+			_col[_row_begin[i]+k]=fi.used_var(k);
+			rows[fi.used_var(k)].push_back(i);
+		}
+	}
+
+	// ============== coloring ==============
+	// Greedy coloring of the columns, in their natural order:
+	// the jth column receives the smallest color that is not
+	// already given to a column sharing a row with j.
+	//
+	// forbidden[c]==j <=> color c is forbidden for the jth column.
+	vector<int> forbidden(n,-1);
+
+	for (int j=0; j<n; j++) {
+		for (vector<int>::const_iterator it=rows[j].begin(); it!=rows[j].end(); it++) {
+			for (int k=_row_begin[*it]; k<_row_begin[*it+1]; k++) {
+				int j2=_col[k];
+				if (j2<j) forbidden[_color[j2]]=j;
+			}
+		}
+		int c=0;
+		while (forbidden[c]==j) c++;
+		_color[j]=c;
+		if (c>=_nb_colors) _nb_colors=c+1;
+	}
+
+	compressed=new Interval[m*_nb_colors];
+}
+
+SparseJacobian::~SparseJacobian() {
+	delete[] _row_begin;
+	delete[] _col;
+	delete[] _val;
+	delete[] _color;
+	delete[] compressed;
+}
+
+Interval SparseJacobian::operator()(int i, int j) const {
+	// the columns of a row are sorted
+	int k1=_row_begin[i];
+	int k2=_row_begin[i+1]-1;
+	while (k1<=k2) {
+		int k=(k1+k2)/2;
+		if (_col[k]==j) return _val[k];
+		else if (_col[k]<j) k1=k+1;
+		else k2=k-1;
+	}
+	return Interval::ZERO;
+}
+
+void SparseJacobian::set_empty() {
+	for (int k=0; k<nnz(); k++)
+		_val[k].set_empty();
+}
+
+void SparseJacobian::to_matrix(IntervalMatrix& J) const {
+	assert(J.nb_rows()==m);
+	assert(J.nb_cols()==n);
+
+	J.clear();
+	for (int i=0; i<m; i++) {
+		IntervalVector& Ji=J[i];
+		for (int k=_row_begin[i]; k<_row_begin[i+1]; k++)
+			Ji[_col[k]]=_val[k];
+	}
+}
+
+} // end namespace ibex
@@ -0,0 +1,194 @@
+/* ============================================================================
+ * I B E X - Sparse Jacobian matrix
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : IBEX contributors
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __IBEX_SPARSE_JACOBIAN_H__
+#define __IBEX_SPARSE_JACOBIAN_H__
+
+#include "ibex_Function.h"
+
+namespace ibex {
+
+/**
+ * \ingroup symbolic
+ *
+ * \brief Sparse Jacobian matrix of a function.
+ *
+ * The structure (the "pattern") is given by the variables used by
+ * each component of the function (see #ibex::Fnc::used_var(int)): the
+ * other entries are structurally zero. The nonzero entries are stored row by
+ * row (compressed sparse row format):
+ * the entries of the ith row are val(row_begin(i)),...,val(row_begin(i+1)-1)
+ * and the column of the kth entry is col(k).
+ *
+ * The columns are also colored so that two columns (variables) with the
+ * same color never appear in the same row (component). All the columns of
+ * a color can then be differentiated together and the whole Jacobian matrix
+ * is obtained with nb_colors() directional derivatives
+ * (see #ibex::Function::jacobian(const IntervalVector&, SparseJacobian&) const).
+ *
+ * Example:
+ * \code
+ * SparseJacobian J(f);  // the pattern and the coloring are calculated once
+ * f.jacobian(box,J);
+ * for (int i=0; i<J.nb_rows(); i++)
+ *   for (int k=J.row_begin(i); k<J.row_begin(i+1); k++)
+ *     cout << "J[" << i << "][" << J.col(k) << "]=" << J.val(k) << endl;
+ * \endcode
+ */
+class SparseJacobian {
+public:
+	/**
+	 * \brief Build the pattern and the coloring of the Jacobian matrix of f.
+	 *
+	 * The values are initialized to zero.
+	 */
+	SparseJacobian(const Function& f);
+
+	/**
+	 * \brief Delete *this.
+	 */
+	~SparseJacobian();
+
+	/**
+	 * \brief Number of rows (components of the function).
+	 */
+	int nb_rows() const;
+
+	/**
+	 * \brief Number of columns (variables).
+	 */
+	int nb_cols() const;
+
+	/**
+	 * \brief Number of structurally nonzero entries.
+	 */
+	int nnz() const;
+
+	/**
+	 * \brief Index of the first entry of the ith row.
+	 *
+	 * \pre 0<=i<=nb_rows(). row_begin(nb_rows())==nnz().
+	 */
+	int row_begin(int i) const;
+
+	/**
+	 * \brief Column of the kth entry.
+	 */
+	int col(int k) const;
+
+	/**
+	 * \brief Value of the kth entry.
+	 */
+	Interval& val(int k);
+
+	/**
+	 * \brief Value of the kth entry (const version).
+	 */
+	const Interval& val(int k) const;
+
+	/**
+	 * \brief Entry (i,j) of the matrix (zero if the entry is not in the pattern).
+	 */
+	Interval operator()(int i, int j) const;
+
+	/**
+	 * \brief Number of colors.
+	 */
+	int nb_colors() const;
+
+	/**
+	 * \brief Color of the jth column.
+	 */
+	int color(int j) const;
+
+	/**
+	 * \brief Set all the values to the empty interval.
+	 */
+	void set_empty();
+
+	/**
+	 * \brief Dense version of the matrix.
+	 *
+	 * \pre J must be nb_rows() x nb_cols().
+	 */
+	void to_matrix(IntervalMatrix& J) const;
+
+private:
+	friend class Function;
+
+	SparseJacobian(const SparseJacobian&); // forbidden
+
+	/* Number of rows */
+	const int m;
+
+	/* Number of columns */
+	const int n;
+
+	/* Index of the first entry of each row (m+1 indices) */
+	int* _row_begin;
+
+	/* Column of each entry */
+	int* _col;
+
+	/* Value of each entry */
+	Interval* _val;
+
+	/* Color of each column */
+	int* _color;
+
+	/* Number of colors */
+	int _nb_colors;
+
+	/* Compressed matrix (m x nb_colors), see ScalarTape::jacobian */
+	Interval* compressed;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline int SparseJacobian::nb_rows() const {
+	return m;
+}
+
+inline int SparseJacobian::nb_cols() const {
+	return n;
+}
+
+inline int SparseJacobian::nnz() const {
+	return _row_begin[m];
+}
+
+inline int SparseJacobian::row_begin(int i) const {
+	return _row_begin[i];
+}
+
+inline int SparseJacobian::col(int k) const {
+	return _col[k];
+}
+
+inline Interval& SparseJacobian::val(int k) {
+	return _val[k];
+}
+
+inline const Interval& SparseJacobian::val(int k) const {
+	return _val[k];
+}
+
+inline int SparseJacobian::nb_colors() const {
+	return _nb_colors;
+}
+
+inline int SparseJacobian::color(int j) const {
+	return _color[j];
+}
+
+} // end namespace ibex
+
+#endif // __IBEX_SPARSE_JACOBIAN_H__
@@ -9,6 +9,8 @@
 
 #include "ibex_PdcInPolygon.h"
 
+#include <algorithm>
+
 using namespace std;
 
 namespace ibex {
@@ -17,49 +19,58 @@ PdcInPolygon::PdcInPolygon(vector<double> &_ax, vector<double> &_ay, vector<doub
     		ax(_ax),
     		ay(_ay),
     		bx(_bx),
-    		by(_by) {
+    		by(_by),
+    		bvh(_ax,_ay,_bx,_by) {
 }
 
 namespace {
 
-
-Interval argument(Interval mx, Interval my, double xa, double ya, double xb, double yb) {
-	Interval ma_x = Interval(xa) - (mx);
-	Interval ma_y = Interval(ya) - (my);
-	Interval mb_x = Interval(xb) - (mx);
-	Interval mb_y = Interval(yb) - (my);
-
-	Interval norm_ma = sqrt( sqr(ma_x) + sqr(ma_y) );
-	Interval norm_mb = sqrt( sqr(mb_x) + sqr(mb_y) );
-
-	Interval cos_theta = (ma_x*mb_x + ma_y*mb_y) / (norm_ma*norm_mb);
-	Interval sin_theta = (ma_x*mb_y - ma_y*mb_x) / (norm_ma*norm_mb);
-
-	return atan2(sin_theta,cos_theta);
+/*
+ * Position of (mx,my) with respect to the line (a,b):
+ * positive if on the left, negative if on the right.
+ */
+Interval is_left(double mx, double my, double xa, double ya, double xb, double yb) {
+	return (Interval(xb)-xa)*(Interval(my)-ya) - (Interval(mx)-xa)*(Interval(yb)-ya);
 }
 
 } // end anonymous namespace
 
 
 BoolInterval PdcInPolygon::test(const IntervalVector& x) {
-	
-	Interval mx = Interval(x[0].mid());
-	Interval my = Interval(x[1].mid());
-
-	//Interval cos_theta = 0;
-	Interval theta = Interval(0);
-	for(unsigned int i = 0; i < ax.size(); i++) {
-		theta += argument(mx,my,ax[i],ay[i],bx[i],by[i]);
-	}
 
-	if(!theta.contains(0)) {
-		return YES;
-	} else if (!theta.contains(2*M_PI) && theta.contains(0)) {
-		return NO;
-	} else {
-		// Undetermined case
-		return MAYBE;
+	double mx = x[0].mid();
+	double my = x[1].mid();
+
+	// the segments that may cross the ray [mx,+oo)x{my}
+	IntervalVector ray(2);
+	ray[0] = Interval(mx,POS_INFINITY);
+	ray[1] = Interval(my);
+	bvh.select(ray, selected);
+
+	int wn = 0; // winding number
+
+	for (unsigned int k = 0; k < selected.size(); k++) {
+		int i = selected[k];
+
+		if (ay[i] <= my && my < by[i]) {
+			// upward crossing if the point is on the left
+			Interval s = is_left(mx,my,ax[i],ay[i],bx[i],by[i]);
+			if (s.contains(0)) return MAYBE;
+			if (s.lb() > 0) wn++;
+		}
+		else if (by[i] <= my && my < ay[i]) {
+			// downward crossing if the point is on the right
+			Interval s = is_left(mx,my,ax[i],ay[i],bx[i],by[i]);
+			if (s.contains(0)) return MAYBE;
+			if (s.ub() < 0) wn--;
+		}
+		else if (ay[i] == my && by[i] == my) {
+			// horizontal segment on the ray: the point may be on it
+			if (std::min(ax[i],bx[i]) <= mx) return MAYBE;
+		}
 	}
+
+	return wn != 0 ? YES : NO;
 }
 
 } // namespace ibex
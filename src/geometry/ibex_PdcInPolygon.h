@@ -11,6 +11,7 @@
 #define __IBEX_PDC_IN_POLYGON_H__
 
 #include "ibex_Pdc.h"
+#include "ibex_SegmentBVH.h"
 #include <vector>
 
 namespace ibex {
@@ -21,7 +22,12 @@ namespace ibex {
  * \brief Tests if a box is inside a polygon.
  *
  * The test is based on the Winding Number (see .http://en.wikipedia.org/wiki/Winding_number)
- * But fastest method can be found in http://alienryderflex.com/polygon
+ * of the midpoint of the box, calculated by counting the (oriented) crossings of
+ * the segments with the horizontal ray starting from the point
+ * (see also http://alienryderflex.com/polygon). Only the segments whose bounding
+ * box intersects the ray are considered (see #ibex::SegmentBVH), so that the test is
+ * not linear in the number of segments. The answer is MAYBE if the point
+ * is too close to a segment to decide on which side it lies.
  *
  * The polygon is not necessarily convex.
  *
@@ -78,6 +84,16 @@ protected:
     std::vector<double>& ay;
     std::vector<double>& bx;
     std::vector<double>& by;
+
+    /**
+     * Hierarchy of the segments
+     */
+    SegmentBVH bvh;
+
+    /**
+     * Segments selected by the last test (kept to avoid reallocations)
+     */
+    std::vector<int> selected;
 };
 
 } // namespace ibex
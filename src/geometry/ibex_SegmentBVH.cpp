@@ -0,0 +1,135 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_SegmentBVH.cpp
+// Author      : IBEX contributors
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+//============================================================================
+
+#include "ibex_SegmentBVH.h"
+
+#include <algorithm>
+#include <cassert>
+
+using namespace std;
+
+namespace ibex {
+
+const int SegmentBVH::LEAF_SIZE = 4;
+
+namespace {
+
+/*
+ * Order of the segments by the coordinate of their center
+ * (used to split a node by the median).
+ */
+class CenterLess {
+public:
+	CenterLess(const vector<double>& c) : c(c) { }
+	bool operator()(int i, int j) const { return c[i]<c[j]; }
+	const vector<double>& c;
+};
+
+} // end anonymous namespace
+
+SegmentBVH::SegmentBVH(const vector<double>& ax, const vector<double>& ay, const vector<double>& bx, const vector<double>& by) :
+		seg(ax.size()), bbox(4*ax.size()) {
+
+	assert(ay.size()==ax.size() && bx.size()==ax.size() && by.size()==ax.size());
+
+	int n=ax.size();
+	vector<double> cx(n), cy(n);
+
+	for (int i=0; i<n; i++) {
+		seg[i]=i;
+		bbox[4*i]  =std::min(ax[i],bx[i]);
+		bbox[4*i+1]=std::max(ax[i],bx[i]);
+		bbox[4*i+2]=std::min(ay[i],by[i]);
+		bbox[4*i+3]=std::max(ay[i],by[i]);
+		cx[i]=0.5*(ax[i]+bx[i]);
+		cy[i]=0.5*(ay[i]+by[i]);
+	}
+
+	if (n==0) return;
+
+	nodes.reserve(2*(n/LEAF_SIZE+1));
+	nodes.push_back(Node());
+	build(0, 0, n, cx, cy);
+}
+
+void SegmentBVH::build(int node, int begin, int end, const vector<double>& cx, const vector<double>& cy) {
+	Node nd;
+	nd.xmin=nd.ymin=POS_INFINITY;
+	nd.xmax=nd.ymax=NEG_INFINITY;
+	double cxmin=POS_INFINITY, cxmax=NEG_INFINITY, cymin=POS_INFINITY, cymax=NEG_INFINITY;
+
+	for (int k=begin; k<end; k++) {
+		int i=seg[k];
+		nd.xmin=std::min(nd.xmin,bbox[4*i]);
+		nd.xmax=std::max(nd.xmax,bbox[4*i+1]);
+		nd.ymin=std::min(nd.ymin,bbox[4*i+2]);
+		nd.ymax=std::max(nd.ymax,bbox[4*i+3]);
+		cxmin=std::min(cxmin,cx[i]); cxmax=std::max(cxmax,cx[i]);
+		cymin=std::min(cymin,cy[i]); cymax=std::max(cymax,cy[i]);
+	}
+
+	if (end-begin<=LEAF_SIZE) {
+		nd.first=begin;
+		nd.count=end-begin;
+		nodes[node]=nd;
+		return;
+	}
+
+	// split by the median of the centers along the widest direction
+	int mid=(begin+end)/2;
+	if (cxmax-cxmin>=cymax-cymin)
+		nth_element(seg.begin()+begin, seg.begin()+mid, seg.begin()+end, CenterLess(cx));
+	else
+		nth_element(seg.begin()+begin, seg.begin()+mid, seg.begin()+end, CenterLess(cy));
+
+	int child=nodes.size();
+	nodes.push_back(Node());
+	nodes.push_back(Node());
+	nd.first=child;
+	nd.count=0;
+	nodes[node]=nd;
+
+	build(child,   begin, mid, cx, cy);
+	build(child+1, mid,   end, cx, cy);
+}
+
+void SegmentBVH::select(const IntervalVector& box, vector<int>& segments) const {
+	assert(box.size()==2);
+
+	segments.clear();
+	if (nodes.empty() || box.is_empty()) return;
+
+	double xmin=box[0].lb(), xmax=box[0].ub();
+	double ymin=box[1].lb(), ymax=box[1].ub();
+
+	// depth of the tree: log2(n/LEAF_SIZE)+1 < 64
+	int stack[64];
+	int top=0;
+	stack[top++]=0;
+
+	while (top>0) {
+		const Node& nd=nodes[stack[--top]];
+
+		if (nd.xmin>xmax || nd.xmax<xmin || nd.ymin>ymax || nd.ymax<ymin)
+			continue;
+
+		if (nd.count==0) {
+			stack[top++]=nd.first;
+			stack[top++]=nd.first+1;
+		} else {
+			for (int k=nd.first; k<nd.first+nd.count; k++) {
+				int i=seg[k];
+				if (bbox[4*i]<=xmax && bbox[4*i+1]>=xmin && bbox[4*i+2]<=ymax && bbox[4*i+3]>=ymin)
+					segments.push_back(i);
+			}
+		}
+	}
+}
+
+} // namespace ibex
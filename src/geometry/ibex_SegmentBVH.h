@@ -0,0 +1,84 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_SegmentBVH.h
+// Author      : IBEX contributors
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+//============================================================================
+
+#ifndef __IBEX_SEGMENT_BVH_H__
+#define __IBEX_SEGMENT_BVH_H__
+
+#include "ibex_IntervalVector.h"
+#include <vector>
+
+namespace ibex {
+
+/**
+ * \ingroup geometry
+ *
+ * \brief Bounding-volume hierarchy of segments.
+ *
+ * Selects among a set of segments of the plane those whose bounding
+ * box intersects a given box, without going through all the segments.
+ *
+ * The segments are given like in #ibex::PdcInPolygon: the ith segment
+ * is [a,b] with a=(ax[i],ay[i]) and b=(bx[i],by[i]). The hierarchy is a
+ * binary tree of boxes: the segments are split in two halves (by the
+ * median of their centers along the widest direction) until at most
+ * #LEAF_SIZE segments remain.
+ *
+ * The coordinates are copied: the hierarchy is not updated if the
+ * segments change afterwards.
+ */
+class SegmentBVH {
+public:
+
+	/**
+	 * \brief Build the hierarchy.
+	 */
+	SegmentBVH(const std::vector<double>& ax, const std::vector<double>& ay, const std::vector<double>& bx, const std::vector<double>& by);
+
+	/**
+	 * \brief Indices of the segments whose bounding box intersects \a box.
+	 *
+	 * \param box - a 2-dimensional box (possibly unbounded).
+	 * \param segments - the indices are added to this vector (cleared first).
+	 */
+	void select(const IntervalVector& box, std::vector<int>& segments) const;
+
+	/**
+	 * \brief Maximal number of segments in a leaf.
+	 */
+	static const int LEAF_SIZE;
+
+	/**
+	 * \brief Node of the hierarchy.
+	 *
+	 * A leaf contains the segments seg[first],...,seg[first+count-1]
+	 * (see #seg). An internal node (count=0) has two children, the
+	 * nodes first and first+1.
+	 */
+	struct Node {
+		double xmin, xmax, ymin, ymax;
+		int first;
+		int count;
+	};
+
+private:
+	void build(int node, int begin, int end, const std::vector<double>& cx, const std::vector<double>& cy);
+
+	/** The nodes (the root is the first one). */
+	std::vector<Node> nodes;
+
+	/** Indices of the segments, in the order of the leaves. */
+	std::vector<int> seg;
+
+	/** Bounding box of each segment (xmin, xmax, ymin, ymax). */
+	std::vector<double> bbox;
+};
+
+} // namespace ibex
+
+#endif // __IBEX_SEGMENT_BVH_H__
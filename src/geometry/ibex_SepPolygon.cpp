@@ -20,30 +20,62 @@ using namespace ibex;
 
 namespace {
 
+/*
+ * Union of the contractors of the segments (see CtcUnion), where only
+ * the segments whose bounding box intersects the box are called
+ * (the contraction is empty for the other ones).
+ */
+class CtcSegments : public Ctc {
+public:
+	CtcSegments(vector<double>& ax, vector<double>& ay, vector<double>& bx, vector<double>& by) :
+		Ctc(2), list(ax.size()), bvh(ax,ay,bx,by) {
 
-Array<Ctc> segment_ctc_list(vector<double>& ax, vector<double>& ay, vector<double>& bx, vector<double>& by) {
-	Array<Ctc> l(ax.size());
+		for(unsigned int i=0; i<ax.size(); i++) {
+			list.set_ref(i, *new CtcSegment(ax[i],ay[i],bx[i],by[i]));
+		}
+	}
 
-	for(unsigned int i=0; i<ax.size(); i++) {
-		l.set_ref(i, *new CtcSegment(ax[i],ay[i],bx[i],by[i]));
+	~CtcSegments() {
+		for(int i=0; i<list.size(); i++) {
+			delete &list[i];
+		}
 	}
-	return l;
-}
+
+	void contract(IntervalVector& box) {
+		bvh.select(box, selected);
+
+		IntervalVector savebox(box);
+		IntervalVector result(IntervalVector::empty(box.size()));
+
+		for (unsigned int k=0; k<selected.size(); k++) {
+			if (k>0) box=savebox;
+			try {
+				list[selected[k]].contract(box);
+				result |= box;
+			}
+			catch(EmptyBoxException&) {
+			}
+		}
+		box = result;
+		if (box.is_empty()) throw EmptyBoxException();
+	}
+
+	Array<Ctc> list;
+	SegmentBVH bvh;
+	vector<int> selected;
+};
 
 } // end anonymous namespace
 
 namespace ibex {
 
 SepPolygon::SepPolygon(vector<double> &_ax, vector<double> &_ay, vector<double> &_bx, vector<double> &_by) :
-    		SepBoundaryCtc(*new CtcUnion(segment_ctc_list(_ax,_ay, _bx, _by)),
+    		SepBoundaryCtc(*new CtcSegments(_ax,_ay, _bx, _by),
     				       *new PdcInPolygon(_ax,_ay,_bx,_by)) {
 
 }
 
 SepPolygon::~SepPolygon() {
-	for(unsigned int i=0; i<((CtcUnion&) ctc_boundary).list.size(); i++) {
-		delete & (((CtcUnion&) ctc_boundary).list[i]);
-	}
 	delete &ctc_boundary;
 
 	delete &is_inside;
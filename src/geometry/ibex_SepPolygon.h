@@ -74,6 +74,8 @@ public:
      * The polygon boundary contractor is composed of a union of
      * contractor on segments (CtcSegment).
      * This contractor is minimal as an union of minimal contractors.
+     * Only the segments whose bounding box intersects the box are
+     * called (see #ibex::SegmentBVH).
      * See #ibex::SepBoundaryCtc.
      *
      * \param ax list of x coordinate of the first point of each segment
@@ -12,6 +12,7 @@
 #include <float.h>
 #include "ibex_Linear.h"
 #include "ibex_LinearException.h"
+#include "ibex_IntervalKernels.h"
 
 #define TOO_LARGE 1e30
 #define TOO_SMALL 1e-10
@@ -298,7 +299,9 @@ void gauss_seidel(const IntervalMatrix& A, const IntervalVector& b, IntervalVect
 			old = x[i];
 			proj = b[i];
 
-			for (int j=0; j<n; j++)	if (j!=i) proj -= A[i][j]*x[j];
+			// proj -= A[i][j]*x[j] for all j!=i
+			sub_dot_kernel(&A[i][0],&x[0],i,proj);
+			sub_dot_kernel(&A[i][0]+i+1,&x[0]+i+1,n-i-1,proj);
 			tmp=A[i][i];
 
 			bwd_mul(proj,tmp,x[i]);
@@ -328,7 +331,9 @@ bool inflating_gauss_seidel(const IntervalMatrix& A, const IntervalVector& b, In
 		xold = x;
 		for (int i=0; i<n; i++) {
 			proj = b[i];
-			for (int j=0; j<n; j++)	if (j!=i) proj -= A[i][j]*x[j];
+			// proj -= A[i][j]*x[j] for all j!=i
+			sub_dot_kernel(&A[i][0],&x[0],i,proj);
+			sub_dot_kernel(&A[i][0]+i+1,&x[0]+i+1,n-i-1,proj);
 			x[i] = proj/A[i][i];
 		}
 		d=distance(xold,x);
@@ -10,6 +10,10 @@
 
 #include "ibex_LinearSolver.h"
 
+#ifdef _IBEX_WITH_NATIVE_LP_
+#include <fstream>
+#endif
+
 
 namespace ibex {
 
@@ -78,7 +82,14 @@ LinearSolver::LinearSolver(int nb_vars1, int nb_ctr, int max_iter, int max_time_
 			status_prim(soplex::SPxSolver::UNKNOWN), status_dual(soplex::SPxSolver::UNKNOWN)  {
 
 
-	mysoplex= new soplex::SoPlex();
+	// The simplex solver is used directly (instead of the soplex::SoPlex
+	// wrapper that copies and reloads the LP at each call to solve()), so that
+	// the basis and its factorization are kept from one LP to the next.
+	mysoplex= new soplex::SPxSolver(soplex::SPxSolver::LEAVE, soplex::SPxSolver::COLUMN);
+	mysoplex->setSolver(new soplex::SLUFactor(), true);
+	mysoplex->setTester(new soplex::SPxFastRT(), true);
+	mysoplex->setPricer(new soplex::SPxSteepPR(), true);
+	mysoplex->setStarter(0);
 
 	mysoplex->changeSense(soplex::SPxLP::MINIMIZE);
 	mysoplex->setTerminationIter(max_iter);
@@ -378,7 +389,9 @@ void LinearSolver::initBoundVar(IntervalVector bounds) {
 	try {
 		for (int j=0; j<nb_vars; j++){
 			// Change the LHS and RHS of each constraint associated to the bounds of the variable
-			mysoplex->changeRange(j ,bounds[j].lb(),bounds[j].ub());
+			// (only if they differ: changing a range invalidates the current solution)
+			if (mysoplex->lhs(j)!=bounds[j].lb() || mysoplex->rhs(j)!=bounds[j].ub())
+				mysoplex->changeRange(j ,bounds[j].lb(),bounds[j].ub());
 		}
 	}
 	catch(soplex::SPxException& ) {
@@ -390,7 +403,8 @@ void LinearSolver::initBoundVar(IntervalVector bounds) {
 void LinearSolver::setBoundVar(int var, Interval bound) {
 
 	try {
-		mysoplex->changeRange(var ,bound.lb(),bound.ub());
+		if (mysoplex->lhs(var)!=bound.lb() || mysoplex->rhs(var)!=bound.ub())
+			mysoplex->changeRange(var ,bound.lb(),bound.ub());
 		//std::cout << "improve bound var "<<var<< std::endl;
 	}
 	catch(soplex::SPxException& ) {
@@ -2022,6 +2036,258 @@ LinearSolver::Status LinearSolver::addConstraint(ibex::Vector& row, CmpOp sign,
 */
 
 
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifdef _IBEX_WITH_NATIVE_LP_
+
+LinearSolver::LinearSolver(int nb_vars1, int nb_ctr, int max_iter, int max_time_out, double eps) :
+			nb_ctrs(nb_ctr), nb_vars(nb_vars1), nb_rows(0), obj_value(0.0), epsilon(eps),
+			primal_solution(new double[nb_vars1]), dual_solution(NULL),
+			status_prim(0), status_dual(0), mysimplex(new Simplex(nb_vars1)), maximize(false) {
+
+	mysimplex->set_max_iter(max_iter);
+	mysimplex->set_time_limit(max_time_out);
+	mysimplex->set_tolerance(eps);
+
+	// initialize the constraint of the bound of the variable
+	for (int j=0; j<nb_vars; j++){
+		Vector row1=Vector::zeros(nb_vars);
+		row1[j]=1.0;
+		mysimplex->add_row(row1, NEG_INFINITY, POS_INFINITY);
+	}
+
+	nb_rows += nb_vars;
+}
+
+LinearSolver::~LinearSolver() {
+	if (primal_solution) delete [] primal_solution;
+	if (dual_solution) delete [] dual_solution;
+	delete mysimplex;
+}
+
+LinearSolver::Status_Sol LinearSolver::solve() {
+
+	LinearSolver::Status_Sol res= UNKNOWN;
+	double sign = maximize? -1 : 1;
+
+	switch (mysimplex->solve()) {
+	case Simplex::OPTIMAL: {
+		obj_value = sign*mysimplex->obj_value();
+
+		// the primal solution : used by choose_next_variable
+		for (int i=0; i< nb_vars ; i++) {
+			primal_solution[i]=mysimplex->primal(i);
+		}
+		status_prim = 1;
+
+		// the dual solution ; used by Neumaier Shcherbina test
+		if (dual_solution != NULL) delete [] dual_solution;
+		dual_solution = new double[nb_rows];
+		for (int i=0; i<nb_rows; i++) {
+			double dual=sign*mysimplex->dual(i);
+			if 	( ((mysimplex->rhs(i) >=  default_max_bound) && (dual<=0)) ||
+					((mysimplex->lhs(i) <= -default_max_bound) && (dual>=0))   ) {
+				dual_solution[i]=0;
+			}
+			else {
+				dual_solution[i]=dual;
+			}
+		}
+		status_dual = 1;
+		res= OPTIMAL;
+		break;
+	}
+	case Simplex::INFEASIBLE:
+		res = INFEASIBLE_NOTPROVED;
+		break;
+	case Simplex::TIME_OUT:
+		res = TIME_OUT;
+		break;
+	case Simplex::MAX_ITER:
+		res = MAX_ITER;
+		break;
+	default:
+		res = UNKNOWN;
+	}
+
+	return res;
+}
+
+void LinearSolver::writeFile(const char* name) {
+
+	std::ofstream file(name);
+	if (!file) throw LPException();
+
+	file.precision(17);
+	file << (maximize? "Maximize" : "Minimize") << std::endl << " obj:";
+	double sign = maximize? -1 : 1;
+	for (int j=0; j<nb_vars; j++) {
+		if (mysimplex->cost(j)!=0) file << " + " << sign*mysimplex->cost(j) << " x" << j;
+	}
+	file << std::endl << "Subject To" << std::endl;
+	for (int i=0; i<nb_rows; i++) {
+		bool lhs=mysimplex->lhs(i)>-default_max_bound;
+		bool rhs=mysimplex->rhs(i)< default_max_bound;
+		if (!lhs && !rhs) continue;
+		file << " c" << i << ": ";
+		if (lhs && rhs) file << mysimplex->lhs(i) << " <= ";
+		for (int j=0; j<nb_vars; j++) {
+			if (mysimplex->coef(i,j)!=0) file << " + " << mysimplex->coef(i,j) << " x" << j;
+		}
+		if (rhs) file << " <= " << mysimplex->rhs(i) << std::endl;
+		else file << " >= " << mysimplex->lhs(i) << std::endl;
+	}
+	file << "Bounds" << std::endl;
+	for (int j=0; j<nb_vars; j++) {
+		file << " x" << j << " free" << std::endl;
+	}
+	file << "End" << std::endl;
+}
+
+void LinearSolver::getCoefConstraint(Matrix &A) {
+
+	for (int i=0;i<nb_rows; i++){
+		for (int j=0;j<nb_vars; j++){
+			A.row(i)[j] = mysimplex->coef(i,j);
+		}
+	}
+}
+
+void LinearSolver::getCoefConstraint_trans(Matrix &A_trans) {
+
+	for (int i=0;i<nb_rows; i++){
+		for (int j=0;j<nb_vars; j++){
+			A_trans.row(j)[i] = mysimplex->coef(i,j);
+		}
+	}
+}
+
+void  LinearSolver::getB(IntervalVector& B) {
+
+	// Get the bounds of the variables
+	for (int i=0;i<nb_vars; i++){
+		B[i]=Interval( mysimplex->lhs(i) , mysimplex->rhs(i) );
+	}
+
+	// Get the bounds of the constraints
+	for (int i=nb_vars;i<nb_rows; i++){
+		B[i]=Interval( 	(mysimplex->lhs(i)>-default_max_bound)? mysimplex->lhs(i):-default_max_bound,
+				        (mysimplex->rhs(i)< default_max_bound)? mysimplex->rhs(i): default_max_bound   );
+	}
+}
+
+void LinearSolver::getPrimalSol(Vector & solution_primal) {
+
+	if (status_prim == 1) {
+		for (int i=0; i< nb_vars ; i++) {
+			solution_primal[i] = primal_solution[i];
+		}
+	}
+}
+
+void LinearSolver::getDualSol(Vector & solution_dual) {
+
+	if (status_dual == 1) {
+		for (int i=0; i<nb_rows; i++) {
+			solution_dual[i] = dual_solution[i];
+		}
+	}
+}
+
+void LinearSolver::getInfeasibleDir(Vector & sol) {
+
+	for (int i=0; i<nb_rows; i++) {
+		double dir=mysimplex->farkas(i);
+		if (((mysimplex->lhs(i) <= -default_max_bound) && (dir>=0))||
+			((mysimplex->rhs(i) >=  default_max_bound) && (dir<=0))	) {
+			sol[i]=0.0;
+		}
+		else {
+			sol[i]=dir;
+		}
+	}
+}
+
+void LinearSolver::cleanConst() {
+
+	if (dual_solution!=NULL) delete[] dual_solution;
+	dual_solution=NULL;
+	status_prim = 0;
+	status_dual = 0;
+	mysimplex->remove_rows(nb_vars);
+	nb_rows = nb_vars;
+	obj_value = POS_INFINITY;
+}
+
+void LinearSolver::cleanAll() {
+
+	if (dual_solution!=NULL) delete[] dual_solution;
+	dual_solution=NULL;
+	status_prim = 0;
+	status_dual = 0;
+	mysimplex->remove_rows(0);
+	nb_rows = 0;
+	obj_value = POS_INFINITY;
+}
+
+void LinearSolver::setMaxIter(int max) {
+	mysimplex->set_max_iter(max);
+}
+
+void LinearSolver::setMaxTimeOut(int time) {
+	mysimplex->set_time_limit(time);
+}
+
+void LinearSolver::setSense(Sense s) {
+
+	if (s!=LinearSolver::MINIMIZE && s!=LinearSolver::MAXIMIZE)
+		throw LPException();
+
+	// the simplex always minimizes: the objective is negated
+	if ((s==LinearSolver::MAXIMIZE) != maximize) {
+		for (int j=0; j<nb_vars; j++)
+			mysimplex->set_obj(j, -mysimplex->cost(j));
+		maximize = !maximize;
+	}
+}
+
+void LinearSolver::setVarObj(int var, double coef) {
+	mysimplex->set_obj(var, maximize? -coef : coef);
+}
+
+void LinearSolver::initBoundVar(IntervalVector bounds) {
+
+	// Change the LHS and RHS of each constraint associated to the bounds of the variable
+	for (int j=0; j<nb_vars; j++){
+		mysimplex->set_bounds(j, bounds[j].lb(), bounds[j].ub());
+	}
+}
+
+void LinearSolver::setBoundVar(int var, Interval bound) {
+	mysimplex->set_bounds(var, bound.lb(), bound.ub());
+}
+
+void LinearSolver::setEpsilon(double eps) {
+	mysimplex->set_tolerance(eps);
+	epsilon = eps;
+}
+
+void LinearSolver::addConstraint(ibex::Vector& row, CmpOp sign, double rhs) {
+
+	if (sign==LEQ || sign==LT) {
+		mysimplex->add_row(row, NEG_INFINITY, rhs);
+		nb_rows++;
+	}
+	else if (sign==GEQ || sign==GT) {
+		mysimplex->add_row(row, rhs, POS_INFINITY);
+		nb_rows++;
+	}
+	else
+		throw LPException();
+}
+
+#endif  // END DEF with NATIVE_LP
+
+
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 #ifdef _IBEX_WITH_NOLP_
 
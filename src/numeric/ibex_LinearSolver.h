@@ -39,6 +39,9 @@
 #include <ilcplex/ilocplex.h>
 // TODO not finish yet
 #else
+#ifdef _IBEX_WITH_NATIVE_LP_
+#include "ibex_Simplex.h"
+#else
 #ifdef _IBEX_WITH_NOLP_
 // nothing
 #endif
@@ -46,6 +49,7 @@
 #endif
 #endif
 #endif
+#endif
 
 namespace ibex {
 
@@ -69,7 +73,7 @@ private:
 	int status_dual; //= 1 if OK
 
 #ifdef _IBEX_WITH_SOPLEX_
-	soplex::SoPlex *mysoplex;
+	soplex::SPxSolver *mysoplex;
 #endif
 
 #ifdef _IBEX_WITH_CPLEX_
@@ -95,6 +99,11 @@ private:
 	int * _col1Index;
 #endif
 
+#ifdef _IBEX_WITH_NATIVE_LP_
+	Simplex *mysimplex;
+	bool maximize; // the objective of mysimplex is negated
+#endif
+
 
 public:
 
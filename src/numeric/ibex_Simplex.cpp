@@ -0,0 +1,473 @@
+/* ============================================================================
+ * I B E X - Bounded dual simplex
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : IBEX contributors
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "ibex_Simplex.h"
+#include "ibex_Interval.h"
+
+#include <cmath>
+#include <cassert>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+/* Tolerance on the reduced costs */
+const double DUAL_TOL=1e-9;
+
+/* Smallest pivot */
+const double PIVOT_TOL=1e-9;
+
+/* Number of updates of the inverse between two factorizations */
+const int MAX_UPDATES=100;
+
+/* First artificial bound (multiplied by the largest finite bound) */
+const double BIG=1e6;
+
+/* Largest artificial bound */
+const double MAX_BIG=1e15;
+
+/* Bounds beyond this value are considered as infinite */
+const double INF_BOUND=1e20;
+
+inline bool finite(double x) {
+	return x>-INF_BOUND && x<INF_BOUND;
+}
+
+}
+
+Simplex::Simplex(int nb_vars) : n(nb_vars), m(0), c(nb_vars,0.0),
+		lo(nb_vars,NEG_INFINITY), up(nb_vars,POS_INFINITY), z(nb_vars,0.0), d(nb_vars,0.0),
+		where(nb_vars,AT_ZERO), factored(true), need_crash(true), nb_updates(0), big(BIG),
+		max_iter(10000), time_limit(-1), eps(1e-9), iter(0), obj(0) {
+}
+
+void Simplex::add_row(const Vector& a, double lhs, double rhs) {
+	assert(a.size()==n);
+	for (int j=0; j<n; j++) A.push_back(a[j]);
+	lo.push_back(lhs);
+	up.push_back(rhs);
+	z.push_back(0);
+	d.push_back(0);
+	y.push_back(0);
+	// the slack of the new row is basic
+	head.push_back(n+m);
+	where.push_back(m);
+	m++;
+	factored=false;
+}
+
+void Simplex::remove_rows(int first) {
+	assert(first>=0 && first<=m);
+
+	// the basis is kept if all the slacks of the removed rows are basic
+	vector<int> head2;
+	for (int r=0; r<m; r++) {
+		if (head[r]<n+first) {
+			where[head[r]]=head2.size();
+			head2.push_back(head[r]);
+		}
+	}
+	if ((int) head2.size()!=first) need_crash=true;
+	head=head2;
+
+	m=first;
+	A.resize(m*n);
+	lo.resize(n+m);
+	up.resize(n+m);
+	z.resize(n+m);
+	d.resize(n+m);
+	y.resize(m);
+	where.resize(n+m);
+	factored=false;
+}
+
+void Simplex::set_bounds(int i, double lhs, double rhs) {
+	lo[n+i]=lhs;
+	up[n+i]=rhs;
+}
+
+void Simplex::ftran(int j, vector<double>& w) const {
+	w.assign(m,0.0);
+	if (j<n) {
+		for (int i=0; i<m; i++) {
+			double a=A[i*n+j];
+			if (a==0) continue;
+			for (int r=0; r<m; r++)
+				w[r]+=binv[r*m+i]*a;
+		}
+	} else {
+		for (int r=0; r<m; r++)
+			w[r]=-binv[r*m+(j-n)];
+	}
+}
+
+double Simplex::dot(const vector<double>& rho, int j) const {
+	if (j<n) {
+		double s=0;
+		for (int i=0; i<m; i++)
+			s+=rho[i]*A[i*n+j];
+		return s;
+	} else
+		return -rho[j-n];
+}
+
+bool Simplex::refactor() {
+	// Gauss-Jordan elimination on [B | I]
+	vector<double> B(m*m,0.0);
+	for (int r=0; r<m; r++) {
+		int j=head[r];
+		if (j<n)
+			for (int i=0; i<m; i++) B[i*m+r]=A[i*n+j];
+		else
+			B[(j-n)*m+r]=-1;
+	}
+
+	binv.assign(m*m,0.0);
+	for (int i=0; i<m; i++) binv[i*m+i]=1;
+
+	for (int k=0; k<m; k++) {
+		int p=k;
+		for (int i=k+1; i<m; i++)
+			if (fabs(B[i*m+k])>fabs(B[p*m+k])) p=i;
+		if (fabs(B[p*m+k])<PIVOT_TOL) return false;
+
+		if (p!=k) {
+			for (int l=0; l<m; l++) {
+				std::swap(B[p*m+l],B[k*m+l]);
+				std::swap(binv[p*m+l],binv[k*m+l]);
+			}
+		}
+
+		double piv=B[k*m+k];
+		for (int l=0; l<m; l++) {
+			B[k*m+l]/=piv;
+			binv[k*m+l]/=piv;
+		}
+
+		for (int i=0; i<m; i++) {
+			if (i==k) continue;
+			double f=B[i*m+k];
+			if (f==0) continue;
+			for (int l=k; l<m; l++) B[i*m+l]-=f*B[k*m+l];
+			for (int l=0; l<m; l++) binv[i*m+l]-=f*binv[k*m+l];
+		}
+	}
+
+	factored=true;
+	nb_updates=0;
+	return true;
+}
+
+void Simplex::crash() {
+	// A variable x_j is basic in the first row that bounds it (a row with x_j only),
+	// the other rows have their slack in the basis.
+	for (int j=0; j<n; j++) where[j]=AT_ZERO;
+
+	for (int i=0; i<m; i++) {
+		int j=-1;
+		int nb=0;
+		for (int l=0; l<n && nb<2; l++) {
+			if (A[i*n+l]!=0) { j=l; nb++; }
+		}
+		if (nb==1 && where[j]==AT_ZERO) {
+			head[i]=j;
+			where[j]=i;
+			where[n+i]=finite(lo[n+i]) || !finite(up[n+i])? AT_LB : AT_UB;
+		} else {
+			head[i]=n+i;
+			where[n+i]=i;
+		}
+	}
+	need_crash=false;
+
+	if (!refactor()) {
+		// a pivot of the crash basis is too small: take the
+		// slack basis instead (B=-I is always regular)
+		for (int j=0; j<n; j++) where[j]=AT_ZERO;
+		for (int i=0; i<m; i++) {
+			head[i]=n+i;
+			where[n+i]=i;
+		}
+		refactor();
+	}
+}
+
+double Simplex::nonbasic_value(int j) const {
+	switch (where[j]) {
+	case AT_LB : return finite(wlo[j])? wlo[j] : 0;
+	case AT_UB : return finite(wup[j])? wup[j] : 0;
+	default    : return 0;
+	}
+}
+
+void Simplex::compute_primal() {
+	// B z_B = - N z_N
+	vector<double> v(m,0.0);
+	for (int j=0; j<n+m; j++) {
+		if (where[j]>=0) continue;
+		z[j]=nonbasic_value(j);
+		if (z[j]==0) continue;
+		if (j<n)
+			for (int i=0; i<m; i++) v[i]+=A[i*n+j]*z[j];
+		else
+			v[j-n]-=z[j];
+	}
+	for (int r=0; r<m; r++) {
+		double s=0;
+		for (int i=0; i<m; i++) s+=binv[r*m+i]*v[i];
+		z[head[r]]=-s;
+	}
+}
+
+void Simplex::compute_duals() {
+	// y^T = c_B^T B^{-1}
+	for (int i=0; i<m; i++) y[i]=0;
+	for (int r=0; r<m; r++) {
+		int j=head[r];
+		if (j>=n || c[j]==0) continue;
+		for (int i=0; i<m; i++) y[i]+=c[j]*binv[r*m+i];
+	}
+	for (int j=0; j<n+m; j++)
+		d[j] = where[j]>=0 ? 0 : (j<n? c[j] : 0) - dot(y,j);
+}
+
+void Simplex::make_dual_feasible() {
+	double bound=1;
+	for (int j=0; j<n+m; j++) {
+		if (finite(lo[j]) && fabs(lo[j])>bound) bound=fabs(lo[j]);
+		if (finite(up[j]) && fabs(up[j])>bound) bound=fabs(up[j]);
+	}
+	big=BIG*bound;
+
+	wlo=lo;
+	wup=up;
+
+	for (int j=0; j<n+m; j++) {
+		if (where[j]>=0) continue;
+		if (lo[j]==up[j])
+			where[j]=AT_LB;
+		else if (d[j]>DUAL_TOL) {
+			where[j]=AT_LB;
+			if (!finite(lo[j])) wlo[j]=-big;
+		} else if (d[j]<-DUAL_TOL) {
+			where[j]=AT_UB;
+			if (!finite(up[j])) wup[j]=big;
+		} else if (where[j]==AT_ZERO || (where[j]==AT_LB && !finite(lo[j])) || (where[j]==AT_UB && !finite(up[j]))) {
+			where[j] = finite(lo[j])? AT_LB : (finite(up[j])? AT_UB : AT_ZERO);
+		}
+	}
+}
+
+bool Simplex::enlarge_artificial_bounds() {
+	bool active=false;
+	for (int j=0; j<n+m; j++) {
+		if (where[j]>=0) continue;
+		if ((where[j]==AT_LB && wlo[j]!=lo[j]) || (where[j]==AT_UB && wup[j]!=up[j])) {
+			active=true;
+			break;
+		}
+	}
+	if (!active) return true;
+	if (big*1e3>MAX_BIG) return false;
+
+	big*=1e3;
+	for (int j=0; j<n+m; j++) {
+		if (where[j]>=0) continue;
+		if (wlo[j]!=lo[j]) wlo[j]=-big;
+		if (wup[j]!=up[j]) wup[j]=big;
+	}
+	compute_primal();
+	return true;
+}
+
+int Simplex::choose_leaving(int& dir) const {
+	int r=-1;
+	double max_viol=0;
+	for (int k=0; k<m; k++) {
+		int j=head[k];
+		double tol=eps*(1+fabs(z[j]));
+		if (z[j]<wlo[j]-tol && wlo[j]-z[j]>max_viol) {
+			r=k; dir=1; max_viol=wlo[j]-z[j];
+		} else if (z[j]>wup[j]+tol && z[j]-wup[j]>max_viol) {
+			r=k; dir=-1; max_viol=z[j]-wup[j];
+		}
+	}
+	return r;
+}
+
+int Simplex::choose_entering(int r, int dir, const vector<double>& alpha) const {
+	// Harris ratio test.
+	// The rth basic variable changes by -alpha[j] when x_j increases by 1
+	// and must increase if dir=1 (decrease if dir=-1).
+	double theta_max=POS_INFINITY;
+	for (int j=0; j<n+m; j++) {
+		if (where[j]>=0 || wlo[j]==wup[j]) continue;
+		double a=-dir*alpha[j];
+		if (fabs(a)<PIVOT_TOL) continue;
+		if ((where[j]==AT_LB && a<0) || (where[j]==AT_UB && a>0)) continue;
+		double t=(fabs(d[j])+DUAL_TOL)/fabs(a);
+		if (t<theta_max) theta_max=t;
+	}
+	if (theta_max==POS_INFINITY) return -1;
+
+	int q=-1;
+	double max_alpha=0;
+	for (int j=0; j<n+m; j++) {
+		if (where[j]>=0 || wlo[j]==wup[j]) continue;
+		double a=-dir*alpha[j];
+		if (fabs(a)<PIVOT_TOL) continue;
+		if ((where[j]==AT_LB && a<0) || (where[j]==AT_UB && a>0)) continue;
+		if (fabs(d[j])/fabs(a)<=theta_max && fabs(a)>max_alpha) {
+			q=j; max_alpha=fabs(a);
+		}
+	}
+	return q;
+}
+
+bool Simplex::pivot(int r, int q, int dir, const vector<double>& rho, const vector<double>& alpha) {
+	vector<double> w;
+	ftran(q,w);
+
+	double piv=w[r];
+	if (fabs(piv)<PIVOT_TOL || fabs(piv-alpha[q])>1e-7*(1+fabs(piv)))
+		return false; // numerical trouble
+
+	int p=head[r];
+
+	// primal update: the leaving variable goes to its violated bound
+	double b = dir>0 ? wlo[p] : wup[p];
+	double delta=(z[p]-b)/piv;
+	for (int k=0; k<m; k++) z[head[k]]-=w[k]*delta;
+	z[q]+=delta;
+	z[p]=b;
+
+	// dual update
+	double theta=d[q]/alpha[q];
+	for (int j=0; j<n+m; j++)
+		if (where[j]<0) d[j]-=theta*alpha[j];
+	for (int i=0; i<m; i++) y[i]+=theta*rho[i];
+	d[q]=0;
+	d[p]=-theta;
+
+	// the basic variables have their true bounds
+	wlo[q]=lo[q];
+	wup[q]=up[q];
+
+	head[r]=q;
+	where[q]=r;
+	where[p]= dir>0 ? AT_LB : AT_UB;
+
+	// update of the inverse
+	for (int l=0; l<m; l++) binv[r*m+l]/=piv;
+	for (int k=0; k<m; k++) {
+		if (k==r || w[k]==0) continue;
+		double f=w[k];
+		for (int l=0; l<m; l++) binv[k*m+l]-=f*binv[r*m+l];
+	}
+
+	if (++nb_updates>=MAX_UPDATES) {
+		if (!refactor()) return false;
+		compute_primal();
+		compute_duals();
+	}
+	return true;
+}
+
+Simplex::Status Simplex::solve() {
+	iter=0;
+	clock.reset();
+	clock.start();
+
+	if (need_crash) crash();
+	else if (!factored && !refactor()) crash();
+
+	compute_duals();
+	make_dual_feasible();
+	compute_primal();
+
+	vector<double> rho(m);
+	vector<double> alpha(n+m);
+	int nb_trouble=0;
+	bool fresh=true;  // true if the values are not updated by a pivot
+
+	while (true) {
+		int dir=0;
+		int r=choose_leaving(dir);
+
+		if (r==-1) {
+			if (!fresh) {
+				// the values updated by the pivots are recalculated
+				// (they may have been computed with large artificial bounds)
+				compute_primal();
+				compute_duals();
+				fresh=true;
+				continue;
+			}
+
+			// optimal (w.r.t. the artificial bounds)
+			bool active=false;
+			for (int j=0; j<n+m && !active; j++)
+				active = (where[j]==AT_LB && wlo[j]!=lo[j]) || (where[j]==AT_UB && wup[j]!=up[j]);
+
+			if (active) {
+				if (!enlarge_artificial_bounds()) { clock.stop(); return UNBOUNDED; }
+				fresh=false;
+				continue;
+			}
+
+			obj=0;
+			for (int j=0; j<n; j++) obj+=c[j]*z[j];
+			clock.stop();
+			return OPTIMAL;
+		}
+
+		if (iter>=max_iter) { clock.stop(); return MAX_ITER; }
+		if (time_limit>=0 && clock.expired(time_limit)) { clock.stop(); return TIME_OUT; }
+		iter++;
+
+		for (int i=0; i<m; i++) rho[i]=binv[r*m+i];
+		for (int j=0; j<n+m; j++) alpha[j] = where[j]>=0 ? 0 : dot(rho,j);
+
+		int q=choose_entering(r,dir,alpha);
+
+		if (q==-1) {
+			// the rth row proves the infeasibility, unless
+			// a variable of this row is at an artificial bound
+			bool artificial=false;
+			for (int j=0; j<n+m && !artificial; j++)
+				artificial = where[j]<0 && fabs(alpha[j])>=PIVOT_TOL && (wlo[j]!=lo[j] || wup[j]!=up[j]);
+
+			if (artificial) {
+				if (!enlarge_artificial_bounds()) { clock.stop(); return UNKNOWN; }
+				continue;
+			}
+
+			ray.resize(m);
+			for (int i=0; i<m; i++) ray[i]=-dir*rho[i];
+			clock.stop();
+			return INFEASIBLE;
+		}
+
+		fresh=false;
+
+		if (!pivot(r,q,dir,rho,alpha)) {
+			// start again from a fresh factorization
+			if (++nb_trouble>3 || !refactor()) crash();
+			compute_duals();
+			make_dual_feasible();
+			compute_primal();
+		}
+	}
+}
+
+} // end namespace ibex
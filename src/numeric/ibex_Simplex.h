@@ -0,0 +1,340 @@
+/* ============================================================================
+ * I B E X - Bounded dual simplex
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : IBEX contributors
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __IBEX_SIMPLEX_H__
+#define __IBEX_SIMPLEX_H__
+
+#include "ibex_Vector.h"
+#include "ibex_Clock.h"
+
+#include <vector>
+
+namespace ibex {
+
+/**
+ * \ingroup numeric
+ *
+ * \brief Bounded dual simplex.
+ *
+ * Solves the linear program
+ *
+ *     min c^T x  s.t.  lhs <= Ax <= rhs
+ *
+ * where the variables x are free and the bounds of the rows may be infinite.
+ * The bounds of the variables are given by rows (with a single coefficient).
+ *
+ * This solver is tuned for the small and medium linear programs built by
+ * the linear relaxations (see #ibex::LinearRelax), that are solved again
+ * and again with a different objective or different bounds. The basis
+ * and its inverse (a dense matrix) are kept between two calls to #solve():
+ * changing the bounds of a row or the objective does not require any
+ * factorization, the next LP starts from the last optimal basis.
+ * Adding or removing rows keeps the basis too (the added rows have their
+ * slack in the basis) but the inverse is recalculated.
+ *
+ * With a dual feasible basis, the dual simplex is applied directly.
+ * Otherwise, the nonbasic variables are moved to the bound that makes
+ * the basis dual feasible; when this bound is infinite, an artificial
+ * (large) bound is used instead and enlarged if it is active at the end.
+ */
+class Simplex {
+public:
+	/**
+	 * \brief Status of the resolution.
+	 */
+	typedef enum { OPTIMAL, INFEASIBLE, UNBOUNDED, MAX_ITER, TIME_OUT, UNKNOWN } Status;
+
+	/**
+	 * \brief Create a LP with \a nb_vars variables and no row.
+	 *
+	 * The objective is 0.
+	 */
+	Simplex(int nb_vars);
+
+	/**
+	 * \brief Number of variables.
+	 */
+	int nb_vars() const;
+
+	/**
+	 * \brief Number of rows.
+	 */
+	int nb_rows() const;
+
+	/**
+	 * \brief Add the row lhs <= a^T x <= rhs.
+	 *
+	 * \a lhs (resp. \a rhs) may be NEG_INFINITY (resp. POS_INFINITY).
+	 * A bound whose absolute value exceeds 1e20 is considered as infinite.
+	 */
+	void add_row(const Vector& a, double lhs, double rhs);
+
+	/**
+	 * \brief Remove the rows of index >= \a first.
+	 */
+	void remove_rows(int first);
+
+	/**
+	 * \brief Coefficient of the jth variable in the ith row.
+	 */
+	double coef(int i, int j) const;
+
+	/**
+	 * \brief Left-hand side of the ith row.
+	 */
+	double lhs(int i) const;
+
+	/**
+	 * \brief Right-hand side of the ith row.
+	 */
+	double rhs(int i) const;
+
+	/**
+	 * \brief Set the bounds of the ith row.
+	 */
+	void set_bounds(int i, double lhs, double rhs);
+
+	/**
+	 * \brief Set the coefficient of the jth variable in the objective.
+	 */
+	void set_obj(int j, double c);
+
+	/**
+	 * \brief Coefficient of the jth variable in the objective.
+	 */
+	double cost(int j) const;
+
+	/**
+	 * \brief Maximal number of iterations of a call to #solve() (default: 10000).
+	 */
+	void set_max_iter(int max_iter);
+
+	/**
+	 * \brief Time limit of a call to #solve() in seconds, CPU time (default: none).
+	 */
+	void set_time_limit(double time_limit);
+
+	/**
+	 * \brief Tolerance on the feasibility of the rows (default: 1e-9).
+	 */
+	void set_tolerance(double eps);
+
+	/**
+	 * \brief Solve the LP.
+	 */
+	Status solve();
+
+	/**
+	 * \brief Optimal value.
+	 *
+	 * \pre The status of the last call to #solve() is OPTIMAL.
+	 */
+	double obj_value() const;
+
+	/**
+	 * \brief Value of the jth variable.
+	 *
+	 * \pre The status of the last call to #solve() is OPTIMAL.
+	 */
+	double primal(int j) const;
+
+	/**
+	 * \brief Dual value of the ith row.
+	 *
+	 * The dual value is positive (resp. negative) when the row
+	 * is on its left-hand (resp. right-hand) side and c=A^T y.
+	 *
+	 * \pre The status of the last call to #solve() is OPTIMAL.
+	 */
+	double dual(int i) const;
+
+	/**
+	 * \brief Infeasibility certificate.
+	 *
+	 * Returns the ith component of a vector y such that A^T y=0 and
+	 * sum_{y_i>0} y_i lhs_i + sum_{y_i<0} y_i rhs_i > 0, which proves
+	 * that the rows are inconsistent.
+	 *
+	 * \pre The status of the last call to #solve() is INFEASIBLE.
+	 */
+	double farkas(int i) const;
+
+	/**
+	 * \brief Number of iterations of the last call to #solve().
+	 */
+	int nb_iter() const;
+
+private:
+	/* Status of a nonbasic variable (a basic variable has its position in the basis) */
+	enum { AT_LB=-1, AT_UB=-2, AT_ZERO=-3 };
+
+	/* jth column of [A | -I] multiplied by the inverse of the basis */
+	void ftran(int j, std::vector<double>& w) const;
+
+	/* rho^T times the jth column of [A | -I] */
+	double dot(const std::vector<double>& rho, int j) const;
+
+	/* Calculate the inverse of the basis. Return false if the basis is singular. */
+	bool refactor();
+
+	/* Initial basis */
+	void crash();
+
+	/* Calculate the basic variables from the nonbasic ones */
+	void compute_primal();
+
+	/* Calculate the dual values and the reduced costs */
+	void compute_duals();
+
+	/* Value of a nonbasic variable */
+	double nonbasic_value(int j) const;
+
+	/* Move the nonbasic variables to the bounds that make the basis dual feasible */
+	void make_dual_feasible();
+
+	/* Replace the artificial bounds that are active by larger ones. Return false if too large. */
+	bool enlarge_artificial_bounds();
+
+	/* Basic variable that leaves the basis (-1 if the basis is primal feasible) */
+	int choose_leaving(int& dir) const;
+
+	/* Entering variable (-1 if none) */
+	int choose_entering(int r, int dir, const std::vector<double>& alpha) const;
+
+	/* Replace the rth basic variable by q */
+	bool pivot(int r, int q, int dir, const std::vector<double>& rho, const std::vector<double>& alpha);
+
+	/* Number of variables */
+	const int n;
+
+	/* Number of rows */
+	int m;
+
+	/* The matrix A (m x n, row by row) */
+	std::vector<double> A;
+
+	/* The objective */
+	std::vector<double> c;
+
+	/* The bounds of the n+m variables: x then the slacks s=Ax */
+	std::vector<double> lo, up;
+
+	/* The bounds used by the current resolution (with artificial bounds) */
+	std::vector<double> wlo, wup;
+
+	/* Values of the variables */
+	std::vector<double> z;
+
+	/* Reduced costs */
+	std::vector<double> d;
+
+	/* Dual values of the rows */
+	std::vector<double> y;
+
+	/* Infeasibility certificate */
+	std::vector<double> ray;
+
+	/* The basic variables */
+	std::vector<int> head;
+
+	/* Position in the basis or status of each variable */
+	std::vector<int> where;
+
+	/* The inverse of the basis (m x m, row by row) */
+	std::vector<double> binv;
+
+	/* Whether binv is the inverse of the current basis */
+	bool factored;
+
+	/* Whether the basis has to be built from scratch */
+	bool need_crash;
+
+	/* Number of updates of binv since the last factorization */
+	int nb_updates;
+
+	/* Current artificial bound */
+	double big;
+
+	int max_iter;
+	double time_limit;
+	double eps;
+
+	int iter;
+	double obj;
+
+	Clock clock;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline int Simplex::nb_vars() const {
+	return n;
+}
+
+inline int Simplex::nb_rows() const {
+	return m;
+}
+
+inline double Simplex::coef(int i, int j) const {
+	return A[i*n+j];
+}
+
+inline double Simplex::lhs(int i) const {
+	return lo[n+i];
+}
+
+inline double Simplex::rhs(int i) const {
+	return up[n+i];
+}
+
+inline void Simplex::set_obj(int j, double cj) {
+	c[j]=cj;
+}
+
+inline double Simplex::cost(int j) const {
+	return c[j];
+}
+
+inline void Simplex::set_max_iter(int max_iter) {
+	this->max_iter=max_iter;
+}
+
+inline void Simplex::set_time_limit(double time_limit) {
+	this->time_limit=time_limit;
+}
+
+inline void Simplex::set_tolerance(double eps) {
+	this->eps=eps;
+}
+
+inline double Simplex::obj_value() const {
+	return obj;
+}
+
+inline double Simplex::primal(int j) const {
+	return z[j];
+}
+
+inline double Simplex::dual(int i) const {
+	return y[i];
+}
+
+inline double Simplex::farkas(int i) const {
+	return ray[i];
+}
+
+inline int Simplex::nb_iter() const {
+	return iter;
+}
+
+} // end namespace ibex
+
+#endif // __IBEX_SIMPLEX_H__
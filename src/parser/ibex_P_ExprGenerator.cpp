@@ -89,9 +89,9 @@ void ExprGenerator::visit(const P_ExprPower& e) {
 
 	if (left_type==IBEX_INTERVAL) {
 		if (right_type==IBEX_INTEGER) {
-			clone.insert(e, &ExprConstant::new_scalar(pow(itv_left,int_right)));
+			insert(e, ExprConstant::new_scalar(pow(itv_left,int_right)));
 		} else if (right_type==IBEX_INTERVAL) {
-			clone.insert(e, &ExprConstant::new_scalar(pow(itv_left,itv_right)));
+			insert(e, ExprConstant::new_scalar(pow(itv_left,itv_right)));
 		} else {
 			mark(e.right);
 			clone.insert(e, &exp(RIGHT * log(itv_left))); // *log(...) will create a new ExprConstant.
@@ -99,7 +99,7 @@ void ExprGenerator::visit(const P_ExprPower& e) {
 	}  else {
 		mark(e.left);
 		if (right_type==IBEX_INTEGER) {
-			clone.insert(e, &(pow(LEFT,int_right)));
+			insert(e, pow(LEFT,int_right));
 		} else if (right_type==IBEX_INTERVAL) { // do not forget this case (RIGHT does not exist anymore)
 			clone.insert(e, &exp(itv_right * log(LEFT)));
 		} else {
@@ -125,7 +125,7 @@ void ExprGenerator::visit(const P_ExprIndex& e) {
 	if (fold) {
 		const ExprConstant* c=dynamic_cast<const ExprConstant*>(&LEFT);
 		if (c) {
-			clone.insert(e, &ExprConstant::new_(c->get()[real_index]));
+			insert(e, ExprConstant::new_(c->get()[real_index]));
 			//delete c; // not now (see comment in ExprCopy.h)
 			return;
 		}
@@ -138,14 +138,14 @@ void ExprGenerator::visit(const P_ExprIndex& e) {
 			clone.insert(e, new ExprConstantRef(s->value[real_index]));
 		} else {
 			// "last time": we cannot keep reference anymore.
-			clone.insert(e, &ExprConstant::new_(s->value[real_index]));
+			insert(e, ExprConstant::new_(s->value[real_index]));
 		}
 		//delete s; // not now: there may be inside a DAG (via a function) (see comment in ExprCopy.h)
 		return;
 	}
 
 	mark(e.left);
-	clone.insert(e, &(LEFT[real_index]));
+	insert(e, LEFT[real_index]);
 }
 
 void ExprGenerator::visit(const ExprConstantRef& c) {
@@ -156,12 +156,12 @@ void ExprGenerator::visit(const ExprConstantRef& c) {
 		// last time (in P_ExprIndex)
 		clone.insert(c, new ExprConstantRef(c.value));
 	} else {
-		clone.insert(c, & ExprConstant::new_(c.value)); //ExprConstSymbol(c.value));
+		insert(c, ExprConstant::new_(c.value)); //ExprConstSymbol(c.value));
 	}
 }
 
 void ExprGenerator::visit(const ExprIter& x) {
-	clone.insert(x, & ExprConstant::new_scalar(scope.get_iter_value(x.name)));
+	insert(x, ExprConstant::new_scalar(scope.get_iter_value(x.name)));
 }
 
 void ExprGenerator::visit(const ExprInfinity& x) {
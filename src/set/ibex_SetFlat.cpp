@@ -0,0 +1,407 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_SetFlat.cpp
+// Author      : IBEX contributors
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+//============================================================================
+
+#include "ibex_SetFlat.h"
+#include "ibex_SetLeaf.h"
+#include "ibex_SetBisect.h"
+#include "ibex_Exception.h"
+
+#include <fstream>
+#include <sstream>
+#include <queue>
+#include <cstring>
+#include <cstdio>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+const char MAGIC[8]="IBEXSET";
+const uint32_t VERSION=1;
+
+/*
+ * Append the internal nodes of the subtree in pre-order and
+ * return the status byte of the subtree root.
+ *
+ * Note: the status of an internal node is recalculated
+ * from its children.
+ */
+uint8_t flatten(const SetNode* node, vector<SetFlat::Node>& nodes) {
+	if (node->is_leaf())
+		return ((uint8_t) node->status) | SetFlat::LEAF;
+
+	const SetBisect& b=*((const SetBisect*) node);
+	size_t i=nodes.size();
+	nodes.push_back(SetFlat::Node());
+	nodes[i].pt=b.pt;
+	nodes[i].var=(uint16_t) b.var;
+
+	uint8_t left=flatten(b.left, nodes);
+	uint32_t right_index=(uint32_t) nodes.size();
+	uint8_t right=flatten(b.right, nodes);
+
+	nodes[i].right=(right & SetFlat::LEAF)? 0 : right_index;
+	nodes[i].child[0]=left;
+	nodes[i].child[1]=right;
+
+	return (uint8_t) (((NodeType) (left & ~SetFlat::LEAF)) | ((NodeType) (right & ~SetFlat::LEAF)));
+}
+
+inline NodeType status(uint8_t child) {
+	return (NodeType) (child & ~SetFlat::LEAF);
+}
+
+inline bool is_leaf(uint8_t child) {
+	return child & SetFlat::LEAF;
+}
+
+/*
+ * True if the size of the buffer matches the header
+ * (and the header is in the buffer).
+ */
+bool valid_size(const SetFlat::Header* header, size_t size) {
+	if (size<sizeof(SetFlat::Header) || header->n==0) return false;
+	uint64_t box_size=2*((uint64_t) header->n)*sizeof(double);
+	if (size-sizeof(SetFlat::Header)<box_size) return false;
+	uint64_t nodes_size=size-sizeof(SetFlat::Header)-box_size;
+	return nodes_size%sizeof(SetFlat::Node)==0 && nodes_size/sizeof(SetFlat::Node)==header->nb_nodes;
+}
+
+/*
+ * True if the nodes form a tree in pre-order, i.e., if a traversal
+ * from the root visits the nodes 0,1,...,nb_nodes-1 in this order
+ * (the right child of a node being the next node after its left subtree),
+ * and if all the bisected variables are less than n.
+ *
+ * The other functions can then follow the indices without any check.
+ */
+bool valid_tree(const SetFlat::Header* header, const SetFlat::Node* nodes) {
+	if (header->root & ~0xFF) return false;
+
+	uint64_t next=0;
+	vector<uint32_t> pending; // internal nodes whose right subtree is not visited yet
+	uint8_t child=(uint8_t) header->root;
+
+	while (true) {
+		if (!is_leaf(child)) {
+			if (next>=header->nb_nodes || nodes[next].var>=header->n) return false;
+			pending.push_back(next);
+			child=nodes[next++].child[0]; // the left child is the next node
+		} else if (!pending.empty()) {
+			const SetFlat::Node& node=nodes[pending.back()];
+			pending.pop_back();
+			child=node.child[1];
+			if (!is_leaf(child) && node.right!=next) return false;
+		} else
+			break;
+	}
+
+	return next==header->nb_nodes;
+}
+
+inline IntervalVector left_box(const SetFlat::Node& node, const IntervalVector& nodebox) {
+	IntervalVector leftbox(nodebox);
+	leftbox[node.var]=Interval(nodebox[node.var].lb(),node.pt);
+	return leftbox;
+}
+
+inline IntervalVector right_box(const SetFlat::Node& node, const IntervalVector& nodebox) {
+	IntervalVector rightbox(nodebox);
+	rightbox[node.var]=Interval(node.pt,nodebox[node.var].ub());
+	return rightbox;
+}
+
+/*
+ * Square of the distance between a box and a point (lower bound).
+ */
+double sqr_dist(const IntervalVector& box, const Vector& pt) {
+	Interval d=Interval::ZERO;
+	for (int i=0; i<pt.size(); i++)
+		d += sqr(box[i]-pt[i]);
+	return d.lb();
+}
+
+/*
+ * A subtree waiting in the heap of SetFlat::dist.
+ */
+struct NodeAndDist {
+	NodeAndDist(uint8_t child, uint32_t i, const IntervalVector& box, double dist) : child(child), i(i), box(box), dist(dist) { }
+	uint8_t child;
+	uint32_t i;
+	IntervalVector box;
+	double dist;
+};
+
+struct FarthestFirst {
+	bool operator()(const NodeAndDist* x, const NodeAndDist* y) const {
+		return x->dist > y->dist;
+	}
+};
+
+} // end anonymous namespace
+
+SetFlat::SetFlat(const SetNode* root, const IntervalVector& bounding_box, double eps) : mapped(false) {
+
+	if (bounding_box.size()>0xFFFF) {
+		ibex_error("SetFlat: dimension too large");
+	}
+
+	vector<Node> v;
+	uint8_t root_status=flatten(root, v);
+
+	if (v.size()>0xFFFFFFFF) {
+		ibex_error("SetFlat: too many nodes");
+	}
+
+	int n=bounding_box.size();
+	size=sizeof(Header) + 2*n*sizeof(double) + v.size()*sizeof(Node);
+	data=new char[size];
+
+	Header* h=(Header*) data;
+	memcpy(h->magic, MAGIC, sizeof(MAGIC));
+	h->version=VERSION;
+	h->n=n;
+	h->eps=eps;
+	h->nb_nodes=v.size();
+	h->root=root_status;
+	h->padding=0;
+
+	double* b=(double*) (data+sizeof(Header));
+	for (int i=0; i<n; i++) {
+		b[2*i]=bounding_box[i].lb();
+		b[2*i+1]=bounding_box[i].ub();
+	}
+
+	if (!v.empty())
+		memcpy(data+sizeof(Header)+2*n*sizeof(double), &v[0], v.size()*sizeof(Node));
+
+	header=h;
+	box=b;
+	nodes=(const Node*) (data+sizeof(Header)+2*n*sizeof(double));
+}
+
+SetFlat::SetFlat(const char* filename) : data(NULL), size(0), mapped(false) {
+
+#ifndef _WIN32
+	int fd=open(filename, O_RDONLY);
+	if (fd>=0) {
+		struct stat st;
+		if (fstat(fd, &st)==0 && st.st_size>0) {
+			void* p=mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+			if (p!=MAP_FAILED) {
+				data=(char*) p;
+				size=st.st_size;
+				mapped=true;
+			}
+		}
+		close(fd);
+	}
+#endif
+
+	if (!mapped) {
+		ifstream is(filename, ios::in | ios::binary);
+		if (is.fail()) {
+			stringstream s;
+			s << "SetFlat: cannot open file " << filename;
+			ibex_error(s.str().c_str());
+		}
+		is.seekg(0, ios::end);
+		size=is.tellg();
+		is.seekg(0, ios::beg);
+		data=new char[size];
+		is.read(data, size);
+	}
+
+	header=(const Header*) data;
+
+	if (size<sizeof(Header) || memcmp(header->magic, MAGIC, sizeof(MAGIC))!=0 || header->version!=VERSION
+			|| !valid_size(header, size)) {
+		stringstream s;
+		s << "SetFlat: file " << filename << " does not match the required file format";
+		release();
+		ibex_error(s.str().c_str());
+	}
+
+	box=(const double*) (data+sizeof(Header));
+	nodes=(const Node*) (data+sizeof(Header)+2*header->n*sizeof(double));
+
+	// checked once for all (the queries follow the indices blindly)
+	if (!valid_tree(header, nodes)) {
+		stringstream s;
+		s << "SetFlat: file " << filename << " is corrupted (invalid tree)";
+		release();
+		ibex_error(s.str().c_str());
+	}
+}
+
+SetFlat::~SetFlat() {
+	release();
+}
+
+void SetFlat::release() {
+	if (!data) return;
+#ifndef _WIN32
+	if (mapped) {
+		munmap(data, size);
+		data=NULL;
+		return;
+	}
+#endif
+	delete[] data;
+	data=NULL;
+}
+
+bool SetFlat::is_flat(const char* filename) {
+	ifstream is(filename, ios::in | ios::binary);
+	char magic[sizeof(MAGIC)];
+	is.read(magic, sizeof(MAGIC));
+	return !is.fail() && memcmp(magic, MAGIC, sizeof(MAGIC))==0;
+}
+
+void SetFlat::save(const char* filename) const {
+	// The data may be mapped from the file itself: the file
+	// is written aside and then renamed (the mapping keeps
+	// the old content).
+	string tmp=string(filename)+".tmp";
+	{
+		ofstream os(tmp.c_str(), ios::out | ios::trunc | ios::binary);
+		os.write(data, size);
+		os.close();
+		if (os.fail()) {
+			remove(tmp.c_str());
+			stringstream s;
+			s << "SetFlat: fail to write file " << filename;
+			ibex_error(s.str().c_str());
+		}
+	}
+#ifdef _WIN32
+	// rename does not replace an existing file (and
+	// a file is never mapped under Windows, see above)
+	remove(filename);
+#endif
+	if (rename(tmp.c_str(), filename)!=0) {
+		remove(tmp.c_str());
+		stringstream s;
+		s << "SetFlat: fail to write file " << filename;
+		ibex_error(s.str().c_str());
+	}
+}
+
+IntervalVector SetFlat::bounding_box() const {
+	IntervalVector b(header->n);
+	for (unsigned int i=0; i<header->n; i++)
+		b[i]=Interval(box[2*i],box[2*i+1]);
+	return b;
+}
+
+double SetFlat::eps() const {
+	return header->eps;
+}
+
+SetNode* SetFlat::build() const {
+	return build((uint8_t) header->root, 0);
+}
+
+SetNode* SetFlat::build(uint8_t child, uint32_t i) const {
+	if (is_leaf(child))
+		return new SetLeaf(status(child));
+
+	const Node& node=nodes[i];
+	SetNode* left=build(node.child[0], i+1);
+	SetNode* right=build(node.child[1], node.right);
+	return new SetBisect(node.var, node.pt, left, right);
+}
+
+void SetFlat::visit_leaves(SetNode::leaf_func func) const {
+	visit_leaves(func, (uint8_t) header->root, 0, bounding_box());
+}
+
+void SetFlat::visit_leaves(SetNode::leaf_func func, uint8_t child, uint32_t i, const IntervalVector& nodebox) const {
+	if (is_leaf(child)) {
+		NodeType s=status(child);
+		func(nodebox, s==__IBEX_IN__? YES : (s==__IBEX_OUT__? NO : MAYBE));
+	} else {
+		const Node& node=nodes[i];
+		visit_leaves(func, node.child[0], i+1, left_box(node, nodebox));
+		visit_leaves(func, node.child[1], node.right, right_box(node, nodebox));
+	}
+}
+
+void SetFlat::print(std::ostream& os) const {
+	print(os, (uint8_t) header->root, 0, bounding_box(), 0);
+}
+
+void SetFlat::print(std::ostream& os, uint8_t child, uint32_t i, const IntervalVector& nodebox, int shift) const {
+	for (int k=0; k<shift; k++) os << ' ';
+	if (is_leaf(child)) {
+		os << nodebox << " " << to_string(status(child)) << endl;
+	} else {
+		const Node& node=nodes[i];
+		os << "* " << nodebox << endl;
+		print(os, node.child[0], i+1, left_box(node, nodebox), shift+2);
+		print(os, node.child[1], node.right, right_box(node, nodebox), shift+2);
+	}
+}
+
+double SetFlat::dist(const Vector& pt, bool inside) const {
+	priority_queue<NodeAndDist*, vector<NodeAndDist*>, FarthestFirst> heap;
+
+	IntervalVector root_box=bounding_box();
+	heap.push(new NodeAndDist((uint8_t) header->root, 0, root_box, sqr_dist(root_box,pt)));
+
+	double lb = POS_INFINITY;
+
+	while (!heap.empty()) {
+
+		NodeAndDist* c = heap.top();
+		heap.pop();
+
+		if (c->dist>lb) {
+			// all the remaining subtrees are farther
+			delete c;
+			break;
+		}
+
+		NodeType s=status(c->child);
+
+		if (s==(inside? __IBEX_IN__ : __IBEX_OUT__)) {
+			if (c->dist<lb) lb=c->dist;
+		} else if (!is_leaf(c->child) && (    (inside && possibly_contains_in(s))
+		                                 || (!inside && possibly_contains_out(s)))) {
+			const Node& node=nodes[c->i];
+
+			IntervalVector left=left_box(node, c->box);
+			double d=sqr_dist(left,pt);
+			if (d<=lb) heap.push(new NodeAndDist(node.child[0], c->i+1, left, d));
+
+			IntervalVector right=right_box(node, c->box);
+			d=sqr_dist(right,pt);
+			if (d<=lb) heap.push(new NodeAndDist(node.child[1], node.right, right, d));
+		}
+		delete c;
+	}
+
+	while (!heap.empty()) {
+		delete heap.top();
+		heap.pop();
+	}
+
+	return ::sqrt(lb);
+}
+
+} // namespace ibex
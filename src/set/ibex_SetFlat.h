@@ -0,0 +1,148 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_SetFlat.h
+// Author      : IBEX contributors
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+//============================================================================
+
+#ifndef __IBEX_SET_FLAT_H__
+#define __IBEX_SET_FLAT_H__
+
+#include "ibex_SetNode.h"
+#include <stdint.h>
+
+namespace ibex {
+
+/**
+ * \ingroup iset
+ * \brief Flat (pointer-free) encoding of an i-set tree.
+ *
+ * The internal nodes are stored in an array, in pre-order. A node
+ * is a 16-byte record made of the bisected variable, the bisection
+ * point, the index of the right child and a byte per child giving
+ * its status. The left child of an internal node i, if internal, is
+ * the node i+1. Leaves have no record: they are only represented by
+ * their status in the byte of their parent (with the flag #LEAF).
+ *
+ * This is also the layout of the file written by #save(), so that a
+ * file can be mapped into memory (see #SetFlat(const char*)) and
+ * queried without building any node (see #dist() and #visit_leaves()).
+ *
+ * Layout of the file (native byte order):
+ * - a header (see #Header),
+ * - the bounding box (2n doubles),
+ * - the nodes.
+ */
+class SetFlat {
+public:
+
+	/**
+	 * \brief Flatten a tree.
+	 */
+	SetFlat(const SetNode* root, const IntervalVector& bounding_box, double eps);
+
+	/**
+	 * \brief Open a file written by #save().
+	 *
+	 * The file is mapped into memory (read-only) when
+	 * the system allows it, otherwise it is read.
+	 *
+	 * The indices of the nodes and the bisected variables
+	 * are checked once here (error if the file is corrupted).
+	 */
+	SetFlat(const char* filename);
+
+	/**
+	 * \brief Delete this (unmap the file, if any).
+	 */
+	~SetFlat();
+
+	/**
+	 * \brief True if the file starts like a file written by #save().
+	 */
+	static bool is_flat(const char* filename);
+
+	/**
+	 * \brief Write the set into a file.
+	 *
+	 * The file is first written under another name (\a filename
+	 * followed by ".tmp") and then renamed, so that \a filename
+	 * can be the file this set is mapped from.
+	 */
+	void save(const char* filename) const;
+
+	/**
+	 * \brief Build the (pointer-based) tree.
+	 */
+	SetNode* build() const;
+
+	/**
+	 * \brief The bounding box.
+	 */
+	IntervalVector bounding_box() const;
+
+	/**
+	 * \brief The precision of the set.
+	 */
+	double eps() const;
+
+	/** \see SetInterval::visit_leaves */
+	void visit_leaves(SetNode::leaf_func func) const;
+
+	/** \see SetInterval::dist */
+	double dist(const Vector& pt, bool inside) const;
+
+	/** \see SetNode::print */
+	void print(std::ostream& os) const;
+
+	/**
+	 * \brief Header of the file.
+	 */
+	struct Header {
+		char magic[8];      // "IBEXSET" (with the final '\0')
+		uint32_t version;
+		uint32_t n;         // dimension
+		double eps;
+		uint64_t nb_nodes;  // number of internal nodes
+		uint32_t root;      // status of the root (with the LEAF flag if the root is a leaf)
+		uint32_t padding;
+	};
+
+	/**
+	 * \brief Internal node.
+	 */
+	struct Node {
+		double pt;
+		uint32_t right;      // index of the right child (if internal)
+		uint16_t var;
+		uint8_t child[2];    // status of the left/right child (with the LEAF flag if leaf)
+	};
+
+	/** \brief Flag of a leaf in a status byte. */
+	static const uint8_t LEAF=0x80;
+
+private:
+	friend class SetIndex;
+
+	SetFlat(const SetFlat&); // forbidden
+
+	void release();
+	SetNode* build(uint8_t child, uint32_t i) const;
+	void visit_leaves(SetNode::leaf_func func, uint8_t child, uint32_t i, const IntervalVector& nodebox) const;
+	void print(std::ostream& os, uint8_t child, uint32_t i, const IntervalVector& nodebox, int shift) const;
+
+	/* buffer holding the header, the box and the nodes */
+	char* data;
+	size_t size;
+	bool mapped;
+
+	const Header* header;
+	const double* box;
+	const Node* nodes;
+};
+
+} // namespace ibex
+
+#endif // __IBEX_SET_FLAT_H__
@@ -0,0 +1,358 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_SetIndex.cpp
+// Author      : IBEX contributors
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+//============================================================================
+
+#include "ibex_SetIndex.h"
+#include "ibex_Thread.h"
+#include "ibex_Exception.h"
+
+#include <algorithm>
+#include <vector>
+
+#ifdef __GNUC__
+#define IBEX_PREFETCH(p) __builtin_prefetch(p)
+#else
+#define IBEX_PREFETCH(p)
+#endif
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+/* number of points descending the tree together (batched membership).
+ * A small group stays in registers (4 was the best on the benchmark) */
+const int GROUP=4;
+
+/* index of a point that has reached its leaf (batched membership) */
+const uint32_t DONE=0xFFFFFFFF;
+
+inline BoolInterval to_bool(uint8_t status) {
+	return status==__IBEX_IN__? YES : (status==__IBEX_OUT__? NO : MAYBE);
+}
+
+/*
+ * Square of the distance between a box (lb0,ub0,lb1,ub1,...)
+ * and a point (lower bound). See SetInterval::dist.
+ */
+double sqr_dist(const double* box, const Vector& pt) {
+	Interval d=Interval::ZERO;
+	for (int i=0; i<pt.size(); i++)
+		d += sqr(Interval(box[2*i],box[2*i+1])-pt[i]);
+	return d.lb();
+}
+
+/*
+ * Run the parts of a batch in parallel.
+ */
+void run(vector<Thread*>& batches) {
+	for (unsigned int i=0; i<batches.size(); i++)
+		batches[i]->start();
+
+	for (unsigned int i=0; i<batches.size(); i++) {
+		batches[i]->join();
+		delete batches[i];
+	}
+}
+
+} // end anonymous namespace
+
+/*
+ * Heap of the best-first search of SetIndex::dist. The boxes of the
+ * entries are stored contiguously. The memory is kept from one query
+ * to the next (one heap per thread in the batched queries).
+ */
+struct SetIndex::Heap {
+	struct Entry {
+		double dist;
+		uint32_t node;
+		uint32_t box;   // offset of the box in "boxes"
+	};
+
+	/* the smallest distance on top */
+	static bool greater(const Entry& x, const Entry& y) {
+		return x.dist > y.dist;
+	}
+
+	vector<Entry> entries;
+	vector<double> boxes;
+};
+
+/*
+ * Part of a batch processed by a thread.
+ */
+class SetIndex::Batch : public Thread {
+public:
+	Batch(const SetIndex& index, const Matrix& pts, int first, int last, BoolInterval* res) :
+		index(index), pts(pts), first(first), last(last), inside(false), in(res), d(NULL) { }
+
+	Batch(const SetIndex& index, const Matrix& pts, int first, int last, bool inside, Vector& res) :
+		index(index), pts(pts), first(first), last(last), inside(inside), in(NULL), d(&res) { }
+
+protected:
+	void run() {
+		if (in)
+			index.contains(pts, first, last, in);
+		else
+			index.dist(pts, inside, first, last, *d);
+	}
+
+	const SetIndex& index;
+	const Matrix& pts;
+	const int first;
+	const int last;
+	const bool inside;
+	BoolInterval* in;
+	Vector* d;
+};
+
+SetIndex::SetIndex(const SetInterval& set) : nodes(NULL), size(0), bounding_box(set.bounding_box) {
+
+	if (set.is_empty()) {
+		ibex_error("SetIndex: empty i-set");
+	}
+
+	SetFlat* tmp = set.flat? NULL : new SetFlat(set.root, set.bounding_box, set.eps);
+	const SetFlat& flat = set.flat? *set.flat : *tmp;
+
+	size = 2*flat.header->nb_nodes+1;
+	nodes = new Node[size];
+
+	// the array is filled in breadth-first order (the array
+	// itself is the queue). For each node, "src" is its
+	// status byte and its index in the flat encoding.
+	vector<pair<uint8_t,uint32_t> > src(size);
+	src[0] = make_pair((uint8_t) flat.header->root, 0);
+	uint32_t next=1;
+
+	for (uint32_t i=0; i<size; i++) {
+		uint8_t child=src[i].first;
+		Node& node=nodes[i];
+		node.status = child & ~SetFlat::LEAF;
+		node.leaf = (child & SetFlat::LEAF)? 1 : 0;
+		if (node.leaf) {
+			node.pt = 0;
+			node.var = 0;
+			node.left = 0;
+		} else {
+			uint32_t j=src[i].second;
+			const SetFlat::Node& f=flat.nodes[j];
+			node.pt = f.pt;
+			node.var = f.var;
+			node.left = next;
+			src[next++] = make_pair(f.child[0], j+1);
+			src[next++] = make_pair(f.child[1], f.right);
+		}
+	}
+	assert(next==size);
+
+	delete tmp;
+}
+
+SetIndex::~SetIndex() {
+	delete[] nodes;
+}
+
+BoolInterval SetIndex::contains(const Vector& pt) const {
+	if (!bounding_box.contains(pt)) return NO;
+	return contains(0, pt);
+}
+
+BoolInterval SetIndex::contains(uint32_t i, const Vector& pt) const {
+	while (!nodes[i].leaf) {
+		const Node& node=nodes[i];
+		double x=pt[node.var];
+		if (x<node.pt)
+			i=node.left;
+		else if (x>node.pt)
+			i=node.left+1;
+		else {
+			// on the boundary of both children
+			BoolInterval b1=contains(node.left, pt);
+			BoolInterval b2=contains(node.left+1, pt);
+			return b1==b2? b1 : MAYBE;
+		}
+	}
+	return to_bool(nodes[i].status);
+}
+
+void SetIndex::contains(const Matrix& pts, int start, int end, BoolInterval* res) const {
+	uint32_t cur[GROUP];
+	const double* x[GROUP];
+
+	for (int g=start; g<end; g+=GROUP) {
+		int m=std::min(GROUP, end-g);
+		int active=0;
+
+		for (int k=0; k<m; k++) {
+			if (bounding_box.contains(pts[g+k])) {
+				cur[k]=0;
+				x[k]=&pts[g+k][0];
+				active++;
+			} else {
+				res[g+k]=NO;
+				cur[k]=DONE;
+			}
+		}
+
+		// all the points of the group go down by one level at a time
+		// so that the memory accesses of a level are overlapped.
+		while (active>0) {
+			for (int k=0; k<m; k++) {
+				if (cur[k]==DONE) continue;
+				const Node& node=nodes[cur[k]];
+				if (node.leaf) {
+					res[g+k]=to_bool(node.status);
+					cur[k]=DONE;
+					active--;
+				} else if (x[k][node.var]!=node.pt) {
+					cur[k]=node.left + (x[k][node.var]>node.pt? 1 : 0);
+					IBEX_PREFETCH(&nodes[cur[k]]);
+				} else {
+					res[g+k]=contains(cur[k], pts[g+k]);
+					cur[k]=DONE;
+					active--;
+				}
+			}
+		}
+	}
+}
+
+void SetIndex::contains(const Matrix& pts, BoolInterval* res, int nb_threads) const {
+	int n=pts.nb_rows();
+	if (nb_threads<=1 || n<nb_threads*GROUP) {
+		contains(pts, 0, n, res);
+		return;
+	}
+
+	vector<Thread*> batches;
+	int chunk=(n+nb_threads-1)/nb_threads;
+	for (int start=0; start<n; start+=chunk)
+		batches.push_back(new Batch(*this, pts, start, std::min(n,start+chunk), res));
+
+	run(batches);
+}
+
+double SetIndex::dist(const Vector& pt, bool inside) const {
+	Heap heap;
+	return dist(pt, inside, heap);
+}
+
+double SetIndex::dist(const Vector& pt, bool inside, Heap& heap) const {
+	assert(pt.size()==bounding_box.size());
+
+	int n=bounding_box.size();
+	vector<Heap::Entry>& entries=heap.entries;
+	vector<double>& boxes=heap.boxes;
+	entries.clear();
+	boxes.clear();
+
+	boxes.resize(2*n);
+	for (int i=0; i<n; i++) {
+		boxes[2*i]=bounding_box[i].lb();
+		boxes[2*i+1]=bounding_box[i].ub();
+	}
+	Heap::Entry root = { sqr_dist(&boxes[0],pt), 0, 0 };
+	entries.push_back(root);
+
+	uint8_t target = inside? __IBEX_IN__ : __IBEX_OUT__;
+	double lb = POS_INFINITY;
+
+	while (!entries.empty()) {
+
+		pop_heap(entries.begin(), entries.end(), Heap::greater);
+		Heap::Entry e=entries.back();
+		entries.pop_back();
+
+		if (e.dist>lb) break; // all the remaining nodes are farther
+
+		const Node& node=nodes[e.node];
+
+		if (node.status==target) {
+			if (e.dist<lb) lb=e.dist;
+		} else if (!node.leaf && (    (inside && possibly_contains_in((NodeType) node.status))
+		                          || (!inside && possibly_contains_out((NodeType) node.status)))) {
+
+			IBEX_PREFETCH(&nodes[node.left]);
+
+			// the child on the side of the point is at the
+			// same distance as its parent (see sqr_dist).
+			int near=pt[node.var]<=node.pt? 0 : 1;
+
+			for (int c=0; c<2; c++) {
+				uint32_t b=boxes.size();
+				boxes.resize(b+2*n);
+				std::copy(boxes.begin()+e.box, boxes.begin()+e.box+2*n, boxes.begin()+b);
+				boxes[b+2*node.var+(c==0? 1 : 0)]=node.pt;
+
+				double d=c==near? e.dist : sqr_dist(&boxes[b],pt);
+				if (d<=lb) {
+					Heap::Entry child = { d, node.left+c, b };
+					entries.push_back(child);
+					push_heap(entries.begin(), entries.end(), Heap::greater);
+				} else
+					boxes.resize(b);
+			}
+		}
+	}
+
+	return ::sqrt(lb);
+}
+
+void SetIndex::dist(const Matrix& pts, bool inside, int start, int end, Vector& res) const {
+	Heap heap;
+	for (int i=start; i<end; i++)
+		res[i]=dist(pts[i], inside, heap);
+}
+
+Vector SetIndex::dist(const Matrix& pts, bool inside, int nb_threads) const {
+	int n=pts.nb_rows();
+	Vector res(n);
+
+	if (nb_threads<=1 || n<nb_threads) {
+		dist(pts, inside, 0, n, res);
+		return res;
+	}
+
+	vector<Thread*> batches;
+	int chunk=(n+nb_threads-1)/nb_threads;
+	for (int start=0; start<n; start+=chunk)
+		batches.push_back(new Batch(*this, pts, start, std::min(n,start+chunk), inside, res));
+
+	run(batches);
+
+	return res;
+}
+
+void SetIndex::overlap(const IntervalVector& box, SetNode::leaf_func func) const {
+	if (bounding_box.intersects(box))
+		overlap(0, bounding_box, box, func);
+}
+
+void SetIndex::overlap(uint32_t i, const IntervalVector& nodebox, const IntervalVector& box, SetNode::leaf_func func) const {
+	const Node& node=nodes[i];
+	if (node.leaf) {
+		func(nodebox, to_bool(node.status));
+		return;
+	}
+
+	if (box[node.var].lb()<=node.pt) {
+		IntervalVector left(nodebox);
+		left[node.var]=Interval(nodebox[node.var].lb(),node.pt);
+		overlap(node.left, left, box, func);
+	}
+
+	if (box[node.var].ub()>=node.pt) {
+		IntervalVector right(nodebox);
+		right[node.var]=Interval(node.pt,nodebox[node.var].ub());
+		overlap(node.left+1, right, box, func);
+	}
+}
+
+} // namespace ibex
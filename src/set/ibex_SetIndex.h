@@ -0,0 +1,138 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_SetIndex.h
+// Author      : IBEX contributors
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+//============================================================================
+
+#ifndef __IBEX_SET_INDEX_H__
+#define __IBEX_SET_INDEX_H__
+
+#include "ibex_SetInterval.h"
+#include "ibex_Matrix.h"
+
+namespace ibex {
+
+/**
+ * \ingroup iset
+ * \brief Query engine over a set interval.
+ *
+ * A read-only copy of the tree of an i-set, built for point-location
+ * queries (membership, distance) and box-overlap enumeration.
+ *
+ * The nodes (leaves included) are stored in breadth-first order, in
+ * 16-byte records. The two children of a node are adjacent, so that
+ * the next step of a descent is a single memory access, which is
+ * prefetched in the batched queries: the points of a batch descend
+ * the tree together, one level at a time.
+ *
+ * The batched queries can be split over several threads (the index is
+ * not modified by queries).
+ *
+ * The index is not updated if the set changes afterwards.
+ */
+class SetIndex {
+public:
+
+	/**
+	 * \brief Build the index of a set.
+	 *
+	 * \pre the i-set is not empty (see #SetInterval::is_empty()).
+	 */
+	SetIndex(const SetInterval& set);
+
+	/**
+	 * \brief Delete this.
+	 */
+	~SetIndex();
+
+	/**
+	 * \brief Membership of a point.
+	 *
+	 * \return YES if the leaf containing \a pt is inside the set, NO if it
+	 * is outside and MAYBE otherwise. A point on the boundary of several
+	 * leaves gets YES (NO) only if all of them are inside (outside).
+	 * A point outside the bounding box is outside the set (NO).
+	 */
+	BoolInterval contains(const Vector& pt) const;
+
+	/**
+	 * \brief Membership of points (batch).
+	 *
+	 * The points are the rows of \a pts. Set res[i] to contains(pts[i]).
+	 *
+	 * \param res         - array of pts.nb_rows() elements.
+	 * \param nb_threads  - the batch is split in nb_threads parts.
+	 */
+	void contains(const Matrix& pts, BoolInterval* res, int nb_threads=1) const;
+
+	/**
+	 * \brief Distance of a point to the set (if inside is true)
+	 * or to its complementary (if inside is false).
+	 *
+	 * Same result as #SetInterval::dist(const Vector&, bool) const.
+	 */
+	double dist(const Vector& pt, bool inside) const;
+
+	/**
+	 * \brief Distances of points (batch).
+	 *
+	 * The points are the rows of \a pts.
+	 *
+	 * \param nb_threads  - the batch is split in nb_threads parts.
+	 * \return the vector of the distances of all the points.
+	 */
+	Vector dist(const Matrix& pts, bool inside, int nb_threads=1) const;
+
+	/**
+	 * \brief Call \a func for all the leaves that intersect \a box.
+	 */
+	void overlap(const IntervalVector& box, SetNode::leaf_func func) const;
+
+	/**
+	 * \brief Number of nodes (leaves included).
+	 */
+	int nb_nodes() const;
+
+	/**
+	 * \brief Node (leaves included).
+	 */
+	struct Node {
+		double pt;
+		uint32_t left;    // index of the left child (the right child is left+1)
+		uint16_t var;
+		uint8_t status;   // NodeType
+		uint8_t leaf;
+	};
+
+private:
+	SetIndex(const SetIndex&); // forbidden
+
+	class Batch;
+	friend class Batch;
+	struct Heap;
+
+	BoolInterval contains(uint32_t i, const Vector& pt) const;
+	void contains(const Matrix& pts, int start, int end, BoolInterval* res) const;
+
+	double dist(const Vector& pt, bool inside, Heap& heap) const;
+	void dist(const Matrix& pts, bool inside, int start, int end, Vector& res) const;
+
+	void overlap(uint32_t i, const IntervalVector& nodebox, const IntervalVector& box, SetNode::leaf_func func) const;
+
+	Node* nodes;
+	uint32_t size;
+	IntervalVector bounding_box;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline int SetIndex::nb_nodes() const {
+	return size;
+}
+
+} // namespace ibex
+
+#endif // __IBEX_SET_INDEX_H__
@@ -12,26 +12,47 @@
 #include "ibex_SetBisect.h"
 #include "ibex_CellHeap.h"
 #include "ibex_CellStack.h"
+#include "ibex_Thread.h"
 #include <stack>
 #include <fstream>
 
 using namespace std;
 
+// =========== shortcuts ==================
+#define UNK        __IBEX_UNK__
+// ========================================
+
 namespace ibex {
 
-SetInterval::SetInterval(const IntervalVector& bounding_box, double eps, bool inner) : root(new SetLeaf(inner? __IBEX_IN__: __IBEX_UNK__)), eps(eps), bounding_box(bounding_box) {
+SetInterval::SetInterval(const IntervalVector& bounding_box, double eps, bool inner) : root(new SetLeaf(inner? __IBEX_IN__: __IBEX_UNK__)), flat(NULL), eps(eps), bounding_box(bounding_box) {
 
 }
 
-SetInterval::SetInterval(const char* filename) : root(NULL), eps(-1), bounding_box(1) {
-	load(filename);
+SetInterval::SetInterval(const char* filename) : root(NULL), flat(NULL), eps(-1), bounding_box(1) {
+	if (SetFlat::is_flat(filename)) {
+		flat = new SetFlat(filename);
+		eps = flat->eps();
+		IntervalVector box=flat->bounding_box();
+		bounding_box.resize(box.size());
+		bounding_box = box;
+	} else
+		load(filename);
 }
 
 bool SetInterval::is_empty() const {
-	return root==NULL;
+	return root==NULL && flat==NULL;
+}
+
+void SetInterval::build() {
+	if (flat) {
+		root = flat->build();
+		delete flat;
+		flat = NULL;
+	}
 }
 
 void SetInterval::sync(Sep& sep) {
+	build();
 	try {
 		root = root->sync(bounding_box, sep, eps);
 	} catch(NoSet& e) {
@@ -42,61 +63,196 @@ void SetInterval::sync(Sep& sep) {
 }
 
 void SetInterval::contract(Sep& sep) {
+	build();
 	root->set_in_tmp();
 	root = root->inter(bounding_box, sep, eps);
 	root->unset_in_tmp();
 }
 
-SetInterval& SetInterval::operator&=(const SetInterval& set) {
-	root->set_in_tmp();
-	root = root->inter(bounding_box, set.root, set.bounding_box, eps);
-	root->unset_in_tmp();
-	return *this;
+namespace {
+
+/*
+ * A subtree to be refined by a worker. The slot is the pointer
+ * to the subtree in its parent (or the root of the set).
+ */
+struct Subtree {
+	Subtree(SetNode** slot, const IntervalVector& box) : slot(slot), box(box) { }
+	SetNode** slot;
+	IntervalVector box;
+};
+
+/*
+ * The top of the tree (down to the fork depth) is processed
+ * sequentially, as in SetNode::sync/inter and SetNode::sync_rec/inter_rec,
+ * except that the nodes are not merged: the subtrees at the fork depth
+ * are collected and merging is postponed to the end (see merge).
+ */
+SetNode* fork(SetNode* node, SetNode** slot, const IntervalVector& box, Sep& sep, double eps, bool sync, int depth, vector<Subtree>& subtrees) {
+
+	if (depth==0) {
+		subtrees.push_back(Subtree(slot,box));
+		return node;
+	}
+
+	SetNode* other = contract_set(box, sep, eps);
+	if (sync)
+		node = node->sync(box, other, box, eps, !node->is_leaf());
+	else
+		node = node->inter(box, other, box, eps);
+	delete other;
+
+	if (node->is_leaf()) {
+		if (node->status<UNK || box.max_diam()<=eps)
+			return node;
+		// see SetLeaf::sync_rec and SetLeaf::inter_rec
+		int var=box.extr_diam_index(false);
+		double pt=box.bisect(var).first[var].ub();
+		NodeType status = sync? UNK : node->status;
+		delete node;
+		node = new SetBisect(var, pt, new SetLeaf(status), new SetLeaf(status));
+	}
+
+	SetBisect& b=*((SetBisect*) node);
+	b.left  = fork(b.left,  &b.left,  b.left_box(box),  sep, eps, sync, depth-1, subtrees);
+	b.right = fork(b.right, &b.right, b.right_box(box), sep, eps, sync, depth-1, subtrees);
+	return node;
 }
 
-SetInterval& SetInterval::operator|=(const SetInterval& set) {
-	root = root->union_(bounding_box, set.root, set.bounding_box, eps);
-	return *this;
+/*
+ * Merge the nodes of the top of the tree (bottom-up),
+ * once all the subtrees have been refined.
+ */
+SetNode* merge(SetNode* node, int depth) {
+	if (depth==0 || node->is_leaf())
+		return node;
+	SetBisect& b=*((SetBisect*) node);
+	b.left  = merge(b.left, depth-1);
+	b.right = merge(b.right, depth-1);
+	return b.try_merge();
 }
 
-void SetInterval::save(const char* filename) {
-	std::stack<SetNode*> s;
+/*
+ * Refine the subtrees with several threads. A worker takes the
+ * next subtree in the list until all of them are processed.
+ */
+class Refine {
+public:
+	Refine(vector<Subtree>& subtrees, double eps, bool sync) : subtrees(subtrees), eps(eps), sync(sync), next(0), no_set(false) { }
 
-	s.push(root);
+	/* Return the next subtree (NULL if none) */
+	Subtree* pop() {
+		Lock l(mutex);
+		if (no_set || next==subtrees.size()) return NULL;
+		return &subtrees[next++];
+	}
 
-	fstream os;
-	os.open(filename, ios::out | ios::trunc | ios::binary);
+	vector<Subtree>& subtrees;
+	const double eps;
+	const bool sync;
+	unsigned int next;
+	bool no_set; // set when a worker has proven that there is no set
+	Mutex mutex;
+};
 
-	os.write((char*) &eps, sizeof(double));
+class RefineWorker : public Thread {
+public:
+	RefineWorker(Refine& r, Sep& sep) : r(r), sep(sep) { }
+
+protected:
+	void run() {
+		Subtree* t;
+		while ((t=r.pop())) {
+			try {
+				if (r.sync)
+					*t->slot = (*t->slot)->sync(t->box, sep, r.eps);
+				else
+					*t->slot = (*t->slot)->inter(t->box, sep, r.eps);
+			} catch(NoSet&) {
+				Lock l(r.mutex);
+				r.no_set=true;
+			}
+		}
+	}
 
-	int n=bounding_box.size();
-	os.write((char*) &n, sizeof(int));
+	Refine& r;
+	Sep& sep;
+};
 
-	for (int i=0; i<bounding_box.size(); i++) {
-		double d; // to store double values
-		d=bounding_box[i].lb();
-		os.write((char*) &d,sizeof(double));
-		d=bounding_box[i].ub();
-		os.write((char*) &d,sizeof(double));
+/*
+ * Return false if there is no set (sync only).
+ */
+bool refine(SetNode*& root, const IntervalVector& box, const Array<Sep>& sep, double eps, bool sync, int fork_depth) {
+	assert(sep.size()>0);
+
+	vector<Subtree> subtrees;
+	root = fork(root, &root, box, sep[0], eps, sync, fork_depth, subtrees);
+
+	Refine r(subtrees, eps, sync);
+	vector<RefineWorker*> workers;
+	for (int i=0; i<sep.size(); i++)
+		workers.push_back(new RefineWorker(r, sep[i]));
+
+	for (int i=0; i<sep.size(); i++)
+		workers[i]->start();
+
+	for (int i=0; i<sep.size(); i++) {
+		workers[i]->join();
+		delete workers[i];
 	}
 
-	while (!s.empty()) {
-		SetNode* node=s.top();
-		s.pop();
-		if (node->is_leaf()) {
-			int no_var=-1; // to store "-1" (means: leaf)
-			os.write((char*) &no_var, sizeof(int));
-			os.write((char*) &node->status, sizeof(NodeType));
-		}
-		else {
-			SetBisect* b=(SetBisect*) node;
-			os.write((char*) &b->var, sizeof(int));
-			os.write((char*) &b->pt, sizeof(double));
-			s.push(b->right);
-			s.push(b->left);
-		}
+	if (r.no_set) return false;
+
+	root = merge(root, fork_depth);
+	return true;
+}
+
+} // end anonymous namespace
+
+void SetInterval::sync(const Array<Sep>& sep, int fork_depth) {
+	build();
+	bool ok;
+	try {
+		ok = refine(root, bounding_box, sep, eps, true, fork_depth);
+	} catch(NoSet&) {
+		ok = false;
+	}
+	if (!ok) {
+		delete root;
+		root = NULL;
+		throw NoSet();
 	}
-	os.close();
+}
+
+void SetInterval::contract(const Array<Sep>& sep, int fork_depth) {
+	build();
+	root->set_in_tmp();
+	refine(root, bounding_box, sep, eps, false, fork_depth);
+	root->unset_in_tmp();
+}
+
+SetInterval& SetInterval::operator&=(const SetInterval& set) {
+	build();
+	SetNode* other = set.flat? set.flat->build() : set.root;
+	root->set_in_tmp();
+	root = root->inter(bounding_box, other, set.bounding_box, eps);
+	root->unset_in_tmp();
+	if (set.flat) delete other;
+	return *this;
+}
+
+SetInterval& SetInterval::operator|=(const SetInterval& set) {
+	build();
+	SetNode* other = set.flat? set.flat->build() : set.root;
+	root = root->union_(bounding_box, other, set.bounding_box, eps);
+	if (set.flat) delete other;
+	return *this;
+}
+
+void SetInterval::save(const char* filename) {
+	if (flat)
+		flat->save(filename);
+	else
+		SetFlat(root, bounding_box, eps).save(filename);
 }
 
 void SetInterval::load(const char* filename) {
@@ -178,11 +334,17 @@ void SetInterval::load(const char* filename) {
 }
 
 void SetInterval::visit_leaves(SetNode::leaf_func func) const {
-	root->visit_leaves(func, bounding_box);
+	if (flat)
+		flat->visit_leaves(func);
+	else
+		root->visit_leaves(func, bounding_box);
 }
 
 std::ostream& operator<<(std::ostream& os, const SetInterval& set) {
-	set.root->print(os,set.bounding_box, 0);
+	if (set.flat)
+		set.flat->print(os);
+	else
+		set.root->print(os,set.bounding_box, 0);
 	return os;
 }
 
@@ -234,6 +396,9 @@ public:
 }
 
 double SetInterval::dist(const Vector& pt, bool inside) const {
+	if (flat)
+		return flat->dist(pt, inside);
+
 	CellHeapDist heap;
 
 	//int count=0; // for stats
@@ -287,6 +452,7 @@ double SetInterval::dist(const Vector& pt, bool inside) const {
 
 SetInterval::~SetInterval() {
 	delete root;
+	delete flat;
 }
 
 } // namespace ibex
@@ -11,7 +11,9 @@
 #define __IBEX_SET_H__
 
 #include "ibex_SetNode.h"
+#include "ibex_SetFlat.h"
 #include "ibex_Sep.h"
+#include "ibex_Array.h"
 
 namespace ibex {
 
@@ -41,6 +43,13 @@ public:
 	/**
 	 * \brief Loads a set from a data file.
 	 *
+	 * The file is mapped into memory and the set is not built:
+	 * #dist() and #visit_leaves() run directly on the file. The
+	 * tree is only built by the first operation that modifies the set.
+	 *
+	 * Files written in the former format (field by field) are still
+	 * accepted but are read and built immediately.
+	 *
 	 * \see #save().
 	 */
 	SetInterval(const char* filename);
@@ -89,8 +98,35 @@ public:
 
 	void contract(Sep& sep);
 
+	/**
+	 * \brief i-Set synchronization (multi-threaded)
+	 *
+	 * Same as #sync(Sep&) but the subtrees at depth \a fork_depth
+	 * (counted in bisections from the root) are refined in parallel,
+	 * by sep.size() threads.
+	 *
+	 * Separators are usually not reentrant (they store intermediate
+	 * results in the expressions of their functions). This is why each
+	 * thread has its own separator: the separators in \a sep must all
+	 * represent the same set but must not share any function.
+	 *
+	 * The resulting i-set is the same as with #sync(Sep&).
+	 */
+	void sync(const Array<Sep>& sep, int fork_depth=6);
+
+	/**
+	 * \brief Contraction (multi-threaded)
+	 *
+	 * Same as #contract(Sep&) but the subtrees at depth \a fork_depth
+	 * are contracted in parallel. See #sync(const Array<Sep>&, int).
+	 */
+	void contract(const Array<Sep>& sep, int fork_depth=6);
+
 	/**
 	 * \brief Serialize the set and save it into a file
+	 *
+	 * The file contains the flat encoding of the tree (see #SetFlat).
+	 * It can be the file the set has been loaded from.
 	 */
 	void save(const char* filename);
 
@@ -105,14 +141,22 @@ public:
 protected:
 
 	/**
-	 * \brief Load the set from a file
+	 * \brief Load the set from a file (former format)
 	 */
 	void load(const char* filename);
 
+	/**
+	 * \brief Build the tree from the flat encoding, if the set was loaded.
+	 */
+	void build();
+
 	friend std::ostream& operator<<(std::ostream& os, const SetInterval& set);
+	friend class SetIndex;
 
 	SetNode* root; // NULL means no existing set (warning: different from empty set!)
 
+	SetFlat* flat; // the mapped file, as long as the tree is not built (root is then NULL)
+
 	double eps;
 
 	IntervalVector bounding_box; // not sure it is really necessary
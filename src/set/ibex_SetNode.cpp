@@ -161,7 +161,9 @@ SetNode* SetNode::sync(const IntervalVector& nodebox, Sep& sep, double eps) {
 	// we skip other UNK-box if this node is not a leaf. This makes no difference
 	// if we are in SYNC mode but if we are in INTER mode, this prevents from
 	// this node to be "absorbed" by a temporary UNK box resulting from contraction.
-	SetNode* this2 = this->sync(nodebox, contract_set(nodebox, sep, eps), nodebox, eps, !is_leaf());
+	SetNode* other = contract_set(nodebox, sep, eps);
+	SetNode* this2 = this->sync(nodebox, other, nodebox, eps, !is_leaf());
+	delete other;
 
 	//cout << " sep gives: "; this2->print(cout,nodebox,0);
 	//cout << endl;
@@ -194,7 +196,9 @@ SetNode* SetNode::inter(const IntervalVector& nodebox, Sep& sep, double eps) {
 	// we skip other UNK-box if this node is not a leaf. This makes no difference
 	// if we are in SYNC mode but if we are in INTER mode, this prevents from
 	// this node to be "absorbed" by a temporary UNK box resulting from contraction.
-	SetNode* this2 = this->inter(nodebox, contract_set(nodebox, sep, eps), nodebox, eps);
+	SetNode* other = contract_set(nodebox, sep, eps);
+	SetNode* this2 = this->inter(nodebox, other, nodebox, eps);
+	delete other;
 	//cout << " sep gives: "; this2->print(cout,nodebox,0);
 
 	SetNode* this4 = this2->inter_rec(nodebox, sep, eps);
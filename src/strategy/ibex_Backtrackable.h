@@ -11,6 +11,8 @@
 #ifndef __IBEX_BACKTRACKABLE_H__
 #define __IBEX_BACKTRACKABLE_H__
 
+#include "ibex_MemoryPool.h"
+
 #include <utility>
 
 namespace ibex {
@@ -49,6 +51,20 @@ public:
 	 * \brief Delete *this.
 	 */
 	virtual ~Backtrackable() { }
+
+	/**
+	 * \brief Allocate data in the memory pools (like cells).
+	 */
+	static void* operator new(size_t size) {
+		return MemoryPool::allocate(size);
+	}
+
+	/**
+	 * \brief Free data allocated in the memory pools.
+	 */
+	static void operator delete(void* p, size_t size) {
+		MemoryPool::deallocate(p,size);
+	}
 };
 
 } // end namespace ibex
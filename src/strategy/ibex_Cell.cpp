@@ -10,26 +10,72 @@
 
 #include "ibex_Cell.h"
 
+#include <new>
+
 namespace ibex {
- Cell::Cell(const IntervalVector& box) : box(box){
 
+namespace {
+
+/* Number of slots given so far */
+int nb_slots=0;
+
+/* Copy of a box in the memory pools */
+Interval* pool_copy(const IntervalVector& box) {
+	int n=box.size();
+	Interval* copy=(Interval*) MemoryPool::allocate(n*sizeof(Interval));
+	for (int i=0; i<n; i++)
+		new (&copy[i]) Interval(box[i]);
+	return copy;
+}
+
+}
+
+Cell::Cell(const IntervalVector& box) : box(box.size(), pool_copy(box), false), data(NULL), nb_data(0),
+		box_storage(&this->box[0]), box_storage_size(box.size()) {
+}
+
+int Cell::new_slot() {
+	return __sync_fetch_and_add(&nb_slots,1);
+}
+
+void Cell::resize_data(int n) {
+	Backtrackable** new_data=(Backtrackable**) MemoryPool::allocate(n*sizeof(Backtrackable*));
+	int i=0;
+	for (; i<nb_data && i<n; i++) new_data[i]=data[i];
+	for (; i<n; i++) new_data[i]=NULL;
+	if (data) MemoryPool::deallocate(data,nb_data*sizeof(Backtrackable*));
+	data=new_data;
+	nb_data=n;
+}
+
+void Cell::bisect_data(Cell& left, Cell& right) {
+	left.resize_data(nb_data);
+	right.resize_data(nb_data);
+	for (int i=0; i<nb_data; i++) {
+		if (data[i]) {
+			std::pair<Backtrackable*,Backtrackable*> child_data=data[i]->down();
+			left.data[i]=child_data.first;
+			right.data[i]=child_data.second;
+		}
+	}
 }
 
 std::pair<Cell*,Cell*> Cell::bisect(const IntervalVector& left, const IntervalVector& right) {
 	Cell* cleft = new Cell(left);
 	Cell* cright = new Cell(right);
-	for (IBEXMAP(Backtrackable*)::iterator it=data.begin(); it!=data.end(); it++) {
-		std::pair<Backtrackable*,Backtrackable*> child_data=it->second->down();
-		cleft->data.insert_new(it->first,child_data.first);
-		cright->data.insert_new(it->first,child_data.second);
-	}
+	bisect_data(*cleft,*cright);
 	return std::pair<Cell*,Cell*>(cleft,cright);
 }
 
 Cell::~Cell() {
-	for (IBEXMAP(Backtrackable*)::iterator it=data.begin(); it!=data.end(); it++)
-		delete it->second;
-}
+	for (int i=0; i<nb_data; i++)
+		if (data[i]) delete data[i];
+	if (data) MemoryPool::deallocate(data,nb_data*sizeof(Backtrackable*));
 
+	// the box does not own its storage (even if it has been resized since)
+	for (int i=0; i<box_storage_size; i++)
+		box_storage[i].~Interval();
+	MemoryPool::deallocate(box_storage,box_storage_size*sizeof(Interval));
+}
 
 } // end namespace ibex
@@ -13,8 +13,8 @@
 
 #include "ibex_IntervalVector.h"
 #include "ibex_Backtrackable.h"
-#include "ibex_SymbolMap.h"
-#include <typeinfo>
+#include "ibex_MemoryPool.h"
+#include <cassert>
 
 namespace ibex {
 
@@ -36,6 +36,14 @@ namespace ibex {
  *
  * The amount of information contained in a cell can be arbitrarily augmented thanks to the
  * "data registration" technique (see #ibex::Contractor::require()).
+ *
+ * Each class of backtrackable data is given a slot number the first time it is
+ * used (see #slot()) and the data of a cell is an array indexed by slots, so that
+ * retrieving data is a direct access.
+ *
+ * Cells, their boxes and their data arrays are allocated in memory pools
+ * (see #ibex::MemoryPool). The box is built on the storage allocated by
+ * the cell (see #ibex::IntervalVector::IntervalVector(int, Interval*, bool)).
  */
 class Cell {
 public:
@@ -64,7 +72,17 @@ public:
 	/**
 	 * \brief Delete *this.
 	 */
-	~Cell();
+	virtual ~Cell();
+
+	/**
+	 * \brief Allocate a cell in the memory pools.
+	 */
+	static void* operator new(size_t size);
+
+	/**
+	 * \brief Free a cell allocated in the memory pools.
+	 */
+	static void operator delete(void* p, size_t size);
 
 	/**
 	 * \brief Return true if this cell is the root cell.
@@ -74,53 +92,113 @@ public:
 	/**
 	 * \brief Retrieve backtrackable data from this cell.
 	 *
-	 * The data is identified by its classname.
-	 * \pre Class \a T is a subclass of #ibex::Backtrackable.
+	 * The data is identified by its class (see #slot()).
+	 * \pre Class \a T is a subclass of #ibex::Backtrackable and the data has been added.
 	 */
 	template<typename T>
 	T& get() {
-		return (T&) *data[typeid(T).name()];
+		int s=slot<T>();
+		assert(s<nb_data && data[s]);
+		return (T&) *data[s];
 	}
 
 	/**
 	 * \brief Retrieve backtrackable data from this cell.
 	 *
-	 * The data is identified by its classname.
-	 * \pre Class \a T is a subclass of #ibex::Backtrackable.
+	 * The data is identified by its class (see #slot()).
+	 * \pre Class \a T is a subclass of #ibex::Backtrackable and the data has been added.
 	 */
 	template<typename T>
 	const T& get() const {
-		return (T&) *data[typeid(T).name()];
+		int s=slot<T>();
+		assert(s<nb_data && data[s]);
+		return (const T&) *data[s];
 	}
 
 	/**
 	 * \brief Add backtrackable data into this cell.
 	 *
-	 * The data is identified by its classname.
+	 * The data is identified by its class (see #slot()).
 	 * \pre Class \a T is a subclass of #ibex::Backtrackable.
 	 */
 	template<typename T>
 	void add() {
-		const char* id=typeid(T).name();
-		if (!data.used(id)) data.insert_new(id,new T());
+		int s=slot<T>();
+		if (s>=nb_data) resize_data(s+1);
+		if (!data[s]) data[s]=new T();
+	}
+
+	/**
+	 * \brief The slot of the backtrackable data of class T.
+	 *
+	 * Slots are numbered 0, 1, ... in the order in which the
+	 * classes are first used, for the whole program.
+	 */
+	template<typename T>
+	static int slot() {
+		static const int s=new_slot();
+		return s;
 	}
 
 	/**
 	 * \brief The box
 	 */
 	IntervalVector box;
+
 	/**
 	 * \brief Other data.
+	 *
+	 * data[i] is the backtrackable data of the ith slot (NULL if this
+	 * cell has no data of the corresponding class).
+	 */
+	Backtrackable** data;
+
+	/**
+	 * \brief Size of the data array.
+	 */
+	int nb_data;
+
+protected:
+	/**
+	 * \brief Create the data of two subcells.
+	 *
+	 * Each subcell inherits from the data of this cell via the
+	 * \link #ibex::Backtrackable::down() down \endlink function.
 	 */
-	SymbolMap<Backtrackable*> data;
+	void bisect_data(Cell& left, Cell& right);
 
 private:
+	Cell(const Cell&); // forbidden
+
+	/* Storage of the box, allocated in the memory pools. The box
+	 * does not use it anymore if it has been resized. */
+	Interval* const box_storage;
+
+	/* Number of intervals in box_storage */
+	const int box_storage_size;
+
+	/* Set the size of the data array (the new slots are empty) */
+	void resize_data(int n);
+
+	/* A new slot number */
+	static int new_slot();
+
 	/* A constant to be used when no variable has been split yet (root cell). */
 	//static const int ROOT_CELL;
 };
 
 std::ostream& operator<<(std::ostream& os, const Cell& c);
 
+/*================================== inline implementations ========================================*/
+
+inline void* Cell::operator new(size_t size) {
+	return MemoryPool::allocate(size);
+}
+
+inline void Cell::operator delete(void* p, size_t size) {
+	MemoryPool::deallocate(p,size);
+}
+
 } // end namespace ibex
 
 #endif // __IBEX_CELL_H__
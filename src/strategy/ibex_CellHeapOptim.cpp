@@ -30,11 +30,11 @@ namespace {
 // the classical best first search comparator, based on minimizing the lower bound of the cost estimate of the cell with the upper bound of the cost for breaking the ties.
 // this comparator is used in the first heap (buffer of Optimizer   crit==LB)
 struct CellComparatorlb {
-	bool operator()(const pair<OptimCell*,Interval*>& c1, const pair<OptimCell*,Interval*>& c2) {
-	  if( c1.second->lb() !=  c2.second->lb())
-	    return c1.second->lb() >= c2.second->lb();
+	bool operator()(const CellHeapOptim::HeapElt& c1, const CellHeapOptim::HeapElt& c2) {
+	  if( c1.lb !=  c2.lb)
+	    return c1.lb >= c2.lb;
 	  else  
-	    return c1.second->ub() >= c2.second->ub();
+	    return c1.ub >= c2.ub;
 	}
 };
 
@@ -42,42 +42,42 @@ struct CellComparatorlb {
   // the other comparators  used in the second heap  (buffer2  of Optimizer)
   // crit==UB
 struct CellComparatorub {
-	bool operator()(const pair<OptimCell*,Interval*>& c1, const pair<OptimCell*,Interval*>& c2) {
-	  if( c1.second->ub() !=  c2.second->ub())
-	    return c1.second->ub() >= c2.second->ub();
+	bool operator()(const CellHeapOptim::HeapElt& c1, const CellHeapOptim::HeapElt& c2) {
+	  if( c1.ub !=  c2.ub)
+	    return c1.ub >= c2.ub;
 	  else 
-	    return c1.second->lb() >= c2.second->lb();
+	    return c1.lb >= c2.lb;
 	}
 };
 
   /* comparator based on the feasibility mesure of a box : crit==PU */
   struct CellComparatorpu {
-	bool operator()(const pair<OptimCell*,Interval*>& c1, const pair<OptimCell*,Interval*>& c2) {
-	  return c1.first->pu <= c2.first->pu;
+	bool operator()(const CellHeapOptim::HeapElt& c1, const CellHeapOptim::HeapElt& c2) {
+	  return c1.cell->pu <= c2.cell->pu;
 	}
 	
 };
 
   /* comparator C3 (cf Markot Casado) */
      struct CellComparatorC3 {
-  	bool operator()(const pair<OptimCell*,Interval*>& c1, const pair<OptimCell*,Interval*>& c2) {
-	  return(((c1.first)->loup - (c1.first)->pf.lb()) / (c1.first)->pf.diam()  <=  ((c2.first)->loup - (c2.first)->pf.lb()) / (c2.first)->pf.diam());
+  	bool operator()(const CellHeapOptim::HeapElt& c1, const CellHeapOptim::HeapElt& c2) {
+	  return(((c1.cell)->loup - (c1.cell)->pf.lb()) / (c1.cell)->pf.diam()  <=  ((c2.cell)->loup - (c2.cell)->pf.lb()) / (c2.cell)->pf.diam());
 	}
 };
 
   /* comparator C5 (cf Markot Casado) */
     struct CellComparatorC5 {
-	bool operator()(const pair<OptimCell*,Interval*>& c1, const pair<OptimCell*,Interval*>& c2) {
-	  return((c1.first)->pu * ((c1.first)->loup - (c1.first)->pf.lb()) / (c1.first)->pf.diam()  <=
-			 (c2.first)->pu *((c2.first)->loup - (c2.first)->pf.lb()) / (c2.first)->pf.diam());
+	bool operator()(const CellHeapOptim::HeapElt& c1, const CellHeapOptim::HeapElt& c2) {
+	  return((c1.cell)->pu * ((c1.cell)->loup - (c1.cell)->pf.lb()) / (c1.cell)->pf.diam()  <=
+			 (c2.cell)->pu *((c2.cell)->loup - (c2.cell)->pf.lb()) / (c2.cell)->pf.diam());
 	}
 };
 
     /* comparator C7 (cf Markot Casado) */
    struct CellComparatorC7 {
-	bool operator()(const pair<OptimCell*,Interval*>& c1, const pair<OptimCell*,Interval*>& c2) {
-	  return(c1.second->lb() /((c1.first)->pu * ((c1.first)->loup - (c1.first)->pf.lb()) / (c1.first)->pf.diam())  >=
-		 c2.second->lb() /((c2.first)->pu *((c2.first)->loup - (c2.first)->pf.lb()) / (c2.first)->pf.diam()));
+	bool operator()(const CellHeapOptim::HeapElt& c1, const CellHeapOptim::HeapElt& c2) {
+	  return(c1.lb /((c1.cell)->pu * ((c1.cell)->loup - (c1.cell)->pf.lb()) / (c1.cell)->pf.diam())  >=
+		 c2.lb /((c2.cell)->pu *((c2.cell)->loup - (c2.cell)->pf.lb()) / (c2.cell)->pf.diam()));
 	}
 };
 
@@ -90,23 +90,23 @@ struct CellComparatorub {
 
 /** The cost is already computed, it is the interval of
  * last variable corresponding to the objective */
-  Interval& CellHeapOptim::cost(const Cell& c) const {
-    return * (new Interval (c.box[y]));
+  const Interval& CellHeapOptim::cost(const Cell& c) const {
+    return c.box[y];
 }
 
 
 
   /** The cost is already computed, it is the interval
    * in the variable pf. */
-    Interval& CellHeapOptim::costpf(const OptimCell& c) const {
-      return * (new Interval (c.pf));
+    const Interval& CellHeapOptim::costpf(const OptimCell& c) const {
+      return c.pf;
   }
 
 
 
   /* removes from the top of the heap the cells that have already been removed from the other heap (heap_present <2) */
   void CellHeapOptim::cleantop()  {
-	while (!empty() && (lopt.front().first)->heap_present < 2)
+	while (!empty() && (lopt.front().cell)->heap_present < 2)
 	  { OptimCell *c = pop();
 	    if (c->heap_present == 0) delete c;
 	  }
@@ -137,12 +137,12 @@ struct CellComparatorub {
   }
 
     void CellHeapOptim::flush() {
-    for (vector<pair<OptimCell*,Interval*> >::iterator it=lopt.begin(); it!=lopt.end(); it++)
-	  { OptimCell* cell=it->first;
+    for (vector<HeapElt>::iterator it=lopt.begin(); it!=lopt.end(); it++)
+	  { OptimCell* cell=it->cell;
 		cell->heap_present--;
 	    if (cell->heap_present==0)
 		  delete cell;
-	    delete it->second;}
+	  }
     lopt.clear();
   }
 
@@ -155,22 +155,21 @@ struct CellComparatorub {
 	//	cout << " before contract heap  "  << lopt.size() <<  endl ;
   sort_heap(lopt.begin(),lopt.end(),CellComparatorlb());
 
-  vector<pair<OptimCell*,Interval*> >::iterator it0=lopt.begin();
+  vector<HeapElt>::iterator it0=lopt.begin();
 
   int k=0;
-  while (it0!=lopt.end() && it0->second->lb() > loup) { it0++; k++; }
+  while (it0!=lopt.end() && it0->lb > loup) { it0++; k++; }
 
   for (int i=0;i<k;i++) {
 	//	cout << " i " << " heap_present " << (lopt[i].first)->heap_present << endl;
-	  (lopt[i].first)->heap_present--;
-	  if ((lopt[i].first)->heap_present==0)delete lopt[i].first;
-	  delete lopt[i].second; 
+	  (lopt[i].cell)->heap_present--;
+	  if ((lopt[i].cell)->heap_present==0)delete lopt[i].cell;
 	}
 
   if (k>0) lopt.erase(lopt.begin(),it0);
 
   if (crit==C3||crit==C5||crit==C7)
-	for (unsigned int i=0;i<lopt.size();i++) (lopt[i].first)->loup=loup;
+	for (unsigned int i=0;i<lopt.size();i++) (lopt[i].cell)->loup=loup;
   
   switch (crit)
 		{case LB: make_heap(lopt.begin(), lopt.end() ,CellComparatorlb());break;
@@ -185,7 +184,7 @@ struct CellComparatorub {
   
   // remove the cell from the buffer and decrements its heap_present counter
   OptimCell* CellHeapOptim::pop() {
-    OptimCell* c = lopt.front().first;
+    OptimCell* c = lopt.front().cell;
     c->heap_present--;
 	switch (crit)
 		{case LB : pop_heap(lopt.begin(), lopt.end(), CellComparatorlb()); break;
@@ -195,14 +194,13 @@ struct CellComparatorub {
 		case C7: 	pop_heap(lopt.begin(), lopt.end(), CellComparatorC7()); break;
 		case PU: 	pop_heap(lopt.begin(), lopt.end(), CellComparatorpu()); break;
 		}
-    delete lopt.back().second;
     lopt.pop_back(); // removes the "best"
     return c;     // and returns it
   }
 
   void CellHeapOptim::push(OptimCell* cell) {
 	if (capacity>0 && size()==capacity) throw CellBufferOverflow();
-	lopt.push_back(pair<OptimCell*,Interval*>(cell,&cost(*cell)));
+	lopt.push_back(HeapElt(cell,cost(*cell)));
 	switch (crit)
 		{case LB : push_heap(lopt.begin(), lopt.end(), CellComparatorlb()); break;
 		case UB : push_heap(lopt.begin(), lopt.end(), CellComparatorub()); break;
@@ -218,7 +216,7 @@ struct CellComparatorub {
   void CellHeapOptim::push_costpf(OptimCell* cell) {
 	if (capacity>0 && size()==capacity) throw CellBufferOverflow();
 
-	lopt.push_back(pair<OptimCell*,Interval*>(cell,&costpf(*cell)));
+	lopt.push_back(HeapElt(cell,costpf(*cell)));
 	switch (crit) {
 		case LB :	push_heap(lopt.begin(), lopt.end(), CellComparatorlb()); break;
 		case UB :	push_heap(lopt.begin(), lopt.end(), CellComparatorub()); break;
@@ -233,11 +231,11 @@ struct CellComparatorub {
 
   // returns the cell on the top of the heap without modifying the heap
   OptimCell* CellHeapOptim::top() const {
-    return lopt.front().first;
+    return lopt.front().cell;
   }
 
     double CellHeapOptim::minimum()  {
-	return lopt.front().second->lb();
+	return lopt.front().lb;
   }
 
 int CellHeapOptim::size() const {
@@ -249,8 +247,8 @@ bool CellHeapOptim::empty() const {
   
 ostream& operator<<(ostream& os, const CellHeapOptim& heap) {
 	os << "[ ";
-	for (vector<pair<OptimCell*,Interval*> >::const_iterator it=heap.lopt.begin(); it!=heap.lopt.end(); it++)
-		os << it->first->box << " ";
+	for (vector<CellHeapOptim::HeapElt>::const_iterator it=heap.lopt.begin(); it!=heap.lopt.end(); it++)
+		os << it->cell->box << " ";
 	return os << "]";
 }
 
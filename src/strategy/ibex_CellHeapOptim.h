@@ -23,8 +23,8 @@ namespace ibex {
  * The heap is organized so that the next box is 
  * the one for which the evaluation of the criterion is the minimum.
  * This criterion of the heap is used in the comparator used by the heap functions (make_heap,pop_heap,push_heap,sort_heap)
- * All the information for the criterion and the objective estimation is in the pair OptimCell,Interval stored in each
- * heap cell.
+ * All the information for the criterion and the objective estimation is in the cell and the bounds of its cost,
+ * stored contiguously in each heap element.
  *
  * \see #CellHeap, #CellBuffer
  */
@@ -106,14 +106,30 @@ public:
    * the first cell) */
   double minimum()  ;
   
+  /**
+   * \brief An element of the heap.
+   *
+   * The bounds of the cost are stored inline with the cell
+   * (no allocation at each push and no indirection in the comparators).
+   */
+  struct HeapElt {
+	  HeapElt(OptimCell* cell, const Interval& cost) : lb(cost.lb()), ub(cost.ub()), cell(cell) { }
+	  /** Lower bound of the cost. */
+	  double lb;
+	  /** Upper bound of the cost. */
+	  double ub;
+	  /** The cell. */
+	  OptimCell* cell;
+  };
+
  protected:
    /** The cost of a cell. */
-  Interval& cost(const Cell& c) const;
+  const Interval& cost(const Cell& c) const;
   /** The another cost of a cell. */
-  Interval& costpf(const OptimCell& c) const;
+  const Interval& costpf(const OptimCell& c) const;
 
   // cells and associated "costs"
-  std::vector<std::pair<OptimCell*,Interval*> > lopt;
+  std::vector<HeapElt> lopt;
   friend std::ostream& operator<<(std::ostream&, const CellHeapOptim&);
 };
 /** Display the buffer */
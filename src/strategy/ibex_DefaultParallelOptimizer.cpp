@@ -0,0 +1,40 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_DefaultParallelOptimizer.cpp
+// Author      : IBEX contributors
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#include "ibex_DefaultParallelOptimizer.h"
+
+using namespace std;
+
+namespace ibex {
+
+DefaultParallelOptimizer::DefaultParallelOptimizer(System& sys, double prec, double goal_prec, int nb_threads) :
+		ParallelOptimizer(nb_threads), sys(sys) {
+
+	opt.set_ref(0, *new DefaultOptimizer(sys,prec,goal_prec));
+
+	for (int i=1; i<nb_threads; i++) {
+		sys_copies.push_back(new System(sys));
+		opt.set_ref(i, *new DefaultOptimizer(*sys_copies.back(),prec,goal_prec));
+	}
+
+	loup_point.resize(sys.nb_var);
+	loup_box.resize(sys.nb_var);
+}
+
+DefaultParallelOptimizer::~DefaultParallelOptimizer() {
+	// the optimizers must be deleted before the systems they are built with
+	for (int i=0; i<nb_threads; i++)
+		delete &opt[i];
+
+	for (vector<System*>::iterator it=sys_copies.begin(); it!=sys_copies.end(); it++)
+		delete *it;
+}
+
+} // end namespace ibex
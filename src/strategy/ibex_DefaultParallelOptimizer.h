@@ -0,0 +1,56 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_DefaultParallelOptimizer.h
+// Author      : IBEX contributors
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#ifndef __IBEX_DEFAULT_PARALLEL_OPTIMIZER_H__
+#define __IBEX_DEFAULT_PARALLEL_OPTIMIZER_H__
+
+#include "ibex_ParallelOptimizer.h"
+#include "ibex_DefaultOptimizer.h"
+#include "ibex_System.h"
+#include "ibex_Thread.h"
+
+#include <vector>
+
+namespace ibex {
+
+/**
+ * \ingroup strategy
+ * \brief Default parallel optimizer.
+ *
+ * Each worker is a #ibex::DefaultOptimizer. The first worker is built with
+ * the system \a sys itself, the other ones with copies of \a sys (so that no
+ * function is shared by two workers).
+ */
+class DefaultParallelOptimizer : public ParallelOptimizer {
+public:
+	/**
+	 * \brief Create a default parallel optimizer.
+	 *
+	 * \param sys        - The system to optimize
+	 * \param prec       - Stopping criterion for box splitting (absolute precision)
+	 * \param goal_prec  - Stopping criterion for the objective (relative precision)
+	 * \param nb_threads - Number of workers (by default: the number of hardware threads)
+	 */
+	DefaultParallelOptimizer(System& sys, double prec, double goal_prec, int nb_threads=Thread::hardware_concurrency());
+
+	/**
+	 * \brief Delete *this.
+	 */
+	~DefaultParallelOptimizer();
+
+	System& sys;
+
+private:
+	/* The copies of the system (workers 1..nb_threads-1) */
+	std::vector<System*> sys_copies;
+};
+
+} // end namespace ibex
+#endif // __IBEX_DEFAULT_PARALLEL_OPTIMIZER_H__
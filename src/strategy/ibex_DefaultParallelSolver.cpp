@@ -0,0 +1,55 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_DefaultParallelSolver.cpp
+// Author      : IBEX contributors
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#include "ibex_DefaultParallelSolver.h"
+
+using namespace std;
+
+namespace ibex {
+
+DefaultParallelSolver::DefaultParallelSolver(System& sys, double prec, int nb_threads) :
+		ParallelSolver(nb_threads), sys(sys) {
+
+	set_worker(0, new DefaultSolver(sys,prec));
+
+	for (int i=1; i<nb_threads; i++) {
+		sys_copies.push_back(new System(sys));
+		set_worker(i, new DefaultSolver(*sys_copies.back(),prec));
+	}
+}
+
+DefaultParallelSolver::DefaultParallelSolver(System& sys, const Vector& prec, int nb_threads) :
+		ParallelSolver(nb_threads), sys(sys) {
+
+	set_worker(0, new DefaultSolver(sys,prec));
+
+	for (int i=1; i<nb_threads; i++) {
+		sys_copies.push_back(new System(sys));
+		set_worker(i, new DefaultSolver(*sys_copies.back(),prec));
+	}
+}
+
+void DefaultParallelSolver::set_worker(int i, DefaultSolver* solver) {
+	solvers.push_back(solver);
+	// note: DefaultSolver::ctc(...) hides the field Solver::ctc
+	ctc.set_ref(i,solver->Solver::ctc);
+	bsc.set_ref(i,solver->bsc);
+}
+
+DefaultParallelSolver::~DefaultParallelSolver() {
+	// the solvers must be deleted before the systems they are built with
+	for (vector<DefaultSolver*>::iterator it=solvers.begin(); it!=solvers.end(); it++)
+		delete *it;
+
+	for (vector<System*>::iterator it=sys_copies.begin(); it!=sys_copies.end(); it++)
+		delete *it;
+}
+
+} // end namespace ibex
@@ -0,0 +1,71 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_DefaultParallelSolver.h
+// Author      : IBEX contributors
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#ifndef __IBEX_DEFAULT_PARALLEL_SOLVER_H__
+#define __IBEX_DEFAULT_PARALLEL_SOLVER_H__
+
+#include "ibex_ParallelSolver.h"
+#include "ibex_DefaultSolver.h"
+#include "ibex_System.h"
+#include "ibex_Thread.h"
+
+#include <vector>
+
+namespace ibex {
+
+/**
+ * \ingroup strategy
+ * \brief Default parallel solver.
+ *
+ * Each worker runs the contractor and the bisector of a #ibex::DefaultSolver.
+ * The first worker is built with the system \a sys itself, the other ones
+ * with copies of \a sys (so that no function is shared by two workers).
+ */
+class DefaultParallelSolver : public ParallelSolver {
+public:
+	/**
+	 * \brief Create a default parallel solver.
+	 *
+	 * \param sys        - The system to solve
+	 * \param prec       - Stopping criterion for box splitting (absolute precision)
+	 * \param nb_threads - Number of workers (by default: the number of hardware threads)
+	 */
+	DefaultParallelSolver(System& sys, double prec, int nb_threads=Thread::hardware_concurrency());
+
+	/**
+	 * \brief Create a default parallel solver.
+	 *
+	 * \param sys        - The system to solve
+	 * \param prec       - Stopping criterion for box splitting (vector of absolute precisions,
+	 *                     one for each variable)
+	 * \param nb_threads - Number of workers (by default: the number of hardware threads)
+	 */
+	DefaultParallelSolver(System& sys, const Vector& prec, int nb_threads=Thread::hardware_concurrency());
+
+	/**
+	 * \brief Delete *this.
+	 */
+	~DefaultParallelSolver();
+
+	System& sys;
+
+private:
+	/* Set the contractor and the bisector of the ith worker */
+	void set_worker(int i, DefaultSolver* solver);
+
+	/* The copies of the system (workers 1..nb_threads-1) */
+	std::vector<System*> sys_copies;
+
+	/* The sequential solvers that hold the contractors/bisectors of the workers */
+	std::vector<DefaultSolver*> solvers;
+};
+
+} // end namespace ibex
+#endif // __IBEX_DEFAULT_PARALLEL_SOLVER_H__
@@ -20,11 +20,7 @@ std::pair<OptimCell*,OptimCell*> OptimCell::bisect(const IntervalVector& left, c
 
 	OptimCell* cleft = new OptimCell(left);
 	OptimCell* cright = new OptimCell(right);
-	for (IBEXMAP(Backtrackable*)::iterator it=data.begin(); it!=data.end(); it++) {
-		std::pair<Backtrackable*,Backtrackable*> child_data=it->second->down();
-		cleft->data.insert_new(it->first,child_data.first);
-		cright->data.insert_new(it->first,child_data.second);
-	}
+	bisect_data(*cleft,*cright);
 	return std::pair<OptimCell*,OptimCell*>(cleft,cright);
 }
 
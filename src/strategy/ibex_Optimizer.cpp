@@ -25,6 +25,7 @@
 
 #include <float.h>
 #include <stdlib.h>
+#include <iomanip>
 
 using namespace std;
 
@@ -204,17 +205,18 @@ bool Optimizer::update_loup(const IntervalVector& box) {
 
 }
 
-void Optimizer::update_entailed_ctr(const IntervalVector& box) {
+bool Optimizer::update_entailed_ctr(const IntervalVector& box) {
 	for (int j=0; j<m; j++) {
 		if (entailed->normalized(j)) {
 			continue;
 		}
 		Interval y=sys.ctrs[j].f.eval(box);
-		if (y.lb()>0) throw EmptyBoxException();
+		if (y.lb()>0) return false;
 		else if (y.ub()<=0) {
 			entailed->set_normalized_entailed(j);
 		}
 	}
+	return true;
 }
 
 double minimum (double a, double b) {
@@ -255,7 +257,10 @@ void Optimizer::update_uplo() {
 
 void Optimizer::handle_cell(OptimCell& c, const IntervalVector& init_box ){
 	try {
-		contract_and_bound(c, init_box);  // may throw EmptyBoxException
+		if (!contract_and_bound(c, init_box)) {
+			delete &c;
+			return;
+		}
 		//       objshaver->contract(c.box);
 
 
@@ -282,6 +287,8 @@ void Optimizer::handle_cell(OptimCell& c, const IntervalVector& init_box ){
 		nb_cells++;
 	}
 	catch(EmptyBoxException&) {
+		// thrown by a redefinition of contract(...)
+		// or by firstorder_contract(...)
 		delete &c;
 	}
 }
@@ -304,7 +311,7 @@ void Optimizer::compute_pu(OptimCell& c) {
 	c.pu=pu;
 }
 
-void Optimizer::contract_and_bound(OptimCell& c, const IntervalVector& init_box) {
+bool Optimizer::contract_and_bound(OptimCell& c, const IntervalVector& init_box) {
 
 	/*======================== contract y with y<=loup ========================*/
 	Interval& y=c.box[ext_sys.goal_var()];
@@ -325,7 +332,7 @@ void Optimizer::contract_and_bound(OptimCell& c, const IntervalVector& init_box)
 	y &= Interval(NEG_INFINITY,ymax);
 	if (y.is_empty()) {
 		c.box.set_empty();
-		throw EmptyBoxException();
+		return false;
 	}
 
 	/*================ contract x with f(x)=y and g(x)<=0 ================*/
@@ -334,6 +341,8 @@ void Optimizer::contract_and_bound(OptimCell& c, const IntervalVector& init_box)
 
 	contract(c.box, init_box);
 
+	if (c.box.is_empty()) return false;
+
 	//cout << " [contract]  x after=" << c.box << endl;
 	//cout << " [contract]  y after=" << y << endl;
 	// TODO: no more cell in argument here (just a box). Does it matter?
@@ -346,7 +355,7 @@ void Optimizer::contract_and_bound(OptimCell& c, const IntervalVector& init_box)
 	read_ext_box(c.box,tmp_box);
 
 	entailed = &c.get<EntailedCtr>();
-	update_entailed_ctr(tmp_box);
+	if (!update_entailed_ctr(tmp_box)) return false;
 
 	bool loup_ch=update_loup(tmp_box);
 
@@ -356,7 +365,7 @@ void Optimizer::contract_and_bound(OptimCell& c, const IntervalVector& init_box)
 	loup_changed |= loup_ch;
 
 	if (y.is_empty()) { // fix issue #44
-		throw EmptyBoxException();
+		return false;
 	}
 
 	/*====================================================================*/
@@ -369,7 +378,7 @@ void Optimizer::contract_and_bound(OptimCell& c, const IntervalVector& init_box)
 		// rem2: do not use a precision contractor here since it would make the box empty (and y==(-inf,-inf)!!)
 		// rem 3 : the extended  boxes with no bisectable  domains  should be catched for avoiding infinite bisections
 		update_uplo_of_epsboxes(y.lb());
-		throw EmptyBoxException();
+		return false;
 	}
 
 	//gradient=0 contraction for unconstrained optimization ; 
@@ -379,7 +388,7 @@ void Optimizer::contract_and_bound(OptimCell& c, const IntervalVector& init_box)
 	// the current extended box in the cell is updated
 	write_ext_box(tmp_box,c.box);
 
-
+	return true;
 }
 
 
@@ -411,10 +420,10 @@ void Optimizer::firstorder_contract(  IntervalVector& box, const  IntervalVector
 }
 
 void Optimizer::contract ( IntervalVector& box, const IntervalVector& init_box) {
-	ctc.contract(box);
+	ctc.try_contract(box);
 }
 
-Optimizer::Status Optimizer::optimize(const IntervalVector& init_box, double obj_init_bound) {
+OptimCell* Optimizer::init_search(const IntervalVector& init_box, double obj_init_bound) {
 	loup=obj_init_bound;
 	pseudo_loup=obj_init_bound;
 
@@ -447,7 +456,16 @@ Optimizer::Status Optimizer::optimize(const IntervalVector& init_box, double obj
 	initial_loup=obj_init_bound;
 	loup_point=init_box.mid();
 	time=0;
-	Timer::start();
+
+	return root;
+}
+
+Optimizer::Status Optimizer::optimize(const IntervalVector& init_box, double obj_init_bound) {
+
+	OptimCell* root=init_search(init_box, obj_init_bound);
+
+	cpu_clock.reset();
+	cpu_clock.start();
 	handle_cell(*root,init_box);
 	int indbuf=0;
 
@@ -539,11 +557,13 @@ Optimizer::Status Optimizer::optimize(const IntervalVector& init_box, double obj
 		}
 	}
 	catch (TimeOutException& ) {
+		cpu_clock.stop();
+		time=cpu_clock.elapsed();
 		return TIME_OUT;
 	}
 
-	Timer::stop();
-	time+= Timer::VIRTUAL_TIMELAPSE();
+	cpu_clock.stop();
+	time=cpu_clock.elapsed();
 
 	if (uplo_of_epsboxes == POS_INFINITY && (loup==POS_INFINITY || (loup==initial_loup && goal_abs_prec==0 && goal_rel_prec==0)))
 		return INFEASIBLE;
@@ -653,10 +673,7 @@ void Optimizer::report_perf() {
 }
 
 void Optimizer::time_limit_check () {
-	Timer::stop();
-	time += Timer::VIRTUAL_TIMELAPSE();
-	if (timeout >0 &&  time >=timeout ) throw TimeOutException();
-	Timer::start();
+	cpu_clock.check(timeout);
 }
 
 } // end namespace ibex
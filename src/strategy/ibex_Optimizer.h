@@ -23,6 +23,7 @@
 #include "ibex_LinearSolver.h"
 #include "ibex_PdcHansenFeasibility.h"
 #include "ibex_OptimCell.h"
+#include "ibex_Clock.h"
 
 namespace ibex {
 
@@ -239,7 +240,7 @@ public:
 	/**
 	 * \brief Time limit.
 	 *
-	 * Maximum CPU time used by the strategy.
+	 * Maximum CPU time used by the strategy (CPU time of the calling thread).
 	 * This parameter allows to bound time consumption.
 	 * The value can be fixed by the user.
 	 */
@@ -300,6 +301,16 @@ public:
 	int nb_cells;
 
 protected:
+	friend class ParallelOptimizer;
+
+	/**
+	 * \brief Reset the search data and create the root cell.
+	 *
+	 * Reset the loup, the uplo, the buffers and the statistics before a
+	 * new optimization and return the root cell (not handled yet).
+	 */
+	OptimCell* init_search(const IntervalVector& init_box, double obj_init_bound);
+
 	/**
 	 * \brief Return an upper bound of f(x).
 	 *
@@ -335,8 +346,10 @@ protected:
 	 * <li> call the first order contractor
 	 * </ul>
 	 *
+	 * \return false if the cell can be discarded (the box is empty or
+	 *         small enough).
 	 */
-	void contract_and_bound(OptimCell& c, const IntervalVector& init_box);
+	bool contract_and_bound(OptimCell& c, const IntervalVector& init_box);
 
 	/**
 	 * \brief Contraction procedure for processing a box.
@@ -345,6 +358,8 @@ protected:
 	 * <li> contract with the contractor ctc,
 	 * </ul>
 	 *
+	 * An empty result is signaled either by an empty box
+	 * or by an #ibex::EmptyBoxException.
 	 */
 	 virtual void contract(IntervalVector& box, const IntervalVector& init_box );
 
@@ -364,8 +379,10 @@ protected:
 
 	/**
 	 * \brief Update the entailed constraint for the current box
+	 *
+	 * \return false if a constraint is proven unsatisfiable in the box.
 	 */
-	void update_entailed_ctr(const IntervalVector& box);
+	bool update_entailed_ctr(const IntervalVector& box);
 
 
 	/**
@@ -440,6 +457,14 @@ protected:
 	 */
 	bool check_candidate(const Vector& pt, bool is_inner);
 
+	/**
+	 * \brief Try to reduce the "loup" with a candidate point.
+	 *
+	 * Same as #check_candidate(const Vector&, bool) except that
+	 * the upper bound \a res of the criterion at \a pt is given.
+	 */
+	bool check_candidate(const Vector& pt, double res, bool is_inner);
+
 	/**
 	 * Look for a loup box (in rigor mode) starting from a pseudo-loup.
 	 *
@@ -576,6 +601,8 @@ private:
 	int nb_inhc4;
 	double diam_inhc4;
 
+	/** CPU time of the current optimization. */
+	Clock cpu_clock;
 
 };
 
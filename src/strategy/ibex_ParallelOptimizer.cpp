@@ -0,0 +1,508 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_ParallelOptimizer.cpp
+// Author      : IBEX contributors
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#include "ibex_ParallelOptimizer.h"
+#include "ibex_NoBisectableVariableException.h"
+#include "ibex_Thread.h"
+#include "ibex_Clock.h"
+
+#include <deque>
+#include <vector>
+#include <cassert>
+#include <stdlib.h>
+#include <iomanip>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+/*
+ * Bit pattern of a double (the atomic builtins only apply to integers).
+ */
+union DoubleBits {
+	double d;
+	long long i;
+};
+
+} // end anonymous namespace
+
+/*
+ * Data shared by all the workers.
+ *
+ * The incumbent: the shared loup is stored as the bit pattern of a
+ * double and updated with a compare-and-swap, so that a worker can read
+ * it at any time without locking. The corresponding point (which cannot be
+ * updated atomically) is protected by a mutex and comes with its own
+ * loup value, so that a consistent (loup,point) pair is always adopted.
+ *
+ * Load balancing: cells given by busy workers to idle workers transit
+ * through a pool. A worker is "active" while its heaps are not empty. The
+ * optimization is over when no worker is active and the pool is empty.
+ * These data are protected by the main mutex.
+ */
+class ParallelOptimizer::Search {
+public:
+	Search(ParallelOptimizer& popt, const IntervalVector& init_box, double obj_init_bound);
+
+	/* Delete the cells remaining in the pool (if the search was interrupted) */
+	~Search();
+
+	/* The shared loup (lock-free read) */
+	double loup();
+
+	/* Publish the loup of the optimizer o. Return false if the shared loup is already better. */
+	bool publish(const Optimizer& o, int id);
+
+	/* Set the loup of o to the shared loup if the latter is better. Return true in this case. */
+	bool adopt(Optimizer& o);
+
+	/* Stop all the workers */
+	void halt();
+
+	ParallelOptimizer& popt;
+	const IntervalVector& init_box;
+	vector<Worker*> workers;
+
+	/* ========= incumbent ========= */
+	volatile long long loup_bits;
+	Mutex loup_mutex;
+	double point_loup;     // the loup corresponding to loup_point/loup_box
+	double pseudo_loup;
+	Vector loup_point;
+	IntervalVector loup_box;
+
+	/* ========= load balancing ========= */
+	Mutex mutex;
+	Condition cond;
+	deque<OptimCell*> pool;
+	volatile int nb_idle;   // read without lock by busy workers (as a hint)
+	int nb_active;
+	bool stop;
+	bool timeout;
+
+	/* Real time of the search. The CPU time of the
+	 * process is meaningless for a multi-threaded search. */
+	Clock real_clock;
+};
+
+/*
+ * A worker: a thread running the branch & bound of its own optimizer.
+ */
+class ParallelOptimizer::Worker : public Thread {
+public:
+	Worker(Search& s, int id);
+
+	/* CPU time of this worker */
+	Clock cpu_clock;
+
+protected:
+	void run();
+
+private:
+	/* Adopt the shared loup if it is better and contract the heaps accordingly */
+	void sync_loup();
+
+	/* Contract the heaps w.r.t. the current loup and return ymax */
+	double contract_heaps();
+
+	/* Wait for a cell given by another worker. Return NULL if the optimization is over. */
+	OptimCell* wait_cell();
+
+	/* Give the cell to an idle worker, if any. Return false if no worker is waiting. */
+	bool give(OptimCell* c);
+
+	/* The branch & bound loop */
+	void explore();
+
+	Search& s;
+	const int id;
+	Optimizer& o;
+	unsigned int seed;
+
+	/* Copy of the real clock of the search (for amortized checks of the time limit) */
+	Clock deadline;
+};
+
+ParallelOptimizer::Search::Search(ParallelOptimizer& popt, const IntervalVector& init_box, double obj_init_bound) :
+		popt(popt), init_box(init_box), point_loup(obj_init_bound), pseudo_loup(obj_init_bound),
+		loup_point(init_box.mid()), loup_box(init_box.size()), nb_idle(0), nb_active(popt.nb_threads),
+		stop(false), timeout(false), real_clock(Clock::REAL) {
+
+	real_clock.start();
+
+	DoubleBits x;
+	x.d=obj_init_bound;
+	loup_bits=x.i;
+
+	for (int i=0; i<popt.nb_threads; i++)
+		workers.push_back(new Worker(*this,i));
+}
+
+ParallelOptimizer::Search::~Search() {
+	for (vector<Worker*>::iterator it=workers.begin(); it!=workers.end(); it++)
+		delete *it;
+
+	for (deque<OptimCell*>::iterator it=pool.begin(); it!=pool.end(); it++)
+		delete *it;
+}
+
+double ParallelOptimizer::Search::loup() {
+	DoubleBits x;
+	x.i=__sync_fetch_and_add(&loup_bits,0); // atomic read
+	return x.d;
+}
+
+bool ParallelOptimizer::Search::publish(const Optimizer& o, int id) {
+	DoubleBits x,cur;
+	x.d=o.loup;
+
+	do {
+		cur.d=loup();
+		if (!(x.d<cur.d)) return false;
+	} while (!__sync_bool_compare_and_swap(&loup_bits,cur.i,x.i));
+
+	Lock l(loup_mutex);
+	// a better loup may have been published in the meantime
+	if (x.d<point_loup) {
+		point_loup=x.d;
+		pseudo_loup=o.pseudo_loup;
+		loup_point=o.loup_point;
+		loup_box=o.loup_box;
+		if (popt.trace) {
+			cout << setprecision(12) << " loup update " << x.d << " (worker " << id << ") loup point " << loup_point << endl;
+		}
+	}
+	return true;
+}
+
+bool ParallelOptimizer::Search::adopt(Optimizer& o) {
+	Lock l(loup_mutex);
+	if (point_loup<o.loup) {
+		o.loup=point_loup;
+		o.loup_box=loup_box;
+		if (pseudo_loup<o.pseudo_loup) {
+			o.pseudo_loup=pseudo_loup;
+			o.loup_point=loup_point;
+		}
+		return true;
+	}
+	return false;
+}
+
+void ParallelOptimizer::Search::halt() {
+	Lock l(mutex);
+	stop=true;
+	cond.broadcast();
+}
+
+ParallelOptimizer::Worker::Worker(Search& s, int id) : cpu_clock(Clock::THREAD_CPU), s(s), id(id),
+		o(s.popt.opt[id]), seed(id+1), deadline(s.real_clock) {
+
+}
+
+void ParallelOptimizer::Worker::sync_loup() {
+	// note: the lock-free read avoids locking at each cell
+	if (s.loup()<o.loup && s.adopt(o))
+		contract_heaps();
+}
+
+double ParallelOptimizer::Worker::contract_heaps() {
+	double ymax=o.compute_ymax();
+	o.buffer.contract_heap(ymax);
+	if (o.critpr > 0) o.buffer2.contract_heap(ymax);
+	return ymax;
+}
+
+OptimCell* ParallelOptimizer::Worker::wait_cell() {
+	Lock l(s.mutex);
+	s.nb_active--;
+	s.nb_idle++;
+
+	while (!s.stop && s.pool.empty() && s.nb_active>0)
+		s.cond.wait(s.mutex);
+
+	s.nb_idle--;
+
+	if (s.stop || s.pool.empty()) {
+		// the optimization is over
+		s.cond.broadcast();
+		return NULL;
+	}
+
+	OptimCell* c=s.pool.front();
+	s.pool.pop_front();
+	s.nb_active++;
+	return c;
+}
+
+bool ParallelOptimizer::Worker::give(OptimCell* c) {
+	if (s.nb_idle==0) return false;
+
+	Lock l(s.mutex);
+	if (s.stop || (int) s.pool.size()>=s.nb_idle) return false;
+	s.pool.push_back(c);
+	s.popt.nb_transfers++;
+	s.cond.broadcast();
+	return true;
+}
+
+void ParallelOptimizer::Worker::run() {
+	cpu_clock.start();
+	explore();
+	cpu_clock.stop();
+}
+
+void ParallelOptimizer::Worker::explore() {
+	const IntervalVector& init_box=s.init_box;
+	ParallelOptimizer& popt=s.popt;
+
+	while (!s.stop) {
+
+		sync_loup();
+
+		// removes from the heap buffer, the cells already chosen in the other buffer
+		if (o.critpr > 0) {
+			o.buffer.cleantop();
+			o.buffer2.cleantop();
+		}
+
+		o.loup_changed=false;
+
+		if (o.buffer.empty()) {
+			OptimCell* c=wait_cell();
+			if (!c) break;
+			// the cell has been bisected by another worker but not contracted
+			o.handle_cell(*c, init_box);
+		} else {
+			OptimCell *c;
+			int indbuf;
+			// random choice between the 2 buffers (see Optimizer::optimize)
+			if ((int) (rand_r(&seed) % 100) >= o.critpr) {
+				indbuf=0;
+				c=o.buffer.top();
+			} else {
+				indbuf=1;
+				c=o.buffer2.top();
+			}
+
+			try {
+				pair<IntervalVector,IntervalVector> boxes=o.bsc.bisect(*c);
+				pair<OptimCell*,OptimCell*> new_cells=c->bisect(boxes.first,boxes.second);
+				if (indbuf==0)
+					o.buffer.pop();
+				else
+					o.buffer2.pop();
+				if (c->heap_present==0) delete c;
+
+				o.handle_cell(*new_cells.first, init_box);
+				if (!give(new_cells.second))
+					o.handle_cell(*new_cells.second, init_box);
+			}
+			catch (NoBisectableVariableException& ) {
+				o.update_uplo_of_epsboxes((c->box)[o.ext_sys.goal_var()].lb());
+				if (indbuf==0)
+					o.buffer.pop();
+				else
+					o.buffer2.pop();
+				if (c->heap_present==0) delete c;
+			}
+		}
+
+		if (o.uplo_of_epsboxes == NEG_INFINITY) {
+			if (popt.trace) cout << " possible infinite minimum " << endl;
+			s.halt();
+			break;
+		}
+
+		if (o.loup_changed) {
+			s.publish(o,id);
+			// the other workers will contract their own heaps
+			// when they adopt the new loup (see sync_loup)
+			if (contract_heaps() <= NEG_INFINITY) {
+				if (popt.trace) cout << " infinite value for the minimum " << endl;
+				s.halt();
+				break;
+			}
+		}
+
+		if (deadline.expired(popt.timeout)) {
+			{
+				Lock l(s.mutex);
+				s.timeout=true;
+			}
+			s.halt();
+		}
+	}
+}
+
+ParallelOptimizer::ParallelOptimizer(const Array<Optimizer>& opt) : nb_threads(opt.size()), opt(opt),
+		timeout(-1), trace(0), loup(POS_INFINITY), pseudo_loup(POS_INFINITY), uplo(NEG_INFINITY),
+		loup_point(opt[0].n), loup_box(opt[0].n), nb_cells(0), nb_transfers(0), time(0),
+		initial_loup(POS_INFINITY), uplo_of_epsboxes(POS_INFINITY), interrupted(false) {
+
+	assert(opt.size()>0);
+}
+
+ParallelOptimizer::ParallelOptimizer(int nb_threads) : nb_threads(nb_threads), opt(nb_threads),
+		timeout(-1), trace(0), loup(POS_INFINITY), pseudo_loup(POS_INFINITY), uplo(NEG_INFINITY),
+		loup_point(1), loup_box(1), nb_cells(0), nb_transfers(0), time(0),
+		initial_loup(POS_INFINITY), uplo_of_epsboxes(POS_INFINITY), interrupted(false) {
+
+	assert(nb_threads>0);
+}
+
+ParallelOptimizer::~ParallelOptimizer() {
+
+}
+
+Optimizer::Status ParallelOptimizer::optimize(const IntervalVector& init_box, double obj_init_bound) {
+
+	Optimizer& o0=opt[0];
+
+	assert(init_box.size()==o0.n);
+
+	// the root cell is created by the first worker
+	OptimCell* root=o0.init_search(init_box, obj_init_bound);
+
+	for (int i=1; i<nb_threads; i++)
+		delete opt[i].init_search(init_box, obj_init_bound);
+
+	initial_loup=obj_init_bound;
+	nb_transfers=0;
+
+	Search search(*this, init_box, obj_init_bound);
+
+	// the root cell is taken by the first idle worker
+	search.pool.push_back(root);
+
+	for (int i=0; i<nb_threads; i++)
+		search.workers[i]->start();
+
+	for (int i=0; i<nb_threads; i++)
+		search.workers[i]->join();
+
+	time = search.real_clock.elapsed();
+
+	thread_time.resize(nb_threads);
+	for (int i=0; i<nb_threads; i++)
+		thread_time[i]=search.workers[i]->cpu_clock.elapsed();
+
+	// ================ merge the results of the workers ================
+	loup=search.loup();
+	pseudo_loup=search.pseudo_loup;
+	loup_point.resize(o0.n);
+	loup_point=search.loup_point;
+	loup_box.resize(o0.n);
+	loup_box=search.loup_box;
+
+	uplo_of_epsboxes=POS_INFINITY;
+	nb_cells=0;
+	bool cells_left=!search.pool.empty();
+
+	for (int i=0; i<nb_threads; i++) {
+		Optimizer& o=opt[i];
+		// in rigor mode, the pseudo-loup is not shared
+		if (o.pseudo_loup<pseudo_loup) {
+			pseudo_loup=o.pseudo_loup;
+			loup_point=o.loup_point;
+		}
+		if (o.uplo_of_epsboxes<uplo_of_epsboxes)
+			uplo_of_epsboxes=o.uplo_of_epsboxes;
+		nb_cells+=o.nb_cells;
+	}
+
+	// ================ compute the uplo ================
+	uplo=uplo_of_epsboxes;
+
+	for (int i=0; i<nb_threads; i++) {
+		Optimizer& o=opt[i];
+		if (o.critpr > 0) {
+			o.buffer.cleantop();
+			o.buffer2.cleantop();
+		}
+		if (!o.buffer.empty()) {
+			cells_left=true;
+			if (o.buffer.minimum()<uplo) uplo=o.buffer.minimum();
+		}
+	}
+
+	for (deque<OptimCell*>::iterator it=search.pool.begin(); it!=search.pool.end(); it++) {
+		double lb=(*it)->box[o0.ext_sys.goal_var()].lb();
+		if (lb<uplo) uplo=lb;
+	}
+
+	if (!cells_left && loup!=POS_INFINITY) {
+		// all the buffers are empty: the uplo is ymax (see Optimizer::update_uplo)
+		o0.loup=loup;
+		double ymax=o0.compute_ymax();
+		if (ymax<uplo) uplo=ymax;
+	}
+
+	// ================ status ================
+	interrupted=search.timeout;
+
+	if (interrupted)
+		return Optimizer::TIME_OUT;
+	else if (uplo_of_epsboxes == POS_INFINITY && (loup==POS_INFINITY || (loup==initial_loup && o0.goal_abs_prec==0 && o0.goal_rel_prec==0)))
+		return Optimizer::INFEASIBLE;
+	else if (loup==initial_loup)
+		return Optimizer::NO_FEASIBLE_FOUND;
+	else if (uplo_of_epsboxes == NEG_INFINITY)
+		return Optimizer::UNBOUNDED_OBJ;
+	else
+		return Optimizer::SUCCESS;
+}
+
+void ParallelOptimizer::report() {
+
+	Optimizer& o0=opt[0];
+
+	if (interrupted) {
+		cout << "time limit " << timeout << "s. reached " << endl;
+	}
+
+	if (!interrupted && uplo_of_epsboxes == POS_INFINITY && (loup==POS_INFINITY || (loup==initial_loup && o0.goal_abs_prec==0 && o0.goal_rel_prec==0))) {
+		cout << " infeasible problem " << endl;
+	} else {
+		cout << " best bound in: [" << uplo << "," << loup << "]" << endl;
+
+		double rel_prec;
+
+		if (loup==POS_INFINITY)
+			rel_prec= POS_INFINITY;
+		else
+			rel_prec=(loup-uplo)/(fabs (loup))-1.e-15;
+
+		double abs_prec=loup-uplo-1.e-15;
+
+		cout << " Relative precision obtained on objective function: " << rel_prec << " " <<
+				(rel_prec <= o0.goal_rel_prec? " [passed]" : " [failed]") << "  " << o0.goal_rel_prec <<  endl;
+
+		cout << " Absolute precision obtained on objective function: " << abs_prec << " " <<
+				(abs_prec <= o0.goal_abs_prec? " [passed]" : " [failed]") << "  " << o0.goal_abs_prec << endl;
+
+		if (loup==initial_loup)
+			cout << " no feasible point found " << endl;
+		else
+			cout << " best feasible point " << loup_point << endl;
+	}
+
+	cout << " real time used " << time << "s." << endl;
+	double cpu_time=0;
+	for (vector<double>::const_iterator it=thread_time.begin(); it!=thread_time.end(); it++)
+		cpu_time+=*it;
+	cout << " cpu time used (all workers) " << cpu_time << "s." << endl;
+	cout << " number of cells " << nb_cells << endl;
+	cout << " number of transfers " << nb_transfers << endl;
+}
+
+} // end namespace ibex
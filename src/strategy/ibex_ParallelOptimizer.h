@@ -0,0 +1,143 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_ParallelOptimizer.h
+// Author      : IBEX contributors
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#ifndef __IBEX_PARALLEL_OPTIMIZER_H__
+#define __IBEX_PARALLEL_OPTIMIZER_H__
+
+#include "ibex_Optimizer.h"
+#include "ibex_Array.h"
+
+#include <vector>
+
+namespace ibex {
+
+/**
+ * \ingroup strategy
+ *
+ * \brief Multi-threaded global optimizer.
+ *
+ * This class runs the branch and bound algorithm of #ibex::Optimizer with
+ * several threads (workers). Each worker is an #ibex::Optimizer (with its own
+ * contractor, bisector, linear solver and cell heaps) and must not share any
+ * function with the other ones (see #ibex::DefaultParallelOptimizer).
+ *
+ * The workers share the loup through a lock-free channel: each time a worker
+ * finds a better feasible point, it publishes its loup (with an atomic
+ * compare-and-swap) and the other workers adopt it before handling their next
+ * cell. The adoption triggers, in each worker, the contraction of its own heaps
+ * with y<=ymax (see #ibex::CellHeapOptim::contract_heap(double)). So the pruning
+ * never blocks the worker that has found the new loup.
+ *
+ * Load balancing: when a worker has an empty heap, it waits for work. The other
+ * workers then give it the second subcell of their next bisection (before contraction)
+ * instead of handling it themselves.
+ *
+ * \note All the workers must use the same kind of bisector (the root cell
+ * is created by the first worker and the cells move from one worker to another).
+ */
+class ParallelOptimizer {
+public:
+	/**
+	 * \brief Build a parallel optimizer.
+	 *
+	 * \param opt - the sequential optimizers, one for each worker. They must be
+	 *              built with copies of the same system.
+	 *
+	 * The number of workers is the size of this array.
+	 */
+	ParallelOptimizer(const Array<Optimizer>& opt);
+
+	/**
+	 * \brief Delete *this.
+	 */
+	virtual ~ParallelOptimizer();
+
+	/**
+	 * \brief Run the optimization.
+	 *
+	 * Same parameters and same return values as #ibex::Optimizer::optimize(const IntervalVector&, double).
+	 */
+	Optimizer::Status optimize(const IntervalVector& init_box, double obj_init_bound=POS_INFINITY);
+
+	/**
+	 * \brief Displays on standard output a report of the last call to #optimize(const IntervalVector&, double).
+	 */
+	void report();
+
+	/** Number of workers. */
+	const int nb_threads;
+
+	/** The sequential optimizers (one per worker). */
+	Array<Optimizer> opt;
+
+	/**
+	 * \brief Time limit.
+	 *
+	 * Maximum (real) time used by the optimizer.
+	 * By default, it is -1 (no limit).
+	 */
+	double timeout;
+
+	/** Trace activation flag.
+	 * 0 (default): nothing is printed.
+	 * 1 : print each loup published by a worker. */
+	int trace;
+
+	/** The loup (best among all the workers). */
+	double loup;
+
+	/** The pseudo-loup (rigor mode). */
+	double pseudo_loup;
+
+	/** The uplo. */
+	double uplo;
+
+	/** The point corresponding to the loup. */
+	Vector loup_point;
+
+	/** Rigor mode: the box corresponding to the loup. */
+	IntervalVector loup_box;
+
+	/** Number of cells put into the heaps (all workers). */
+	int nb_cells;
+
+	/** Number of cells given by a worker to another one. */
+	int nb_transfers;
+
+	/** (Real) running time of the last optimization. */
+	double time;
+
+	/** CPU time of each worker during the last optimization. */
+	std::vector<double> thread_time;
+
+protected:
+	/**
+	 * \brief Build an optimizer with \a nb_threads workers.
+	 *
+	 * The optimizers must be set by the subclass (with set_ref).
+	 */
+	ParallelOptimizer(int nb_threads);
+
+private:
+	class Search;
+	class Worker;
+
+	/** The initial bound given by the user. */
+	double initial_loup;
+
+	/** Lower bound of the small boxes (all workers). */
+	double uplo_of_epsboxes;
+
+	/** True if the last optimization has been interrupted. */
+	bool interrupted;
+};
+
+} // end namespace ibex
+#endif // __IBEX_PARALLEL_OPTIMIZER_H__
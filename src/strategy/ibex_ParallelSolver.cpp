@@ -0,0 +1,356 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_ParallelSolver.cpp
+// Author      : IBEX contributors
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#include "ibex_ParallelSolver.h"
+#include "ibex_EmptyBoxException.h"
+#include "ibex_NoBisectableVariableException.h"
+#include "ibex_Thread.h"
+#include "ibex_Clock.h"
+
+#include <deque>
+#include <algorithm>
+#include <cassert>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+/*
+ * Lexicographic order on boxes (lower bounds first, then upper bounds).
+ * Used to merge the solutions deterministically.
+ */
+bool lex_less(const IntervalVector& x, const IntervalVector& y) {
+	for (int i=0; i<x.size(); i++) {
+		if (x[i].lb()<y[i].lb()) return true;
+		if (x[i].lb()>y[i].lb()) return false;
+	}
+	for (int i=0; i<x.size(); i++) {
+		if (x[i].ub()<y[i].ub()) return true;
+		if (x[i].ub()>y[i].ub()) return false;
+	}
+	return false;
+}
+
+class Worker;
+
+/*
+ * Data shared by all the workers.
+ *
+ * Every cell of the search tree is either in the deque of a worker
+ * ("queued") or being processed by a worker ("busy"). The search is over
+ * when both counts are zero. The counters are protected by the mutex.
+ */
+class Search {
+public:
+	Search(ParallelSolver& solver);
+	~Search();
+
+	ParallelSolver& solver;
+	vector<Worker*> workers;
+
+	Mutex mutex;
+	Condition cond;
+
+	int nb_queued;
+	int nb_busy;
+	int nb_sols;
+	bool stop;
+	bool timeout;
+	bool cell_limit_reached;
+
+	/* Real time of the search. The CPU time of the
+	 * process is meaningless for a multi-threaded search. */
+	Clock real_clock;
+};
+
+/*
+ * A worker: owns a deque of cells and its own contractor/bisector.
+ */
+class Worker : public Thread {
+public:
+	Worker(Search& search, int id);
+
+	/* Delete the remaining cells (if the search was interrupted) */
+	~Worker();
+
+	/* Push a cell at the back of the deque (the owner side) */
+	void push(Cell* c);
+
+	/* Solutions found by this worker */
+	vector<IntervalVector> sols;
+
+	/* CPU time of this worker */
+	Clock cpu_clock;
+
+protected:
+	void run();
+
+private:
+	/* Pop a cell from the back of the deque (NULL if empty) */
+	Cell* pop();
+
+	/* Take the cell at the front of the deque (NULL if empty) */
+	Cell* steal();
+
+	/* Take a cell from another worker (NULL if none) */
+	Cell* steal_from_others();
+
+	/* Contract and bisect the cell. Return the number of cells pushed. */
+	int process(Cell* c);
+
+	void new_sol(const IntervalVector& box);
+
+	/* The exploration loop */
+	void explore();
+
+	Search& s;
+	const int id;
+	Ctc& ctc;
+	Bsc& bsc;
+	deque<Cell*> cells;
+	Mutex mutex;
+	BitSet impact;
+
+	/* Copy of the real clock of the search (for amortized checks of the time limit) */
+	Clock deadline;
+};
+
+Search::Search(ParallelSolver& solver) : solver(solver), nb_queued(0), nb_busy(0), nb_sols(0),
+		stop(false), timeout(false), cell_limit_reached(false), real_clock(Clock::REAL) {
+	real_clock.start();
+	for (int i=0; i<solver.nb_threads; i++)
+		workers.push_back(new Worker(*this,i));
+}
+
+Search::~Search() {
+	for (vector<Worker*>::iterator it=workers.begin(); it!=workers.end(); it++)
+		delete *it;
+}
+
+Worker::Worker(Search& s, int id) : cpu_clock(Clock::THREAD_CPU), s(s), id(id), ctc(s.solver.ctc[id]), bsc(s.solver.bsc[id]),
+		impact(BitSet::all(s.solver.ctc[id].nb_var)), deadline(s.real_clock) {
+
+}
+
+Worker::~Worker() {
+	for (deque<Cell*>::iterator it=cells.begin(); it!=cells.end(); it++)
+		delete *it;
+}
+
+void Worker::push(Cell* c) {
+	Lock l(mutex);
+	cells.push_back(c);
+}
+
+Cell* Worker::pop() {
+	Lock l(mutex);
+	if (cells.empty()) return NULL;
+	Cell* c=cells.back();
+	cells.pop_back();
+	return c;
+}
+
+Cell* Worker::steal() {
+	Lock l(mutex);
+	if (cells.empty()) return NULL;
+	Cell* c=cells.front();
+	cells.pop_front();
+	return c;
+}
+
+Cell* Worker::steal_from_others() {
+	int n=s.solver.nb_threads;
+	for (int i=1; i<n; i++) {
+		Cell* c=s.workers[(id+i)%n]->steal();
+		if (c) return c;
+	}
+	return NULL;
+}
+
+int Worker::process(Cell* c) {
+
+	int v=c->get<BisectedVar>().var;      // last bisected var.
+
+	if (v!=-1)                          // no root node :  impact set to 1 for last bisected var only
+		impact.add(v);
+	else                                // root node : impact set to 1 for all variables
+		impact.fill(0,ctc.nb_var-1);
+
+	bool feasible=ctc.try_contract(c->box,impact);
+
+	if (v!=-1)
+		impact.remove(v);
+	else                                // root node : impact set to 0 for all variables after contraction
+		impact.clear();
+
+	if (!feasible) {
+		assert(c->box.is_empty());
+		delete c;
+		return 0;
+	}
+
+	try {
+		pair<IntervalVector,IntervalVector> boxes=bsc.bisect(*c);
+		pair<Cell*,Cell*> new_cells=c->bisect(boxes.first,boxes.second);
+		delete c;
+		// same order as the CellStack of the sequential solver
+		push(new_cells.first);
+		push(new_cells.second);
+		return 2;
+	}
+	catch (NoBisectableVariableException&) {
+		new_sol(c->box);
+		delete c;
+		return 0;
+	}
+}
+
+void Worker::new_sol(const IntervalVector& box) {
+	sols.push_back(box);
+	if (s.solver.trace>=1) {
+		Lock l(s.mutex);
+		s.nb_sols++;
+		cout.precision(12);
+		cout << " sol " << s.nb_sols << " (worker " << id << ") " << box << endl;
+	}
+}
+
+void Worker::run() {
+	cpu_clock.start();
+	explore();
+	cpu_clock.stop();
+}
+
+void Worker::explore() {
+	ParallelSolver& solver=s.solver;
+
+	for (;;) {
+		bool stolen=false;
+		Cell* c=pop();
+		if (!c) {
+			c=steal_from_others();
+			stolen=(c!=NULL);
+		}
+
+		if (c) {
+			{
+				Lock l(s.mutex);
+				if (s.stop) {
+					delete c;
+					return;
+				}
+				s.nb_queued--;
+				s.nb_busy++;
+				if (stolen) solver.nb_steals++;
+			}
+
+			int nb_new=process(c);
+
+			bool timeout=deadline.expired(solver.time_limit);
+
+			Lock l(s.mutex);
+			s.nb_queued += nb_new;
+			s.nb_busy--;
+			solver.nb_cells += nb_new;
+
+			if (solver.cell_limit>=0 && solver.nb_cells>=solver.cell_limit) {
+				s.cell_limit_reached=true;
+				s.stop=true;
+			}
+			if (timeout) {
+				s.timeout=true;
+				s.stop=true;
+			}
+			if (nb_new>0 || s.nb_busy==0 || s.stop)
+				s.cond.broadcast();
+		} else {
+			Lock l(s.mutex);
+			// wait until some cell is available or the search is over
+			while (!s.stop && s.nb_queued<=0 && s.nb_busy>0)
+				s.cond.wait(s.mutex);
+
+			if (s.stop || (s.nb_queued<=0 && s.nb_busy==0)) {
+				s.cond.broadcast();
+				return;
+			}
+			// otherwise: try again to find a cell
+		}
+	}
+}
+
+} // end anonymous namespace
+
+ParallelSolver::ParallelSolver(const Array<Ctc>& ctc, const Array<Bsc>& bsc) : nb_threads(ctc.size()),
+		ctc(ctc), bsc(bsc), time_limit(-1), cell_limit(-1), trace(0), nb_cells(0), nb_steals(0), time(0) {
+
+	assert(ctc.size()>0);
+	assert(bsc.size()==ctc.size());
+}
+
+ParallelSolver::ParallelSolver(int nb_threads) : nb_threads(nb_threads), ctc(nb_threads), bsc(nb_threads),
+		time_limit(-1), cell_limit(-1), trace(0), nb_cells(0), nb_steals(0), time(0) {
+
+	assert(nb_threads>0);
+}
+
+ParallelSolver::~ParallelSolver() {
+
+}
+
+vector<IntervalVector> ParallelSolver::solve(const IntervalVector& init_box) {
+
+	assert(init_box.size()==ctc[0].nb_var);
+
+	nb_cells=0;
+	nb_steals=0;
+
+	Search search(*this);
+
+	Cell* root=new Cell(init_box);
+
+	// add data required by this solver
+	root->add<BisectedVar>();
+
+	// add data required by the bisector
+	bsc[0].add_backtrackable(*root);
+
+	search.workers[0]->push(root);
+	search.nb_queued=1;
+
+	for (int i=0; i<nb_threads; i++)
+		search.workers[i]->start();
+
+	for (int i=0; i<nb_threads; i++)
+		search.workers[i]->join();
+
+	// merge the solutions
+	vector<IntervalVector> sols;
+	for (int i=0; i<nb_threads; i++)
+		sols.insert(sols.end(), search.workers[i]->sols.begin(), search.workers[i]->sols.end());
+
+	sort(sols.begin(), sols.end(), lex_less);
+
+	time = search.real_clock.elapsed();
+
+	thread_time.resize(nb_threads);
+	for (int i=0; i<nb_threads; i++)
+		thread_time[i]=search.workers[i]->cpu_clock.elapsed();
+
+	if (search.timeout)
+		cout << "time limit " << time_limit << "s. reached " << endl;
+	else if (search.cell_limit_reached)
+		cout << "cell limit " << cell_limit << " reached " << endl;
+
+	return sols;
+}
+
+} // end namespace ibex
@@ -0,0 +1,119 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_ParallelSolver.h
+// Author      : IBEX contributors
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#ifndef __IBEX_PARALLEL_SOLVER_H__
+#define __IBEX_PARALLEL_SOLVER_H__
+
+#include "ibex_Ctc.h"
+#include "ibex_Bsc.h"
+#include "ibex_Array.h"
+#include "ibex_Solver.h"
+
+#include <vector>
+
+namespace ibex {
+
+/**
+ * \ingroup strategy
+ *
+ * \brief  Multi-threaded solver.
+ *
+ * This class implements the same branch and prune algorithm as #ibex::Solver
+ * but the search tree is explored by several threads (workers).
+ *
+ * Each worker owns a local deque of cells and processes its cells in a
+ * depth-first manner. When its deque gets empty, a worker steals the oldest
+ * (hence, largest) cell of another worker.
+ *
+ * Contractors and bisectors are usually not reentrant (they store intermediate
+ * results in the expressions of the functions they are built with). This is
+ * why each worker has its own contractor and its own bisector, which must not
+ * share any function with the ones of other workers (see #ibex::DefaultParallelSolver
+ * for an example).
+ *
+ * The solutions found by all the workers are merged at the end and sorted
+ * (lexicographically) so that the result of a complete search does not depend
+ * on the thread scheduling.
+ */
+class ParallelSolver {
+public:
+	/**
+	 * \brief Build a parallel solver.
+	 *
+	 * \param ctc  -  the contractors, one for each worker.
+	 * \param bsc  -  the bisectors, one for each worker (same size as \a ctc).
+	 *
+	 * The number of workers is the size of these arrays.
+	 */
+	ParallelSolver(const Array<Ctc>& ctc, const Array<Bsc>& bsc);
+
+	/**
+	 * \brief Delete *this.
+	 */
+	virtual ~ParallelSolver();
+
+	/**
+	 * \brief Solve the system.
+	 *
+	 * \param init_box - the initial box (the search space)
+	 *
+	 * Return : the vector of solutions (small boxes with the required precision) found by the solver,
+	 * sorted in lexicographic order.
+	 */
+	std::vector<IntervalVector> solve(const IntervalVector& init_box);
+
+	/** Number of workers. */
+	const int nb_threads;
+
+	/** The contractors (one per worker). */
+	Array<Ctc> ctc;
+
+	/** The bisectors (one per worker). */
+	Array<Bsc> bsc;
+
+	/** Maximum (real) time used by the solver.
+	 * By default, it is -1 (no limit). */
+	double time_limit;
+
+	/** Maximal number of cells created by the solver.
+	 * By default, it is -1 (no limit). */
+	long cell_limit;
+
+	/**
+	 * \brief Trace level
+	 *
+	 *  0  : no trace  (default value)
+	 *  1  : the solutions are printed each time a new solution is found
+	 */
+	int trace;
+
+	/** Number of nodes in the search tree (all workers). */
+	int nb_cells;
+
+	/** Number of cells stolen by workers during the last search. */
+	int nb_steals;
+
+	/** (Real) running time of the last exploration. */
+	double time;
+
+	/** CPU time of each worker during the last exploration. */
+	std::vector<double> thread_time;
+
+protected:
+	/**
+	 * \brief Build a solver with \a nb_threads workers
+	 *
+	 * The contractors and bisectors must be set by the subclass (with set_ref).
+	 */
+	ParallelSolver(int nb_threads);
+};
+
+} // end namespace ibex
+#endif // __IBEX_PARALLEL_SOLVER_H__
@@ -10,14 +10,14 @@
 
 #include "ibex_Paver.h"
 #include "ibex_EmptyBoxException.h"
-#include "ibex_Timer.h"
+#include "ibex_Clock.h"
 
 using namespace std;
 
 namespace ibex {
 
 Paver::Paver(const Array<Ctc>& c, Bsc& b, CellBuffer& buffer) :
-		capacity(-1), ctc_loop(true), ctc(c), bsc(b), buffer(buffer) {
+		capacity(-1), timeout(-1), ctc_loop(true), ctc(c), bsc(b), buffer(buffer) {
 
 	assert(ctc.size()>0);
 }
@@ -101,6 +101,9 @@ SubPaving* Paver::pave(const IntervalVector& init_box) {
 
 	buffer.push(root);
 
+	Clock cpu_clock(Clock::THREAD_CPU);
+	cpu_clock.start();
+
 	while (!buffer.empty()) {
 		Cell* c=buffer.top();
 
@@ -108,7 +111,7 @@ SubPaving* Paver::pave(const IntervalVector& init_box) {
 
 		contract(*c, paving);
 
-		Timer::check(timeout);
+		cpu_clock.check(timeout);
 		check_capacity(paving);
 
 		if (c->box.is_empty()) delete buffer.pop();
@@ -68,9 +68,10 @@ public:
 	/**
 	 * \brief Time limit.
 	 *
-	 * Maximum cpu time used by the strategy.
+	 * Maximum cpu time used by the strategy (CPU time of the calling thread).
 	 * This parameter allows to bound time complexity.
-	 * The value can be fixed by the user.
+	 * The value can be fixed by the user. By default, it is -1 (no limit).
+	 * A #ibex::TimeOutException is raised by pave() when the limit is reached.
 	 */
 	double timeout;
 
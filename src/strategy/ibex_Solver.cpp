@@ -18,7 +18,7 @@ using namespace std;
 namespace ibex {
 
 Solver::Solver(Ctc& ctc, Bsc& bsc, CellBuffer& buffer) :
-		  ctc(ctc), bsc(bsc), buffer(buffer), time_limit(-1), cell_limit(-1), trace(0), time(0), impact(BitSet::all(ctc.nb_var)) {
+		  ctc(ctc), bsc(bsc), buffer(buffer), time_limit(-1), cell_limit(-1), trace(0), time(0), impact(BitSet::all(ctc.nb_var)), cpu_clock(Clock::THREAD_CPU) {
 
 	nb_cells=0;
 
@@ -43,8 +43,9 @@ void Solver::start(const IntervalVector& init_box) {
 
 	IntervalVector tmpbox(ctc.nb_var);
 
-	Timer::start();
-
+	time=0;
+	cpu_clock.reset();
+	cpu_clock.start();
 }
 
 bool Solver::next(std::vector<IntervalVector>& sols) {
@@ -56,64 +57,61 @@ bool Solver::next(std::vector<IntervalVector>& sols) {
 			Cell* c=buffer.top();
 
 			int v=c->get<BisectedVar>().var;      // last bisected var.
-			try {
 
-				if (v!=-1)                          // no root node :  impact set to 1 for last bisected var only
-                               	  impact.add(v);
-				else                                // root node : impact set to 1 for all variables
-				  impact.fill(0,ctc.nb_var-1);
-
-				ctc.contract(c->box,impact);
-
-				if (v!=-1)
-				  impact.remove(v);
-				else                              // root node : impact set to 0 for all variables after contraction
-	    			  impact.clear();
-			
-				try {
-
-					pair<IntervalVector,IntervalVector> boxes=bsc.bisect(*c);
-					pair<Cell*,Cell*> new_cells=c->bisect(boxes.first,boxes.second);
-
-					delete buffer.pop();
-					buffer.push(new_cells.first);
-					buffer.push(new_cells.second);
-					nb_cells+=2;
-					if (cell_limit >=0 && nb_cells>=cell_limit) throw CellLimitException();}
-
-				catch (NoBisectableVariableException&) {
-					new_sol(sols, c->box);
-					delete buffer.pop();
-					return !buffer.empty();
-					// note that we skip time_limit_check() here.
-					// In the case where "next" is called by "solve",
-					// and if time has exceeded, the exception will be raised by the
-					// very next call to "next" anyway. This holds, unless "next" finds
-					// new solutions again and again endlessly. So there is a little risk
-					// of uncaught timeout in this case (but this case is probably already
-					// an error case).
-				}
-				time_limit_check();
-
-			} catch(EmptyBoxException&) {
+			if (v!=-1)                          // no root node :  impact set to 1 for last bisected var only
+				impact.add(v);
+			else                                // root node : impact set to 1 for all variables
+				impact.fill(0,ctc.nb_var-1);
+
+			bool feasible=ctc.try_contract(c->box,impact);
+
+			if (v!=-1)
+				impact.remove(v);
+			else                                // root node : impact set to 0 for all variables after contraction
+				impact.clear();
+
+			if (!feasible) {
 				assert(c->box.is_empty());
 				delete buffer.pop();
-				impact.remove(v); // note: in case of the root node, we should clear the bitset
-				                  // instead but since the search is over, the impact is not used anymore.
+				continue;
+			}
 
+			try {
+
+				pair<IntervalVector,IntervalVector> boxes=bsc.bisect(*c);
+				pair<Cell*,Cell*> new_cells=c->bisect(boxes.first,boxes.second);
 
+				delete buffer.pop();
+				buffer.push(new_cells.first);
+				buffer.push(new_cells.second);
+				nb_cells+=2;
+				if (cell_limit >=0 && nb_cells>=cell_limit) throw CellLimitException();}
+
+			catch (NoBisectableVariableException&) {
+				new_sol(sols, c->box);
+				delete buffer.pop();
+				time=cpu_clock.elapsed();
+				return !buffer.empty();
+				// note that we skip time_limit_check() here.
+				// In the case where "next" is called by "solve",
+				// and if time has exceeded, the exception will be raised by the
+				// very next call to "next" anyway. This holds, unless "next" finds
+				// new solutions again and again endlessly. So there is a little risk
+				// of uncaught timeout in this case (but this case is probably already
+				// an error case).
 			}
+			time_limit_check();
 		}
 	}
 	catch (TimeOutException&) {
-		cout << "time limit " << time_limit << "s. reached " << endl; return false;
+		cout << "time limit " << time_limit << "s. reached " << endl;
 	}
 	catch (CellLimitException&) {
 		cout << "cell limit " << cell_limit << " reached " << endl;
 	}
 
-	Timer::stop();
-	time+= Timer::VIRTUAL_TIMELAPSE();
+	cpu_clock.stop();
+	time=cpu_clock.elapsed();
 
 	return false;
 
@@ -127,10 +125,7 @@ vector<IntervalVector> Solver::solve(const IntervalVector& init_box) {
 }
 
 void Solver::time_limit_check () {
-	Timer::stop();
-	time += Timer::VIRTUAL_TIMELAPSE();
-	if (time_limit >0 &&  time >=time_limit) throw TimeOutException();
-	Timer::start();
+	cpu_clock.check(time_limit);
 }
 
 
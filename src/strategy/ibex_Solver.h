@@ -16,7 +16,7 @@
 #include "ibex_Bsc.h"
 #include "ibex_CellBuffer.h"
 #include "ibex_SubPaving.h"
-#include "ibex_Timer.h"
+#include "ibex_Clock.h"
 #include "ibex_Exception.h"
 
 #include <vector>
@@ -85,7 +85,7 @@ public:
 	/** Cell buffer. */
 	CellBuffer& buffer;
 
-	/** Maximum cpu time used by the solver.
+	/** Maximum cpu time used by the solver (CPU time of the calling thread).
 	 * This parameter allows to bound time complexity.
 	 * The value can be fixed by the user. By default, it is -1 (no limit). */
 
@@ -122,6 +122,9 @@ protected :
 
 	BitSet impact;
 
+	/** CPU time of the current exploration. */
+	Clock cpu_clock;
+
 };
 
 } // end namespace ibex
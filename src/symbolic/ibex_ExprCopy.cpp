@@ -19,10 +19,103 @@
 
 namespace ibex {
 
+namespace {
+
+/*
+ * Remove the last father of a node.
+ */
+void remove_last_father(const ExprNode& e, const ExprNode& father) {
+	Array<const ExprNode>& fathers=((ExprNode&) e).fathers;
+	int n=fathers.size()-1;
+	assert(n>=0 && &fathers[n]==&father);
+	std::vector<const ExprNode*> tmp(n);
+	for (int i=0; i<n; i++) tmp[i]=&fathers[i];
+	fathers.clear(); // so that resize does not delete the last father
+	fathers.resize(n);
+	for (int i=0; i<n; i++) fathers.set_ref(i,*tmp[i]);
+}
+
+inline bool is_scalar_cst(const ExprNode* e, const Interval& x) {
+	const ExprConstant* c=dynamic_cast<const ExprConstant*>(e);
+	return c && c->dim.is_scalar() && c->get_value()==x;
+}
+
+}
+
 void ExprCopy::mark(const ExprNode& e) {
 	if (!used.found(e)) used.insert(e,true);
 }
 
+bool ExprCopy::NodeKey::operator<(const NodeKey& k) const {
+	if (*op!=*k.op) return op->before(*k.op);
+	if (i!=k.i) return i<k.i;
+	if (f!=k.f) return std::less<const void*>()(f,k.f);
+	if (lb!=k.lb) return lb<k.lb;
+	if (ub!=k.ub) return ub<k.ub;
+	if (args.size()!=k.args.size()) return args.size()<k.args.size();
+	for (unsigned int j=0; j<args.size(); j++)
+		if (args[j]->id!=k.args[j]->id) return args[j]->id<k.args[j]->id;
+	return false;
+}
+
+bool ExprCopy::key(const ExprNode& e, NodeKey& k) {
+	k.op=&typeid(e);
+	k.args.clear();
+	k.i=0;
+	k.f=NULL;
+	k.lb=k.ub=0;
+
+	if (const ExprConstant* c=dynamic_cast<const ExprConstant*>(&e)) {
+		if (!c->dim.is_scalar() || c->get_value().is_empty()) return false;
+		k.lb=c->get_value().lb();
+		k.ub=c->get_value().ub();
+	} else if (const ExprIndex* i=dynamic_cast<const ExprIndex*>(&e)) {
+		k.args.push_back(&i->expr);
+		k.i=i->index;
+	} else if (const ExprUnaryOp* u=dynamic_cast<const ExprUnaryOp*>(&e)) {
+		k.args.push_back(&u->expr);
+		if (const ExprPower* p=dynamic_cast<const ExprPower*>(&e))
+			k.i=p->expon;
+	} else if (const ExprBinaryOp* b=dynamic_cast<const ExprBinaryOp*>(&e)) {
+		k.args.push_back(&b->left);
+		k.args.push_back(&b->right);
+	} else if (const ExprNAryOp* a=dynamic_cast<const ExprNAryOp*>(&e)) {
+		for (int j=0; j<a->nb_args; j++)
+			k.args.push_back(&a->arg(j));
+		if (const ExprVector* v=dynamic_cast<const ExprVector*>(&e))
+			k.i=v->row_vector();
+		else if (const ExprApply* f=dynamic_cast<const ExprApply*>(&e))
+			k.f=&f->func;
+	} else
+		return false; // symbols (and unknown nodes)
+
+	return true;
+}
+
+void ExprCopy::insert(const ExprNode& e, const ExprNode& copy) {
+	NodeKey k;
+	if (!fold || !key(copy,k)) {
+		clone.insert(e, &copy);
+		return;
+	}
+
+	std::map<NodeKey,const ExprNode*>::const_iterator it=nodes.find(k);
+
+	if (it==nodes.end()) {
+		nodes.insert(std::make_pair(k,&copy));
+		clone.insert(e, &copy);
+	} else {
+		if (it->second!=&copy) {
+			// the node is a duplicate: it is unlinked from its subnodes
+			// (it is the last father of each of them) and deleted
+			for (int j=k.args.size()-1; j>=0; j--)
+				remove_last_father(*k.args[j], copy);
+			delete &copy;
+		}
+		clone.insert(e, it->second);
+	}
+}
+
 void varcopy(const Array<const ExprSymbol>& src, Array<const ExprSymbol>& dest) {
 	assert(src.size()<=dest.size());
 	for (int i=0; i<src.size(); i++) {
@@ -95,6 +188,7 @@ const ExprNode& ExprCopy::copy(const Array<const ExprSymbol>& old_x, const Array
 
 	clone.clean();
 	used.clean();
+	nodes.clear();
 
 	assert(new_x.size()>=old_x.size());
 
@@ -106,14 +200,29 @@ const ExprNode& ExprCopy::copy(const Array<const ExprSymbol>& old_x, const Array
 	mark(y);
 	visit(y);
 
-	//if (fold) {
+	// A node of the copy may be the copy of several nodes (e.g., x*1 and x,
+	// or common subexpressions in "fold" mode): it is deleted only
+	// if none of them is used.
+	NodeMap<bool> kept;
+	for (IBEX_NODE_MAP(const ExprNode*)::iterator it=clone.begin(); it!=clone.end(); it++) {
+		if (used.found(*it->first) && !kept.found(*it->second))
+			kept.insert(*it->second,true);
+	}
+
+	// note: the nodes are deleted once the map "kept" is no longer
+	// used (the hash of a node is calculated from its fields)
+	std::vector<const ExprNode*> garbage;
 	for (IBEX_NODE_MAP(const ExprNode*)::iterator it=clone.begin(); it!=clone.end(); it++) {
-		if (!used.found(*it->first)) {
-			//std::cout << "delete " << *it->second << std::endl;
-			delete it->second;
+		if (!kept.found(*it->second)) {
+			kept.insert(*it->second,true); // not to delete it twice
+			garbage.push_back(it->second);
 		}
 	}
-	//}
+
+	for (std::vector<const ExprNode*>::iterator it=garbage.begin(); it!=garbage.end(); it++)
+		delete *it;
+
+	nodes.clear();
 
 	return *clone[y];
 }
@@ -131,13 +240,13 @@ void ExprCopy::visit(const ExprIndex& i) {
 	if (fold) {
 		const ExprConstant* c=dynamic_cast<const ExprConstant*>(node);
 		if (c) {
-			clone.insert(i,&ExprConstant::new_(c->get()[i.index]));
+			insert(i,ExprConstant::new_(c->get()[i.index]));
 			//delete c; // dont'! see comment in header file
 			return;
 		}
 	}
 	mark(i.expr);
-	clone.insert(i, &(*node)[i.index]);
+	insert(i, (*node)[i.index]);
 }
 
 void ExprCopy::visit(const ExprSymbol& x) {
@@ -145,7 +254,7 @@ void ExprCopy::visit(const ExprSymbol& x) {
 }
 
 void ExprCopy::visit(const ExprConstant& c) {
-	clone.insert(c, &c.copy());
+	insert(c, c.copy());
 }
 
 // (useless so far)
@@ -187,20 +296,20 @@ void ExprCopy::visit(const ExprVector& e) {
 				for (i=0; i<e.nb_args; i++) {
 					v[i]=((const ExprConstant&) ARG(i)).get_value();
 				}
-				clone.insert(e, &ExprConstant::new_vector(v,e.row_vector()));
+				insert(e, ExprConstant::new_vector(v,e.row_vector()));
 			} else if (e.dim.type()==Dim::MATRIX) {
 				IntervalMatrix m(e.dim.dim2,e.dim.dim3);
 				for (i=0; i<e.nb_args; i++) {
 					m.set_row(i,((const ExprConstant&) ARG(i)).get_vector_value());
 				}
-				clone.insert(e, &ExprConstant::new_matrix(m));
+				insert(e, ExprConstant::new_matrix(m));
 			} else {
 				assert(e.dim.type()==Dim::MATRIX_ARRAY);
 				IntervalMatrixArray ma(e.dim.dim1,e.dim.dim2,e.dim.dim3);
 				for (i=0; i<e.nb_args; i++) {
 					ma[i]=((const ExprConstant&) ARG(i)).get_matrix_value();
 				}
-				clone.insert(e, &ExprConstant::new_matrix_array(ma));
+				insert(e, ExprConstant::new_matrix_array(ma));
 			}
 			return;
 		}
@@ -214,7 +323,7 @@ void ExprCopy::visit(const ExprVector& e) {
 		mark(e.arg(i));
 	}
 
-	clone.insert(e, &ExprVector::new_(args2,e.row_vector()));
+	insert(e, ExprVector::new_(args2,e.row_vector()));
 }
 
 void ExprCopy::visit(const ExprApply& e) {
@@ -231,7 +340,7 @@ void ExprCopy::visit(const ExprApply& e) {
 			for (i=0; i<e.nb_args; i++) {
 				d.set_ref(i,((const ExprConstant&) ARG(i)).get());
 			}
-			clone.insert(e, &ExprConstant::new_(Eval().eval(e.func,d)));
+			insert(e, ExprConstant::new_(Eval().eval(e.func,d)));
 			return;
 		}
 	}
@@ -244,7 +353,7 @@ void ExprCopy::visit(const ExprApply& e) {
 		mark(e.arg(i));
 	}
 
-	clone.insert(e, &ExprApply::new_(e.func, args2));
+	insert(e, ExprApply::new_(e.func, args2));
 }
 
 void ExprCopy::visit(const ExprChi& e) {  // TODO to check  Jordan: Gilles C. help me
@@ -258,7 +367,7 @@ void ExprCopy::visit(const ExprChi& e) {  // TODO to check  Jordan: Gilles C. he
 		// it is an argument of this function call.
 		mark(e.arg(i));
 	}
-	clone.insert(e, &ExprChi::new_(args2));
+	insert(e, ExprChi::new_(args2));
 }
 
 
@@ -278,22 +387,34 @@ bool ExprCopy::binary_copy(const ExprBinaryOp& e, dom_func2 fcst) {
 		if (cl && cr) {
 			/* evaluate the constant expression on-the-fly */
 			//std::cout << "  cst left=" << cl->get() << "  cst right=" << cr->get() << std::endl;
-			clone.insert(e, &ExprConstant::new_(fcst(cl->get(),cr->get())));
+			insert(e, ExprConstant::new_(fcst(cl->get(),cr->get())));
 			//std::cout << "    CST=" << *clone[e] << std::endl;
 			return false;
 		}
 
+		// neutral elements (the constant is removed)
+		bool left_neutral=false;
+		bool right_neutral=false;
+
 		if (dynamic_cast<const ExprMul*>(&e)) {
-			if (cl && cl->dim.is_scalar() && cl->get_value()==Interval::ONE) {
-				mark(e.right);
-				clone.insert(e, &RIGHT);
-				return false;
-			}
-			if (cr && cr->dim.is_scalar() && cr->get_value()==Interval::ONE) {
-				mark(e.left);
-				clone.insert(e, &LEFT);
-				return false;
-			}
+			left_neutral=is_scalar_cst(cl,Interval::ONE);
+			right_neutral=is_scalar_cst(cr,Interval::ONE);
+		} else if (dynamic_cast<const ExprAdd*>(&e) && e.dim.is_scalar()) {
+			left_neutral=is_scalar_cst(cl,Interval::ZERO);
+			right_neutral=is_scalar_cst(cr,Interval::ZERO);
+		} else if (dynamic_cast<const ExprDiv*>(&e)) {
+			right_neutral=is_scalar_cst(cr,Interval::ONE);
+		}
+
+		if (left_neutral) {
+			mark(e.right);
+			clone.insert(e, &RIGHT);
+			return false;
+		}
+		if (right_neutral) {
+			mark(e.left);
+			clone.insert(e, &LEFT);
+			return false;
 		}
 	}
 	// don't remove copies of subnodes, even one is a constant, because it is an argument of this operator
@@ -303,13 +424,13 @@ bool ExprCopy::binary_copy(const ExprBinaryOp& e, dom_func2 fcst) {
 	return true;
 }
 
-void ExprCopy::visit(const ExprAdd& e)   { if (binary_copy(e, operator+)) clone.insert(e, &(LEFT+RIGHT));; }
-void ExprCopy::visit(const ExprMul& e)   { if (binary_copy(e, operator*)) clone.insert(e, &(LEFT*RIGHT)); }
-void ExprCopy::visit(const ExprSub& e)   { if (binary_copy(e, operator-)) clone.insert(e, &(LEFT-RIGHT)); }
-void ExprCopy::visit(const ExprDiv& e)   { if (binary_copy(e, operator/)) clone.insert(e, &(LEFT/RIGHT)); }
-void ExprCopy::visit(const ExprMax& e)   { if (binary_copy(e, max  ))     clone.insert(e, &max(LEFT,RIGHT)); }
-void ExprCopy::visit(const ExprMin& e)   { if (binary_copy(e, min  ))     clone.insert(e, &min(LEFT,RIGHT)); }
-void ExprCopy::visit(const ExprAtan2& e) { if (binary_copy(e, atan2))     clone.insert(e, &atan2(LEFT,RIGHT)); }
+void ExprCopy::visit(const ExprAdd& e)   { if (binary_copy(e, operator+)) insert(e, LEFT+RIGHT);; }
+void ExprCopy::visit(const ExprMul& e)   { if (binary_copy(e, operator*)) insert(e, LEFT*RIGHT); }
+void ExprCopy::visit(const ExprSub& e)   { if (binary_copy(e, operator-)) insert(e, LEFT-RIGHT); }
+void ExprCopy::visit(const ExprDiv& e)   { if (binary_copy(e, operator/)) insert(e, LEFT/RIGHT); }
+void ExprCopy::visit(const ExprMax& e)   { if (binary_copy(e, max  ))     insert(e, max(LEFT,RIGHT)); }
+void ExprCopy::visit(const ExprMin& e)   { if (binary_copy(e, min  ))     insert(e, min(LEFT,RIGHT)); }
+void ExprCopy::visit(const ExprAtan2& e) { if (binary_copy(e, atan2))     insert(e, atan2(LEFT,RIGHT)); }
 
 void ExprCopy::visit(const ExprPower& e) {
 	visit(e.expr);
@@ -317,12 +438,12 @@ void ExprCopy::visit(const ExprPower& e) {
 		const ExprConstant* c=dynamic_cast<const ExprConstant*>(&EXPR);
 		if (c) {
 			/* evaluate the constant expression on-the-fly */
-			clone.insert(e, &ExprConstant::new_(pow(c->get(),e.expon)));
+			insert(e, ExprConstant::new_(pow(c->get(),e.expon)));
 			return;
 		}
 	}
 	mark(e.expr);
-	clone.insert(e, &pow(EXPR,e.expon));
+	insert(e, pow(EXPR,e.expon));
 }
 
 bool ExprCopy::unary_copy(const ExprUnaryOp& e, Domain (*fcst)(const Domain&)) {
@@ -331,7 +452,7 @@ bool ExprCopy::unary_copy(const ExprUnaryOp& e, Domain (*fcst)(const Domain&)) {
 		const ExprConstant* c=dynamic_cast<const ExprConstant*>(&EXPR);
 		if (c) {
 			/* evaluate the constant expression on-the-fly */
-			clone.insert(e, &ExprConstant::new_(fcst(c->get())));
+			insert(e, ExprConstant::new_(fcst(c->get())));
 			return false;
 		}
 	}
@@ -339,26 +460,26 @@ bool ExprCopy::unary_copy(const ExprUnaryOp& e, Domain (*fcst)(const Domain&)) {
 	return true;
 }
 
-void ExprCopy::visit(const ExprMinus& e) { if (unary_copy(e,operator- )) clone.insert(e,&(-EXPR)); }
-void ExprCopy::visit(const ExprTrans& e) { if (unary_copy(e,transpose )) clone.insert(e,&transpose (EXPR)); }
-void ExprCopy::visit(const ExprSign& e)  { if (unary_copy(e,sign )) clone.insert(e,&sign (EXPR)); }
-void ExprCopy::visit(const ExprAbs& e)   { if (unary_copy(e,abs ))  clone.insert(e,&abs (EXPR)); }
-void ExprCopy::visit(const ExprSqr& e)   { if (unary_copy(e,sqr ))  clone.insert(e,&sqr (EXPR)); }
-void ExprCopy::visit(const ExprSqrt& e)  { if (unary_copy(e,sqrt )) clone.insert(e,&sqrt (EXPR)); }
-void ExprCopy::visit(const ExprExp& e)   { if (unary_copy(e,exp  )) clone.insert(e,&exp  (EXPR)); }
-void ExprCopy::visit(const ExprLog& e)   { if (unary_copy(e,log  )) clone.insert(e,&log  (EXPR)); }
-void ExprCopy::visit(const ExprCos& e)   { if (unary_copy(e,cos  )) clone.insert(e,&cos  (EXPR)); }
-void ExprCopy::visit(const ExprSin& e)   { if (unary_copy(e,sin  )) clone.insert(e,&sin  (EXPR)); }
-void ExprCopy::visit(const ExprTan& e)   { if (unary_copy(e,tan  )) clone.insert(e,&tan  (EXPR)); }
-void ExprCopy::visit(const ExprCosh& e)  { if (unary_copy(e,cosh )) clone.insert(e,&cosh (EXPR)); }
-void ExprCopy::visit(const ExprSinh& e)  { if (unary_copy(e,sinh )) clone.insert(e,&sinh (EXPR)); }
-void ExprCopy::visit(const ExprTanh& e)  { if (unary_copy(e,tanh )) clone.insert(e,&tanh (EXPR)); }
-void ExprCopy::visit(const ExprAcos& e)  { if (unary_copy(e,acos )) clone.insert(e,&acos (EXPR)); }
-void ExprCopy::visit(const ExprAsin& e)  { if (unary_copy(e,asin )) clone.insert(e,&asin (EXPR)); }
-void ExprCopy::visit(const ExprAtan& e)  { if (unary_copy(e,atan )) clone.insert(e,&atan (EXPR)); }
-void ExprCopy::visit(const ExprAcosh& e) { if (unary_copy(e,acosh)) clone.insert(e,&acosh(EXPR)); }
-void ExprCopy::visit(const ExprAsinh& e) { if (unary_copy(e,asinh)) clone.insert(e,&asinh(EXPR)); }
-void ExprCopy::visit(const ExprAtanh& e) { if (unary_copy(e,atanh)) clone.insert(e,&atanh(EXPR)); }
+void ExprCopy::visit(const ExprMinus& e) { if (unary_copy(e,operator- )) insert(e,(-EXPR)); }
+void ExprCopy::visit(const ExprTrans& e) { if (unary_copy(e,transpose )) insert(e,transpose (EXPR)); }
+void ExprCopy::visit(const ExprSign& e)  { if (unary_copy(e,sign )) insert(e,sign (EXPR)); }
+void ExprCopy::visit(const ExprAbs& e)   { if (unary_copy(e,abs ))  insert(e,abs (EXPR)); }
+void ExprCopy::visit(const ExprSqr& e)   { if (unary_copy(e,sqr ))  insert(e,sqr (EXPR)); }
+void ExprCopy::visit(const ExprSqrt& e)  { if (unary_copy(e,sqrt )) insert(e,sqrt (EXPR)); }
+void ExprCopy::visit(const ExprExp& e)   { if (unary_copy(e,exp  )) insert(e,exp  (EXPR)); }
+void ExprCopy::visit(const ExprLog& e)   { if (unary_copy(e,log  )) insert(e,log  (EXPR)); }
+void ExprCopy::visit(const ExprCos& e)   { if (unary_copy(e,cos  )) insert(e,cos  (EXPR)); }
+void ExprCopy::visit(const ExprSin& e)   { if (unary_copy(e,sin  )) insert(e,sin  (EXPR)); }
+void ExprCopy::visit(const ExprTan& e)   { if (unary_copy(e,tan  )) insert(e,tan  (EXPR)); }
+void ExprCopy::visit(const ExprCosh& e)  { if (unary_copy(e,cosh )) insert(e,cosh (EXPR)); }
+void ExprCopy::visit(const ExprSinh& e)  { if (unary_copy(e,sinh )) insert(e,sinh (EXPR)); }
+void ExprCopy::visit(const ExprTanh& e)  { if (unary_copy(e,tanh )) insert(e,tanh (EXPR)); }
+void ExprCopy::visit(const ExprAcos& e)  { if (unary_copy(e,acos )) insert(e,acos (EXPR)); }
+void ExprCopy::visit(const ExprAsin& e)  { if (unary_copy(e,asin )) insert(e,asin (EXPR)); }
+void ExprCopy::visit(const ExprAtan& e)  { if (unary_copy(e,atan )) insert(e,atan (EXPR)); }
+void ExprCopy::visit(const ExprAcosh& e) { if (unary_copy(e,acosh)) insert(e,acosh(EXPR)); }
+void ExprCopy::visit(const ExprAsinh& e) { if (unary_copy(e,asinh)) insert(e,asinh(EXPR)); }
+void ExprCopy::visit(const ExprAtanh& e) { if (unary_copy(e,atanh)) insert(e,atanh(EXPR)); }
 
 } // end ibex namespace
 
@@ -17,6 +17,10 @@
 #include "ibex_Domain.h"
 #include "ibex_NodeMap.h"
 
+#include <map>
+#include <vector>
+#include <typeinfo>
+
 namespace ibex {
 
 
@@ -49,7 +53,11 @@ public:
 	 *
 	 * Symbols in \a old_x are matched to symbols in \a new_x with respect to their order.
 	 *
-	 * \param fold_cst - if true, all constant subexpressions are "folded" into a single node.
+	 * \param fold_cst - if true, the copy is simplified:
+	 *                   - all constant subexpressions are "folded" into a single node;
+	 *                   - x*1, 1*x, x/1, x+0 and 0+x are replaced by x (for scalar 0 and 1);
+	 *                   - common subexpressions are shared: the copy contains no two nodes
+	 *                     with the same operator and the same subnodes (hash-consing).
 	 *
 	 * \pre The size of \a new_x must be greater or equal to the size of \a old_x. It is not
 	 *      required to be the same size to allow the use of extra variables (that do not occurr in the expression).
@@ -155,6 +163,35 @@ protected:
 	void mark(const ExprNode&);
 	bool unary_copy(const ExprUnaryOp& e, Domain (*fcst)(const Domain&));
 	bool binary_copy(const ExprBinaryOp& e, Domain (*fcst)(const Domain&, const Domain&));
+
+	/*
+	 * Set \a copy as the copy of \a e.
+	 *
+	 * In "fold" mode, if the copy already contains a node identical
+	 * to \a copy, this node is taken instead and \a copy is deleted.
+	 *
+	 * \pre \a copy is a new node and its subnodes belong to the copy.
+	 */
+	void insert(const ExprNode& e, const ExprNode& copy);
+
+	// ========== only in "fold" mode ===========
+	// Structure of a node: its operator, its subnodes and
+	// its index, exponent, function or constant value.
+	struct NodeKey {
+		const std::type_info* op;
+		std::vector<const ExprNode*> args;
+		int i;
+		const void* f;
+		double lb, ub;
+
+		bool operator<(const NodeKey& k) const;
+	};
+
+	// The nodes of the copy, indexed by their structure.
+	std::map<NodeKey,const ExprNode*> nodes;
+
+	/* Set the structure of a node. Return false if the node cannot be shared. */
+	static bool key(const ExprNode& e, NodeKey& k);
 };
 
 
@@ -0,0 +1,65 @@
+/* ============================================================================
+ * I B E X - Clocks of strategies
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : IBEX contributors
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "ibex_Clock.h"
+
+#ifdef _WIN32
+#include <ctime>
+#else
+#include <time.h>
+#endif
+
+namespace ibex {
+
+Clock::Clock(Type type) : type(type), acc(0), t0(0), _running(false), period(1), count(0), last_check(0) {
+
+}
+
+void Clock::start() {
+	if (_running) return;
+	t0=now(type);
+	_running=true;
+}
+
+void Clock::stop() {
+	if (!_running) return;
+	acc+=now(type)-t0;
+	_running=false;
+}
+
+void Clock::reset() {
+	acc=0;
+	_running=false;
+	period=1;
+	count=0;
+	last_check=0;
+}
+
+double Clock::elapsed() const {
+	return _running? acc+now(type)-t0 : acc;
+}
+
+double Clock::now(Type type) {
+#ifdef _WIN32
+	// only the CPU time of the process is available
+	return ((double) std::clock())/CLOCKS_PER_SEC;
+#else
+	struct timespec ts;
+	switch (type) {
+	case REAL:       clock_gettime(CLOCK_MONOTONIC, &ts); break;
+	case CPU:        clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts); break;
+	default:         clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+	}
+	return (double) ts.tv_sec + (double) ts.tv_nsec / 1e9;
+#endif
+}
+
+} // end namespace ibex
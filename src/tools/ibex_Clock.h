@@ -0,0 +1,161 @@
+/* ============================================================================
+ * I B E X - Clocks of strategies
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : IBEX contributors
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __IBEX_CLOCK_H__
+#define __IBEX_CLOCK_H__
+
+#include "ibex_Timer.h"
+
+namespace ibex {
+
+/**
+ * \ingroup tools
+ * \brief Stopwatch with a time limit.
+ *
+ * Unlike #ibex::Timer (whose state is global), each clock has its own
+ * state: several strategies (e.g., solvers running in different threads)
+ * can be timed independently. A clock measures either the (monotonic)
+ * real time, the CPU time of the process or the CPU time of the calling
+ * thread. The time is read with clock_gettime, which does not require a
+ * system call for the real time under Linux.
+ *
+ * The time is accumulated between start() and stop(). A strategy can
+ * check its time limit at each node with expired(double) or check(double): the clock is
+ * actually read only every k calls (k<=65536). k is calculated from the duration
+ * of the calls since the last reading so that the next reading occurs about
+ * one millisecond later and before the limit. So the limit is exceeded by
+ * less than one millisecond as long as the calls take about the same time.
+ * If they suddenly become longer, it can be exceeded by up to k times the new
+ * duration of a call (then k is decreased at the next reading).
+ *
+ * A clock must not be used by several threads at the same time
+ * (but a copy can be given to each thread).
+ */
+class Clock {
+public:
+	/**
+	 * \brief Type of clock.
+	 *
+	 * - REAL       : real (wall-clock) time, monotonic.
+	 * - CPU        : CPU time of the process (all the threads).
+	 * - THREAD_CPU : CPU time of the calling thread.
+	 */
+	typedef enum { REAL, CPU, THREAD_CPU } Type;
+
+	/**
+	 * \brief Create a stopped clock (with zero time elapsed).
+	 */
+	Clock(Type type=THREAD_CPU);
+
+	/**
+	 * \brief Start (or resume) the clock.
+	 */
+	void start();
+
+	/**
+	 * \brief Stop the clock (the elapsed time is kept).
+	 */
+	void stop();
+
+	/**
+	 * \brief Set the elapsed time to zero (the clock is stopped).
+	 */
+	void reset();
+
+	/**
+	 * \brief True if the clock is started.
+	 */
+	bool running() const;
+
+	/**
+	 * \brief Time elapsed (in seconds) between the calls to start() and stop().
+	 *
+	 * If the clock is running, includes the time elapsed since the last start().
+	 */
+	double elapsed() const;
+
+	/**
+	 * \brief True if the elapsed time exceeds \a limit.
+	 *
+	 * No limit if \a limit<=0. The clock is only read every k calls (see above):
+	 * the result may be false although the limit is exceeded.
+	 */
+	bool expired(double limit);
+
+	/**
+	 * \brief Throw a #ibex::TimeOutException if expired(limit).
+	 */
+	void check(double limit);
+
+	/**
+	 * \brief Current time (in seconds) of a clock of type \a type.
+	 *
+	 * The origin is arbitrary.
+	 */
+	static double now(Type type);
+
+	/**
+	 * \brief Type of the clock.
+	 */
+	const Type type;
+
+private:
+	/* Time accumulated until the last stop() */
+	double acc;
+
+	/* Value of now(type) at the last start() */
+	double t0;
+
+	bool _running;
+
+	/* The clock is read every "period" calls to expired() */
+	int period;
+
+	/* Number of calls to expired() since the clock was read */
+	int count;
+
+	/* Elapsed time when the clock was last read by expired() */
+	double last_check;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline bool Clock::running() const {
+	return _running;
+}
+
+inline bool Clock::expired(double limit) {
+	if (limit<=0 || ++count<period) return false;
+
+	double t=elapsed();
+	if (t>=limit) return true;
+
+	// the next reading in one millisecond or at the limit (whichever
+	// is first) if the next calls take as long as the last ones.
+	// The period is at most doubled.
+	double next=limit-t<1e-3? limit-t : 1e-3;
+	double p=2.0*period;
+	if (t>last_check && count*next/(t-last_check)<p)
+		p=count*next/(t-last_check);
+
+	period= p<1? 1 : (p>(1<<16)? (1<<16) : (int) p);
+	last_check=t;
+	count=0;
+	return false;
+}
+
+inline void Clock::check(double limit) {
+	if (expired(limit)) throw TimeOutException();
+}
+
+} // end namespace ibex
+
+#endif // __IBEX_CLOCK_H__
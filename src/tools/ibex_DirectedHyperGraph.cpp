@@ -11,23 +11,78 @@
 
 #include "ibex_DirectedHyperGraph.h"
 #include <iterator>
+#include <algorithm>
+
+using namespace std;
 
 namespace ibex {
 
-std::ostream& operator<<(std::ostream& os, const DirectedHyperGraph& g) {
+namespace {
+
+pair<int,int> reversed_arc(const pair<int,int>& arc) {
+	return pair<int,int>(arc.second,arc.first);
+}
+
+}
+
+DirectedHyperGraph::CSR::CSR(int nb_nodes) : nb_nodes(nb_nodes), start(new int[nb_nodes+1]), index(NULL) {
+	for (int i=0; i<=nb_nodes; i++) start[i]=0;
+}
+
+DirectedHyperGraph::CSR::~CSR() {
+	delete[] start;
+	if (index) delete[] index;
+}
+
+void DirectedHyperGraph::CSR::build(const vector<pair<int,int> >& arcs) {
+	// sort the arcs by node, then by neighbor, and remove duplicates
+	vector<pair<int,int> > sorted(arcs);
+	sort(sorted.begin(),sorted.end());
+	sorted.erase(unique(sorted.begin(),sorted.end()),sorted.end());
+
+	if (index) delete[] index;
+	index = sorted.empty() ? NULL : new int[sorted.size()];
+
+	int k=0;
+	for (int i=0; i<nb_nodes; i++) {
+		start[i]=k;
+		while (k<(int) sorted.size() && sorted[k].first==i) {
+			index[k]=sorted[k].second;
+			k++;
+		}
+	}
+	start[nb_nodes]=k;
+}
+
+void DirectedHyperGraph::compile() const {
+	ctr_input_adj.build(input_arcs);
+	ctr_output_adj.build(output_arcs);
+
+	vector<pair<int,int> > rev(input_arcs.size());
+	transform(input_arcs.begin(),input_arcs.end(),rev.begin(),reversed_arc);
+	var_output_adj.build(rev);
+
+	rev.resize(output_arcs.size());
+	transform(output_arcs.begin(),output_arcs.end(),rev.begin(),reversed_arc);
+	var_input_adj.build(rev);
+
+	compiled=true;
+}
+
+ostream& operator<<(ostream& os, const DirectedHyperGraph& g) {
 	for (int c=0; c<g.m; c++) {
 		os << "ctr " << c << " input=( ";
-		copy(g.input_vars(c).begin(), g.input_vars(c).end(), std::ostream_iterator<int>(os, " "));
+		copy(g.input_vars(c).begin(), g.input_vars(c).end(), ostream_iterator<int>(os, " "));
 		os << ") output=( ";
-		copy(g.output_vars(c).begin(), g.output_vars(c).end(), std::ostream_iterator<int>(os, " "));
+		copy(g.output_vars(c).begin(), g.output_vars(c).end(), ostream_iterator<int>(os, " "));
 		os << ")\n";
 	}
 
 	for (int v=0; v<g.n; v++) {
 		os << "var " << v << " input=( ";
-		copy(g.input_ctrs(v).begin(), g.input_ctrs(v).end(), std::ostream_iterator<int>(os, " "));
+		copy(g.input_ctrs(v).begin(), g.input_ctrs(v).end(), ostream_iterator<int>(os, " "));
 		os << ") output=( ";
-		copy(g.output_ctrs(v).begin(), g.output_ctrs(v).end(), std::ostream_iterator<int>(os, " "));
+		copy(g.output_ctrs(v).begin(), g.output_ctrs(v).end(), ostream_iterator<int>(os, " "));
 		os << ")\n";
 	}
 	return os;
@@ -1,5 +1,5 @@
 /* ============================================================================
- * I B E X - Directed hyper-graph (represented by an adjacency matrix)
+ * I B E X - Directed hyper-graph (compressed sparse row representation)
  * ============================================================================
  * Copyright   : Ecole des Mines de Nantes (FRANCE)
  * License     : This program can be distributed under the terms of the GNU LGPL.
@@ -13,14 +13,66 @@
 #define __IBEX_DIRECTED_HYPER_GRAPH_H__
 
 #include <iostream>
-#include <set>
+#include <vector>
+#include <utility>
 
 namespace ibex {
 
+/**
+ * \ingroup tools
+ * \brief Contiguous range of indices.
+ *
+ * Read-only view on a sorted array of indices (no copy).
+ */
+class IndexRange {
+public:
+	/**
+	 * \brief Build the range [first,last).
+	 */
+	IndexRange(const int* first, const int* last);
+
+	/**
+	 * \brief Pointer to the first index.
+	 */
+	const int* begin() const;
+
+	/**
+	 * \brief Pointer past the last index.
+	 */
+	const int* end() const;
+
+	/**
+	 * \brief Number of indices.
+	 */
+	int size() const;
+
+	/**
+	 * \brief True iff the range is empty.
+	 */
+	bool empty() const;
+
+	/**
+	 * \brief Return the ith index.
+	 */
+	int operator[](int i) const;
+
+private:
+	const int* first;
+	const int* last;
+};
+
 /**
  * \ingroup tools
  * \brief Directed hyper-graph.
  *
+ * The four adjacency relations (input/output variables of a constraint,
+ * input/output constraints of a variable) are stored in compressed sparse row
+ * format: the neighbors of all the nodes are in a single array, sorted and
+ * without duplicates, and the neighbors of a node are a contiguous range
+ * of this array (see #IndexRange).
+ *
+ * The arcs added with #add_arc(int,int,bool) are compiled into this format
+ * by the first query that follows.
  */
 class DirectedHyperGraph {
 public:
@@ -58,27 +110,27 @@ public:
 	 * \brief Return the input variables of a constraint \a ctr.
 	 *
 	 */
-	 const std::set<int>& input_vars(int ctr) const;
+	 IndexRange input_vars(int ctr) const;
 
 	/**
 	 * \brief Return the output variables of a constraint \a ctr.
 	 *
 	 */
-	 const std::set<int>& output_vars(int ctr) const;
+	 IndexRange output_vars(int ctr) const;
 
 	/**
 	 * \brief Return the input constraints of a variable \a var.
 	 *
 	 *  \pre 0 <= \a var < #nb_var().
 	 */
-	 const std::set<int>& input_ctrs(int var) const;
+	 IndexRange input_ctrs(int var) const;
 
 	/**
 	 * \brief Return the output constraints of a variable \a var.
 	 *
 	 *  \pre 0 <= \a var < #nb_var().
 	 */
-	 const std::set<int>& output_ctrs(int var) const;
+	 IndexRange output_ctrs(int var) const;
 
 	/**
 	 * \brief Display the internal structure (matrix & tables).
@@ -90,29 +142,78 @@ public:
 private:
 	DirectedHyperGraph(const DirectedHyperGraph&);
 
+	/*
+	 * Adjacency relation in compressed sparse row format.
+	 * The neighbors of node i are index[start[i]]...index[start[i+1]-1].
+	 */
+	struct CSR {
+		CSR(int nb_nodes);
+		~CSR();
+		/* Rebuild the relation from a list of arcs (node,neighbor). */
+		void build(const std::vector<std::pair<int,int> >& arcs);
+		IndexRange neighbors(int i) const;
+		const int nb_nodes;
+		int* start;
+		int* index;
+	};
+
+	/* Compile the arcs into the CSR relations. */
+	void compile() const;
+
 	const int m;
 	const int n;
-	std::set<int> *ctr_input_adj;
-	std::set<int> *ctr_output_adj;
-	std::set<int> *var_input_adj;
-	std::set<int> *var_output_adj;
+
+	/* Arcs var->ctr and ctr->var, as (ctr,var) pairs */
+	std::vector<std::pair<int,int> > input_arcs;
+	std::vector<std::pair<int,int> > output_arcs;
+
+	/* True iff the CSR relations are up to date */
+	mutable bool compiled;
+
+	mutable CSR ctr_input_adj;
+	mutable CSR ctr_output_adj;
+	mutable CSR var_input_adj;
+	mutable CSR var_output_adj;
 };
 
 
 /*================================== inline implementations ========================================*/
 
-inline DirectedHyperGraph::DirectedHyperGraph(int nb_ctr, int nb_var) : m(nb_ctr), n(nb_var) {
-	ctr_input_adj = new std::set<int>[m];
-	ctr_output_adj = new std::set<int>[m];
-	var_input_adj = new std::set<int>[n];
-	var_output_adj = new std::set<int>[n];
+inline IndexRange::IndexRange(const int* first, const int* last) : first(first), last(last) {
+
+}
+
+inline const int* IndexRange::begin() const {
+	return first;
+}
+
+inline const int* IndexRange::end() const {
+	return last;
+}
+
+inline int IndexRange::size() const {
+	return last-first;
+}
+
+inline bool IndexRange::empty() const {
+	return first==last;
+}
+
+inline int IndexRange::operator[](int i) const {
+	return first[i];
+}
+
+inline IndexRange DirectedHyperGraph::CSR::neighbors(int i) const {
+	return IndexRange(index+start[i],index+start[i+1]);
+}
+
+inline DirectedHyperGraph::DirectedHyperGraph(int nb_ctr, int nb_var) : m(nb_ctr), n(nb_var), compiled(true),
+		ctr_input_adj(nb_ctr), ctr_output_adj(nb_ctr), var_input_adj(nb_var), var_output_adj(nb_var) {
+
 }
 
 inline DirectedHyperGraph::~DirectedHyperGraph() {
-	delete[] ctr_input_adj;
-	delete[] ctr_output_adj;
-	delete[] var_input_adj;
-	delete[] var_output_adj;
+
 }
 
 inline int DirectedHyperGraph::nb_ctr() const {
@@ -124,29 +225,31 @@ inline int DirectedHyperGraph::nb_var() const {
 }
 
 inline void DirectedHyperGraph::add_arc(int ctr, int var, bool incoming) {
-	if (incoming) {
-		ctr_input_adj[ctr].insert(var);
-		var_output_adj[var].insert(ctr);
-	} else {
-		ctr_output_adj[ctr].insert(var);
-		var_input_adj[var].insert(ctr);
-	}
+	if (incoming)
+		input_arcs.push_back(std::pair<int,int>(ctr,var));
+	else
+		output_arcs.push_back(std::pair<int,int>(ctr,var));
+	compiled=false;
 }
 
-inline const std::set<int>& DirectedHyperGraph::input_vars(int ctr) const {
-	return ctr_input_adj[ctr];
+inline IndexRange DirectedHyperGraph::input_vars(int ctr) const {
+	if (!compiled) compile();
+	return ctr_input_adj.neighbors(ctr);
 }
 
-inline const std::set<int>& DirectedHyperGraph::output_vars(int ctr) const {
-	return ctr_output_adj[ctr];
+inline IndexRange DirectedHyperGraph::output_vars(int ctr) const {
+	if (!compiled) compile();
+	return ctr_output_adj.neighbors(ctr);
 }
 
-inline const std::set<int>& DirectedHyperGraph::input_ctrs(int var) const {
-	return var_input_adj[var];
+inline IndexRange DirectedHyperGraph::input_ctrs(int var) const {
+	if (!compiled) compile();
+	return var_input_adj.neighbors(var);
 }
 
-inline const std::set<int>& DirectedHyperGraph::output_ctrs(int var) const {
-	return var_output_adj[var];
+inline IndexRange DirectedHyperGraph::output_ctrs(int var) const {
+	if (!compiled) compile();
+	return var_output_adj.neighbors(var);
 }
 
 } // namespace ibex
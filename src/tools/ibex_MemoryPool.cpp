@@ -0,0 +1,214 @@
+/* ============================================================================
+ * I B E X - Pools of memory blocks
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : IBEX contributors
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "ibex_MemoryPool.h"
+
+#include <cassert>
+#include <pthread.h>
+
+namespace ibex {
+
+namespace {
+
+/* Alignment of the blocks */
+const size_t ALIGN=16;
+
+/* Size of a slab (in bytes): below the threshold of mmap in malloc */
+const size_t SLAB_BYTES=64*1024;
+
+/* Number of shared pools (one per multiple of ALIGN) */
+const int NB_POOLS=256;
+
+/* Number of blocks moved at once between a shared pool and a thread cache */
+const int BATCH=32;
+
+/* The shared pools, created on demand */
+MemoryPool* volatile pools[NB_POOLS];
+
+Mutex& pools_mutex() {
+	static Mutex m;
+	return m;
+}
+
+inline int pool_index(size_t size) {
+	return size==0? 0 : (int) ((size-1)/ALIGN);
+}
+
+inline void*& next_block(void* p) {
+	return *((void**) p);
+}
+
+}
+
+/*
+ * Free blocks of the shared pools owned by a thread.
+ */
+class ThreadCache {
+public:
+	ThreadCache() {
+		for (int i=0; i<NB_POOLS; i++) {
+			head[i]=NULL;
+			count[i]=0;
+		}
+	}
+
+	/* Give back all the blocks to the shared pools */
+	~ThreadCache() {
+		for (int i=0; i<NB_POOLS; i++) {
+			if (count[i]==0) continue;
+			void* tail=head[i];
+			while (next_block(tail)) tail=next_block(tail);
+			pools[i]->free(head[i],tail,count[i]);
+		}
+	}
+
+	/* The cache of the current thread */
+	static ThreadCache& get() {
+		if (!current) {
+			pthread_once(&once, create_key);
+			current=new ThreadCache();
+			pthread_setspecific(key, current);
+		}
+		return *current;
+	}
+
+	void* head[NB_POOLS];
+	int count[NB_POOLS];
+
+private:
+	static void create_key() {
+		pthread_key_create(&key, destroy);
+	}
+
+	/* called when a thread terminates */
+	static void destroy(void* cache) {
+		current=NULL;
+		delete (ThreadCache*) cache;
+	}
+
+	static __thread ThreadCache* current;
+	static pthread_key_t key;
+	static pthread_once_t once;
+};
+
+__thread ThreadCache* ThreadCache::current=NULL;
+pthread_key_t ThreadCache::key;
+pthread_once_t ThreadCache::once=PTHREAD_ONCE_INIT;
+
+const size_t MemoryPool::max_size=NB_POOLS*ALIGN;
+
+MemoryPool::MemoryPool(size_t size) :
+		size(size<ALIGN? ALIGN : (size+ALIGN-1)/ALIGN*ALIGN),
+		slab_size(this->size<SLAB_BYTES/16? SLAB_BYTES/this->size : 16),
+		free_list(NULL), next(NULL), end(NULL), used(0) {
+}
+
+MemoryPool::~MemoryPool() {
+	assert(used==0);
+	for (std::vector<char*>::iterator it=slabs.begin(); it!=slabs.end(); it++)
+		delete[] *it;
+}
+
+void* MemoryPool::alloc(int n) {
+	Lock lock(mutex);
+	used+=n;
+	void* head=NULL;
+	for (int k=0; k<n; k++) {
+		void* p;
+		if (free_list) {
+			p=free_list;
+			free_list=next_block(p);
+		} else {
+			if (next==end) {
+				// note: new[] returns a block aligned for any type
+				next=new char[slab_size*size];
+				end=next+slab_size*size;
+				slabs.push_back(next);
+			}
+			p=next;
+			next+=size;
+		}
+		next_block(p)=head;
+		head=p;
+	}
+	return head;
+}
+
+void MemoryPool::free(void* head, void* tail, int n) {
+	Lock lock(mutex);
+	assert(used>=n);
+	used-=n;
+	if (used==0) {
+		// all the blocks are freed: release the memory in bulk
+		for (std::vector<char*>::iterator it=slabs.begin(); it!=slabs.end(); it++)
+			delete[] *it;
+		slabs.clear();
+		free_list=NULL;
+		next=end=NULL;
+	} else {
+		next_block(tail)=free_list;
+		free_list=head;
+	}
+}
+
+MemoryPool* MemoryPool::pool(size_t size) {
+	if (size>max_size) return NULL;
+	int i=pool_index(size);
+	MemoryPool* p=pools[i];
+	if (!p) {
+		Lock lock(pools_mutex());
+		p=pools[i];
+		if (!p) {
+			p=new MemoryPool((i+1)*ALIGN);
+			__sync_synchronize(); // the pool is built before being published
+			pools[i]=p;
+		}
+	}
+	return p;
+}
+
+void* MemoryPool::allocate(size_t size) {
+	if (size>max_size) return ::operator new(size);
+
+	int i=pool_index(size);
+	ThreadCache& cache=ThreadCache::get();
+	void* p=cache.head[i];
+	if (!p) {
+		p=pool(size)->alloc(BATCH);
+		cache.count[i]=BATCH;
+	}
+	cache.head[i]=next_block(p);
+	cache.count[i]--;
+	return p;
+}
+
+void MemoryPool::deallocate(void* p, size_t size) {
+	if (size>max_size) {
+		::operator delete(p);
+		return;
+	}
+
+	int i=pool_index(size);
+	ThreadCache& cache=ThreadCache::get();
+	next_block(p)=cache.head[i];
+	cache.head[i]=p;
+	if (++cache.count[i]==2*BATCH) {
+		// give back half of the blocks to the shared pool
+		void* tail=p;
+		for (int k=1; k<BATCH; k++) tail=next_block(tail);
+		cache.head[i]=next_block(tail);
+		next_block(tail)=NULL;
+		cache.count[i]-=BATCH;
+		pools[i]->free(p,tail,BATCH);
+	}
+}
+
+} // end namespace ibex
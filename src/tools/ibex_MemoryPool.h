@@ -0,0 +1,172 @@
+/* ============================================================================
+ * I B E X - Pools of memory blocks
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : IBEX contributors
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __IBEX_MEMORY_POOL_H__
+#define __IBEX_MEMORY_POOL_H__
+
+#include "ibex_Thread.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace ibex {
+
+/**
+ * \ingroup tools
+ * \brief Pool of memory blocks of fixed size.
+ *
+ * The blocks are cut in large slabs and recycled through a free list.
+ * When the last block in use is given back, all the slabs are released
+ * at once.
+ *
+ * This is the allocator of the search tree: cells, their boxes
+ * and their backtrackable data are created and deleted in huge
+ * numbers (see #ibex::Cell). They use the shared pools, one per size
+ * (see #allocate(size_t)). Each thread keeps a small cache of free blocks
+ * of the shared pools, so that allocating or freeing a block usually
+ * takes a few instructions, with no lock.
+ *
+ * The blocks in the cache of a thread count as used. So the slabs of
+ * a shared pool are only released when no block of this size is used
+ * anywhere in the process and all the caches holding such blocks have
+ * been given back (when their threads end). Deleting a search tree
+ * therefore usually recycles its blocks rather than releasing them.
+ *
+ * All the functions are thread-safe.
+ */
+class MemoryPool {
+public:
+	/**
+	 * \brief Create a pool of blocks of \a size bytes.
+	 */
+	MemoryPool(size_t size);
+
+	/**
+	 * \brief Delete *this (release all the slabs).
+	 *
+	 * \pre No block is in use.
+	 */
+	~MemoryPool();
+
+	/**
+	 * \brief Allocate a block.
+	 */
+	void* alloc();
+
+	/**
+	 * \brief Free a block.
+	 *
+	 * \pre \a p has been allocated by this pool.
+	 */
+	void free(void* p);
+
+	/**
+	 * \brief Size of the blocks (in bytes).
+	 */
+	size_t block_size() const;
+
+	/**
+	 * \brief Number of blocks in use.
+	 *
+	 * For a shared pool, this includes the blocks in the caches of the threads.
+	 */
+	int nb_used() const;
+
+	/**
+	 * \brief Number of slabs.
+	 */
+	int nb_slabs() const;
+
+	/**
+	 * \brief The shared pool for blocks of \a size bytes.
+	 *
+	 * Sizes are rounded up to a multiple of 16 (the alignment of the blocks).
+	 * Return NULL if \a size exceeds #max_size.
+	 */
+	static MemoryPool* pool(size_t size);
+
+	/**
+	 * \brief Allocate \a size bytes in the shared pools.
+	 *
+	 * Blocks larger than #max_size are allocated on the heap.
+	 */
+	static void* allocate(size_t size);
+
+	/**
+	 * \brief Free \a size bytes allocated by #allocate(size_t).
+	 */
+	static void deallocate(void* p, size_t size);
+
+	/**
+	 * \brief Maximal size of a block in the shared pools.
+	 */
+	static const size_t max_size;
+
+private:
+	friend class ThreadCache;
+
+	MemoryPool(const MemoryPool&);            // forbidden
+	MemoryPool& operator=(const MemoryPool&); // forbidden
+
+	/* Take n blocks (linked list) */
+	void* alloc(int n);
+
+	/* Give back n blocks (linked list from head to tail) */
+	void free(void* head, void* tail, int n);
+
+	/* Size of the blocks */
+	const size_t size;
+
+	/* Number of blocks in a slab */
+	const int slab_size;
+
+	/* All the slabs */
+	std::vector<char*> slabs;
+
+	/* The free blocks (linked through their first word) */
+	void* free_list;
+
+	/* The part of the last slab that has never been used */
+	char* next;
+	char* end;
+
+	/* Number of blocks in use */
+	int used;
+
+	Mutex mutex;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline size_t MemoryPool::block_size() const {
+	return size;
+}
+
+inline int MemoryPool::nb_used() const {
+	return used;
+}
+
+inline int MemoryPool::nb_slabs() const {
+	return (int) slabs.size();
+}
+
+inline void* MemoryPool::alloc() {
+	return alloc(1);
+}
+
+inline void MemoryPool::free(void* p) {
+	*((void**) p)=NULL;
+	free(p,p,1);
+}
+
+} // end namespace ibex
+
+#endif // __IBEX_MEMORY_POOL_H__
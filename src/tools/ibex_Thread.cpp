@@ -0,0 +1,86 @@
+/* ============================================================================
+ * I B E X - Threads and synchronization primitives
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : IBEX contributors
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "ibex_Thread.h"
+#include "ibex_Exception.h"
+#include <cassert>
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+namespace ibex {
+
+Mutex::Mutex() {
+	pthread_mutex_init(&m, NULL);
+}
+
+Mutex::~Mutex() {
+	pthread_mutex_destroy(&m);
+}
+
+Condition::Condition() {
+	pthread_cond_init(&c, NULL);
+}
+
+Condition::~Condition() {
+	pthread_cond_destroy(&c);
+}
+
+void Condition::wait(Mutex& m) {
+	pthread_cond_wait(&c, &m.m);
+}
+
+void Condition::signal() {
+	pthread_cond_signal(&c);
+}
+
+void Condition::broadcast() {
+	pthread_cond_broadcast(&c);
+}
+
+Thread::Thread() : started(false) {
+
+}
+
+Thread::~Thread() {
+	assert(!started); // the thread must be joined before
+}
+
+void Thread::start() {
+	assert(!started);
+	if (pthread_create(&t, NULL, entry, this)!=0)
+		ibex_error("Thread: cannot create thread");
+	started=true;
+}
+
+void Thread::join() {
+	if (started) {
+		pthread_join(t, NULL);
+		started=false;
+	}
+}
+
+void* Thread::entry(void* thread) {
+	((Thread*) thread)->run();
+	return NULL;
+}
+
+int Thread::hardware_concurrency() {
+#if !defined(_WIN32) && defined(_SC_NPROCESSORS_ONLN)
+	long n=sysconf(_SC_NPROCESSORS_ONLN);
+	return n>0 ? (int) n : 1;
+#else
+	return 1;
+#endif
+}
+
+} // end namespace ibex
@@ -0,0 +1,162 @@
+/* ============================================================================
+ * I B E X - Threads and synchronization primitives
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : IBEX contributors
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __IBEX_THREAD_H__
+#define __IBEX_THREAD_H__
+
+#include <pthread.h>
+
+namespace ibex {
+
+/**
+ * \ingroup tools
+ * \brief Mutual exclusion lock.
+ *
+ * Thin wrapper of a POSIX mutex, used by the parallel strategies.
+ */
+class Mutex {
+public:
+	/** \brief Create an unlocked mutex. */
+	Mutex();
+
+	/** \brief Delete *this. */
+	~Mutex();
+
+	/** \brief Lock the mutex (blocking). */
+	void lock();
+
+	/** \brief Unlock the mutex. */
+	void unlock();
+
+private:
+	friend class Condition;
+	Mutex(const Mutex&);            // forbidden
+	Mutex& operator=(const Mutex&); // forbidden
+
+	pthread_mutex_t m;
+};
+
+/**
+ * \ingroup tools
+ * \brief Scoped lock.
+ *
+ * The mutex is locked by the constructor and unlocked by the destructor.
+ */
+class Lock {
+public:
+	/** \brief Lock \a m. */
+	Lock(Mutex& m);
+
+	/** \brief Unlock the mutex. */
+	~Lock();
+
+private:
+	Lock(const Lock&);            // forbidden
+	Lock& operator=(const Lock&); // forbidden
+
+	Mutex& m;
+};
+
+/**
+ * \ingroup tools
+ * \brief Condition variable.
+ */
+class Condition {
+public:
+	/** \brief Create a condition variable. */
+	Condition();
+
+	/** \brief Delete *this. */
+	~Condition();
+
+	/**
+	 * \brief Wait for a signal.
+	 *
+	 * \pre \a m must be locked by the calling thread.
+	 * The mutex is released while waiting and locked again
+	 * before returning.
+	 */
+	void wait(Mutex& m);
+
+	/** \brief Wake up one waiting thread. */
+	void signal();
+
+	/** \brief Wake up all the waiting threads. */
+	void broadcast();
+
+private:
+	Condition(const Condition&);            // forbidden
+	Condition& operator=(const Condition&); // forbidden
+
+	pthread_cond_t c;
+};
+
+/**
+ * \ingroup tools
+ * \brief Thread.
+ *
+ * Subclasses implement #run(). The thread is launched by #start()
+ * and must be joined with #join() before the object is deleted.
+ */
+class Thread {
+public:
+	/** \brief Create a thread (not started). */
+	Thread();
+
+	/** \brief Delete *this. */
+	virtual ~Thread();
+
+	/** \brief Launch #run() in a new thread. */
+	void start();
+
+	/** \brief Wait for the thread to terminate. */
+	void join();
+
+	/**
+	 * \brief Number of hardware threads available (at least 1).
+	 */
+	static int hardware_concurrency();
+
+protected:
+	/** \brief The code executed by the thread. */
+	virtual void run()=0;
+
+private:
+	Thread(const Thread&);            // forbidden
+	Thread& operator=(const Thread&); // forbidden
+
+	static void* entry(void* thread);
+
+	pthread_t t;
+	bool started;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline Lock::Lock(Mutex& m) : m(m) {
+	m.lock();
+}
+
+inline Lock::~Lock() {
+	m.unlock();
+}
+
+inline void Mutex::lock() {
+	pthread_mutex_lock(&m);
+}
+
+inline void Mutex::unlock() {
+	pthread_mutex_unlock(&m);
+}
+
+} // end namespace ibex
+
+#endif // __IBEX_THREAD_H__
@@ -37,6 +37,76 @@ void TestAffine2::test02() {
 
 }
 
+/* An expression of 6 variables among n, each term involves one or two of them */
+template<class T>
+static Affine2Main<T> sparse_expr(const IntervalVector& box) {
+	int n=box.size();
+	Affine2Main<T> x[6];
+	for (int i=0; i<6; i++)
+		x[i]=Affine2Main<T>(n,i*(n/6)+1,box[i*(n/6)]);
+
+	return x[0]*x[1] + sqr(x[2]) - 3.0*x[3] + x[4]*Interval(1,2) + (x[0]-x[2])*(x[1]+x[4]) + exp(x[5]) + x[5]/x[0];
+}
+
+void TestAffine2::test_sparse01() {
+	IntervalVector box(60,Interval(1,2));
+	box[10]=Interval(-0.5,0.1);
+	box[20]=Interval(3,3.01);
+
+	Affine2Main<AF_fAF2> fd=sparse_expr<AF_fAF2>(box);
+	Affine2Main<AF_fAF2_sparse> fs=sparse_expr<AF_fAF2_sparse>(box);
+
+	TEST_ASSERT(fs.size()==60);
+	for (int i=0; i<=60; i++)
+		TEST_ASSERT(fs.val(i)==fd.val(i));
+	// the dense form accumulates rounding errors on the null terms
+	TEST_ASSERT(fs.err()<=fd.err());
+	TEST_ASSERT(fs.err()>=fd.err()*(1-1e-10));
+
+	double _x[6] = { 1.5, -0.2, 3.005, 1.9, 1.3, 1.7 };
+	double f = _x[0]*_x[1] + _x[2]*_x[2] - 3.0*_x[3] + _x[4]*1.5 + (_x[0]-_x[2])*(_x[1]+_x[4]) + ::exp(_x[5]) + _x[5]/_x[0];
+	TEST_ASSERT(fs.itv().contains(f));
+}
+
+void TestAffine2::test_sparse02() {
+	typedef Affine2Main<AF_fAF2_sparse> Affine2s;
+
+	Affine2s x(100,50,Interval(1,3));
+	Affine2s y(100,7,Interval(-1,1));
+
+	// aliasing
+	Affine2s z(x);
+	z+=z;
+	TEST_ASSERT(z.val(0)==4 && z.val(50)==2 && z.val(7)==0);
+	z=x;
+	z*=z;
+	TEST_ASSERT(almost_eq(z.itv(),(sqr(x)).itv(),1e-10));
+
+	// null terms are not kept
+	z=x-x;
+	TEST_ASSERT(z.val(50)==0);
+	TEST_ASSERT(z.itv()==Interval::ZERO);
+
+	z=-y;
+	TEST_ASSERT(z.val(7)==-1);
+
+	// forms of different sizes are added as intervals
+	z=x+Affine2s(10,1,Interval(0,1));
+	TEST_ASSERT(z.val(50)==1);
+	TEST_ASSERT(z.val(1)==0);
+
+	// particular cases
+	z=Affine2s(Interval::POS_REALS);
+	TEST_ASSERT(z.is_unbounded());
+	TEST_ASSERT((z+x).itv()==Interval(1,POS_INFINITY));
+	z=x*Interval::EMPTY_SET;
+	TEST_ASSERT(z.is_empty());
+	z=x*Interval::ALL_REALS;
+	TEST_ASSERT(z.itv()==Interval::ALL_REALS);
+	z=x*0.0;
+	TEST_ASSERT(z.itv()==Interval::ZERO);
+}
+
 void TestAffine2::test_pow2() {
 	Variable x;
 	Interval itv;
@@ -36,6 +36,9 @@ public:
 		TEST_ADD(TestAffine2::test_sinh);
 		TEST_ADD(TestAffine2::test_tanh);
 
+		TEST_ADD(TestAffine2::test_sparse01);
+		TEST_ADD(TestAffine2::test_sparse02);
+
 
 
 	}
@@ -69,6 +72,10 @@ public:
 	void test_tanh();
 
 
+	// test: AF_fAF2_sparse gives the same forms as AF_fAF2
+	void test_sparse01();
+	void test_sparse02();
+
 	void test01();
 	void test02();
 
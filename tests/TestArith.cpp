@@ -13,6 +13,7 @@
 #include "ibex_Linear.h"
 #include "utils.h"
 #include <float.h>
+#include <fenv.h>
 
 using namespace std;
 
@@ -779,3 +780,37 @@ void TestArith::bwd_sub04() {
 void TestArith::bwd_sub05() {
 	TEST_ASSERT(checkbwd_sub(Interval(-1,1),Interval(1,2),Interval(-10,5),Interval(1,2),Interval(0,3)));
 }
+
+void TestArith::rounding01() {
+	Interval x=Interval(1)/Interval(3);
+	TEST_ASSERT(x.ub()==next_float(x.lb()));
+	TEST_ASSERT((3*x).contains(1));
+	TEST_ASSERT((Interval(-1)/Interval(3))==-x);
+}
+
+void TestArith::rounding02() {
+	Interval x=Interval(0.1)*Interval(0.1);
+	TEST_ASSERT(x.ub()==next_float(x.lb()));
+	TEST_ASSERT(x.contains(0.1*0.1));
+	TEST_ASSERT(sqr(Interval(0.1))==x);
+	TEST_ASSERT((Interval(0.1)+Interval(0.2)).diam()>0);
+}
+
+void TestArith::rounding03() {
+	Interval e=exp(Interval(1));
+	TEST_ASSERT(e.contains(2.718281828459045));
+	TEST_ASSERT(e.diam()<1e-14);
+	TEST_ASSERT(log(e).contains(1));
+	TEST_ASSERT(sin(Interval::PI).contains(0));
+	TEST_ASSERT(cos(Interval::PI).contains(-1));
+	TEST_ASSERT(sqr(sqrt(Interval(2))).contains(2));
+}
+
+void TestArith::rounding04() {
+	int mode=fegetround();
+	Interval x=Interval(1)/Interval(3);
+	x=sqr(x*Interval(0.1)+x)-x;
+	x=exp(x)+cos(x);
+	TEST_ASSERT(x.diam()>0);
+	TEST_ASSERT(fegetround()==mode);
+}
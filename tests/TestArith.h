@@ -270,6 +270,11 @@ public:
 		TEST_ADD(TestArith::bwd_sub03);
 		TEST_ADD(TestArith::bwd_sub04);
 		TEST_ADD(TestArith::bwd_sub05);
+
+		TEST_ADD(TestArith::rounding01);
+		TEST_ADD(TestArith::rounding02);
+		TEST_ADD(TestArith::rounding03);
+		TEST_ADD(TestArith::rounding04);
 	}
 private:
 
@@ -567,6 +572,13 @@ private:
 	void bwd_sub04();
 	void bwd_sub05();
 
+	/* test: outward rounding (valid for all the arithmetics) */
+	void rounding01();
+	void rounding02();
+	void rounding03();
+	/* test: the rounding mode of the caller is unchanged */
+	void rounding04();
+
 	void check_add_scal(const Interval& x, double z, const Interval& y_expected);
 	void check_add(const Interval& x, const Interval& z, const Interval& y_expected);
 	void check_mul_scal(const Interval& x, double z, const Interval& y_expected);
@@ -0,0 +1,139 @@
+/* ============================================================================
+ * I B E X - Cell Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : IBEX contributors
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestCell.h"
+#include "ibex_Cell.h"
+#include "ibex_OptimCell.h"
+#include "ibex_Bsc.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+// a counter incremented at each bisection
+class Depth : public Backtrackable {
+public:
+	Depth() : depth(0) { }
+
+	Depth(int d) : depth(d) { }
+
+	pair<Backtrackable*,Backtrackable*> down() {
+		return pair<Backtrackable*,Backtrackable*>(new Depth(depth+1),new Depth(depth+1));
+	}
+
+	int depth;
+};
+
+// another data class
+class Mark : public Backtrackable {
+public:
+	Mark() : mark(0) { }
+
+	Mark(int m) : mark(m) { }
+
+	pair<Backtrackable*,Backtrackable*> down() {
+		return pair<Backtrackable*,Backtrackable*>(new Mark(mark),new Mark(-mark));
+	}
+
+	int mark;
+};
+
+}
+
+void TestCell::slot01() {
+	int s1=Cell::slot<Depth>();
+	int s2=Cell::slot<Mark>();
+	int s3=Cell::slot<BisectedVar>();
+	TEST_ASSERT(s1!=s2 && s2!=s3 && s1!=s3);
+	TEST_ASSERT(Cell::slot<Depth>()==s1);
+	TEST_ASSERT(Cell::slot<Mark>()==s2);
+}
+
+void TestCell::data01() {
+	Cell* root=new Cell(IntervalVector(2,Interval(0,1)));
+	root->add<Depth>();
+	root->add<Mark>();
+	root->get<Mark>().mark=7;
+	// adding data twice has no effect
+	root->add<Mark>();
+	TEST_ASSERT(root->get<Mark>().mark==7);
+	TEST_ASSERT(root->get<Depth>().depth==0);
+
+	pair<IntervalVector,IntervalVector> boxes=root->box.bisect(0);
+	pair<Cell*,Cell*> p=root->bisect(boxes.first,boxes.second);
+	delete root;
+	TEST_ASSERT(p.first->get<Depth>().depth==1);
+	TEST_ASSERT(p.second->get<Depth>().depth==1);
+	TEST_ASSERT(p.first->get<Mark>().mark==7);
+	TEST_ASSERT(p.second->get<Mark>().mark==-7);
+
+	boxes=p.second->box.bisect(1);
+	pair<Cell*,Cell*> p2=p.second->bisect(boxes.first,boxes.second);
+	TEST_ASSERT(p2.first->get<Depth>().depth==2);
+	TEST_ASSERT(p2.second->get<Mark>().mark==7);
+
+	const Cell& c=*p2.first;
+	TEST_ASSERT(c.get<Depth>().depth==2);
+
+	delete p.first;
+	delete p.second;
+	delete p2.first;
+	delete p2.second;
+}
+
+void TestCell::data02() {
+	Cell* root=new Cell(IntervalVector(2,Interval(0,1)));
+	root->add<Mark>();
+	pair<IntervalVector,IntervalVector> boxes=root->box.bisect(0);
+	pair<Cell*,Cell*> p=root->bisect(boxes.first,boxes.second);
+	delete root;
+
+	// new data in a subcell only
+	p.first->add<Depth>();
+	p.first->add<BisectedVar>();
+	p.first->get<Depth>().depth=5;
+	TEST_ASSERT(p.first->get<Mark>().mark==0);
+	TEST_ASSERT(p.first->get<Depth>().depth==5);
+	TEST_ASSERT(p.first->get<BisectedVar>().var==-1);
+
+	delete p.first;
+	delete p.second;
+}
+
+void TestCell::optim01() {
+	OptimCell* root=new OptimCell(IntervalVector(2,Interval(0,1)));
+	root->add<Depth>();
+	pair<IntervalVector,IntervalVector> boxes=root->box.bisect(0);
+	pair<OptimCell*,OptimCell*> p=root->bisect(boxes.first,boxes.second);
+	delete root;
+	TEST_ASSERT(p.first->get<Depth>().depth==1);
+	TEST_ASSERT(p.second->get<Depth>().depth==1);
+	TEST_ASSERT(p.first->box==boxes.first);
+	delete p.first;
+	delete p.second;
+}
+
+void TestCell::box01() {
+	double _box[][2]={{0,1},{2,3}};
+	IntervalVector box(2,_box);
+	Cell* c=new Cell(box);
+	TEST_ASSERT(c->box==box);
+	c->box.resize(4);
+	c->box[3]=Interval(4,5);
+	TEST_ASSERT(c->box.subvector(0,1)==box);
+	c->box.resize(1);
+	TEST_ASSERT(c->box[0]==box[0]);
+	delete c;
+}
+
+} // end namespace ibex
@@ -0,0 +1,45 @@
+/* ============================================================================
+ * I B E X - Cell Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : IBEX contributors
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_CELL_H__
+#define __TEST_CELL_H__
+
+#include "cpptest.h"
+#include "utils.h"
+
+namespace ibex {
+
+class TestCell : public TestIbex {
+
+public:
+	TestCell() {
+		TEST_ADD(TestCell::slot01);
+		TEST_ADD(TestCell::data01);
+		TEST_ADD(TestCell::data02);
+		TEST_ADD(TestCell::optim01);
+		TEST_ADD(TestCell::box01);
+	}
+
+	// one slot per class of data
+	void slot01();
+	// data inherited by subcells
+	void data01();
+	// data added to a cell with less slots
+	void data02();
+	// data of optimizer cells
+	void optim01();
+	// box of a cell resized
+	void box01();
+};
+
+} // end namespace ibex
+
+#endif // __TEST_CELL_H__
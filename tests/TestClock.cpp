@@ -0,0 +1,122 @@
+/* ============================================================================
+ * I B E X - Clock Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : IBEX contributors
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestClock.h"
+#include "ibex_Clock.h"
+#include "ibex_Thread.h"
+
+#include <unistd.h>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+// consume CPU during t seconds (real time)
+void busy(double t) {
+	double t0=Clock::now(Clock::REAL);
+	while (Clock::now(Clock::REAL)-t0<t) { }
+}
+
+class ClockThread : public Thread {
+public:
+	ClockThread(bool sleeping) : sleeping(sleeping), cpu(Clock::THREAD_CPU) { }
+
+	void run() {
+		cpu.start();
+		if (sleeping) usleep(50000);
+		else busy(0.05);
+		cpu.stop();
+	}
+
+	bool sleeping;
+	Clock cpu;
+};
+
+}
+
+void TestClock::clock01() {
+	Clock c(Clock::REAL);
+	TEST_ASSERT(!c.running());
+	TEST_ASSERT(c.elapsed()==0);
+
+	c.start();
+	TEST_ASSERT(c.running());
+	busy(0.01);
+	c.stop();
+	double t=c.elapsed();
+	TEST_ASSERT(t>=0.01);
+
+	// stopped: the time does not change
+	busy(0.01);
+	TEST_ASSERT(c.elapsed()==t);
+
+	// resumed: the time is accumulated
+	c.start();
+	busy(0.01);
+	TEST_ASSERT(c.elapsed()>=t+0.01);
+
+	c.reset();
+	TEST_ASSERT(!c.running());
+	TEST_ASSERT(c.elapsed()==0);
+}
+
+void TestClock::clock02() {
+	Clock c(Clock::REAL);
+	c.start();
+
+	TEST_ASSERT(!c.expired(-1));
+	TEST_ASSERT(!c.expired(10));
+
+	// the clock is not read at each call but the limit is eventually detected
+	while (!c.expired(0.02)) { }
+	TEST_ASSERT(c.elapsed()>=0.02);
+
+	bool timeout=false;
+	try {
+		for (;;) c.check(0.02);
+	} catch(TimeOutException&) {
+		timeout=true;
+	}
+	TEST_ASSERT(timeout);
+
+	// independent clocks
+	Clock c2(Clock::REAL);
+	c2.start();
+	TEST_ASSERT(!c2.expired(10));
+	TEST_ASSERT(c2.elapsed()<c.elapsed());
+}
+
+void TestClock::clock03() {
+	// calls of about 10 microseconds
+	Clock c(Clock::THREAD_CPU);
+	c.start();
+	while (!c.expired(0.02)) busy(1e-5);
+	TEST_ASSERT(c.elapsed()>=0.02);
+	// the clock is read at the limit (plus a few calls) if the calls
+	// take the same time; the margin absorbs the scheduling noise
+	TEST_ASSERT(c.elapsed()<0.02+10*1e-5+5e-3);
+}
+
+void TestClock::threads01() {
+	ClockThread t1(true);
+	ClockThread t2(false);
+	t1.start();
+	t2.start();
+	t1.join();
+	t2.join();
+	// the CPU time of a thread does not include the time of the other
+	TEST_ASSERT(t1.cpu.elapsed()<0.02);
+	TEST_ASSERT(t2.cpu.elapsed()>t1.cpu.elapsed());
+}
+
+} // end namespace ibex
@@ -0,0 +1,42 @@
+/* ============================================================================
+ * I B E X - Clock Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : IBEX contributors
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_CLOCK_H__
+#define __TEST_CLOCK_H__
+
+#include "cpptest.h"
+#include "utils.h"
+
+namespace ibex {
+
+class TestClock : public TestIbex {
+
+public:
+	TestClock() {
+		TEST_ADD(TestClock::clock01);
+		TEST_ADD(TestClock::clock02);
+		TEST_ADD(TestClock::clock03);
+		TEST_ADD(TestClock::threads01);
+	}
+
+	// start, stop and reset
+	void clock01();
+	// time limit
+	void clock02();
+	// time limit exceeded by less than one millisecond
+	void clock03();
+	// CPU time of threads
+	void threads01();
+};
+
+} // end namespace ibex
+
+#endif // __TEST_CLOCK_H__
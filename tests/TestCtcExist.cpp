@@ -54,4 +54,49 @@ void TestCtcExist::test01() {
 
 }
 
+void TestCtcExist::paving01() {
+
+	Variable x,y;
+	Function f(x,y,1.5*sqr(x)+1.5*sqr(y)-x*y-0.2);
+
+	double prec=1e-05;
+
+	NumConstraint c(f,LEQ);
+	CtcExist exist_y(c,y,IntervalVector(1,Interval(-10,10)),prec);
+
+	double right_bound=+0.3872983346072957;
+
+	// nested boxes (the paving is reused), then a box
+	// that is not included in the previous ones (the paving
+	// is calculated again).
+	double bounds[][2] = { {-10,10}, {0,10}, {0.2,0.3}, {0.39,1}, {-1,0.1} };
+
+	for (int k=0; k<5; k++) {
+		IntervalVector box(1,Interval(bounds[k][0],bounds[k][1]));
+
+		bool empty=false;
+		try {
+			exist_y.contract(box);
+		} catch(EmptyBoxException&) {
+			empty=true;
+		}
+
+		TEST_ASSERT(empty==(k==3));
+		if (!empty) {
+			// the projection is [-right_bound,right_bound]
+			TEST_ASSERT((Interval(bounds[k][0],bounds[k][1]) & Interval(-right_bound,right_bound)).is_subset(box[0]));
+			TEST_ASSERT(box[0].is_subset(Interval(bounds[k][0],bounds[k][1])));
+		}
+	}
+
+	// the paving is calculated again with a new parameter box
+	exist_y.y_init=IntervalVector(1,Interval(0.5,1));
+	IntervalVector box(1,Interval(-10,10));
+	IntervalVector box2(box);
+	exist_y.contract(box);
+	CtcExist exist_y2(c,y,IntervalVector(1,Interval(0.5,1)),prec);
+	exist_y2.contract(box2);
+	TEST_ASSERT(box==box2);
+}
+
 } // end namespace
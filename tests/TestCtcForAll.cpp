@@ -60,4 +60,36 @@ void TestCtcForAll::test01() {
 
 }
 
+void TestCtcForAll::paving01() {
+
+	Variable x,y;
+	Function f(x,y,1.5*sqr(x)+1.5*sqr(y)-x*y-0.2);
+
+	double prec=1e-03;
+
+	NumConstraint c(f,LEQ);
+	CtcForAll forall_y(c, y, IntervalVector(1,Interval(-0.01,0.01)), prec);
+
+	// the samples are reused: same result as from scratch
+	double bounds[][2] = { {-10,10}, {0,10}, {0.2,0.3}, {-1,0.1} };
+
+	for (int k=0; k<4; k++) {
+		IntervalVector box(1,Interval(bounds[k][0],bounds[k][1]));
+		IntervalVector box2(box);
+		forall_y.contract(box);
+		CtcForAll forall_y2(c, y, IntervalVector(1,Interval(-0.01,0.01)), prec);
+		forall_y2.contract(box2);
+		TEST_ASSERT(box==box2);
+	}
+
+	// the samples are calculated again with a new parameter box
+	forall_y.y_init=IntervalVector(1,Interval(-0.1,0.1));
+	IntervalVector box(1,Interval(-10,10));
+	IntervalVector box2(box);
+	forall_y.contract(box);
+	CtcForAll forall_y2(c, y, IntervalVector(1,Interval(-0.1,0.1)), prec);
+	forall_y2.contract(box2);
+	TEST_ASSERT(box==box2);
+}
+
 } // end namespace
@@ -23,9 +23,11 @@ public:
 	TestCtcForAll() {
 
 		TEST_ADD(TestCtcForAll::test01);
+		TEST_ADD(TestCtcForAll::paving01);
 	}
 
 	void test01();
+	void paving01();
 };
 
 } // namespace ibex
@@ -9,6 +9,9 @@
 
 #include "TestCtcFwdBwd.h"
 #include "ibex_CtcFwdBwd.h"
+#include "ibex_CtcHC4.h"
+#include "ibex_CtcFixPoint.h"
+#include "ibex_CtcCompo.h"
 
 namespace ibex {
 
@@ -23,4 +26,118 @@ void TestCtcFwdBwd::sqrt_issue28() {
 	TEST_THROWS_ANYTHING(ctc.contract(box)); // should raise EmptyBoxException
 }
 
+void TestCtcFwdBwd::try_contract01() {
+	Variable x;
+	Function f(x,sqrt(x));
+	NumConstraint c(f);
+
+	CtcFwdBwd ctc(c);
+
+	IntervalVector box(1,Interval(-2,-1));
+	TEST_ASSERT(!ctc.try_contract(box)); // no exception
+	TEST_ASSERT(box.is_empty());
+}
+
+void TestCtcFwdBwd::try_contract02() {
+	Variable x,y;
+	Function f(x,y,x+y);
+	NumConstraint c(f,EQ);
+
+	CtcFwdBwd ctc(c);
+
+	double _box[][2]={{0,1},{-2,0}};
+	IntervalVector box(2,_box);
+	TEST_ASSERT(ctc.try_contract(box));
+	TEST_ASSERT(box[0]==Interval(0,1));
+	TEST_ASSERT(box[1]==Interval(-1,0));
+
+	// an empty box in a propagation loop
+	double _box2[][2]={{2,3},{-1,0}};
+	IntervalVector box2(2,_box2);
+	Array<NumConstraint> ctrs(c);
+	CtcHC4 hc4(ctrs);
+	TEST_ASSERT(!hc4.try_contract(box2));
+	TEST_ASSERT(box2.is_empty());
+}
+
+namespace {
+
+/* a subclass that redefines the contraction */
+class CountFwdBwd : public CtcFwdBwd {
+public:
+	CountFwdBwd(const NumConstraint& ctr) : CtcFwdBwd(ctr), count(0) { }
+
+	bool try_contract(IntervalVector& box) {
+		if (!CtcFwdBwd::try_contract(box)) return false;
+		count++;
+		return true;
+	}
+
+	int count;
+};
+
+/* a subclass of a propagation loop */
+class CountHC4 : public CtcHC4 {
+public:
+	CountHC4(const Array<NumConstraint>& ctrs) : CtcHC4(ctrs), count(0) { }
+
+	bool try_contract(IntervalVector& box) {
+		count++;
+		return CtcHC4::try_contract(box);
+	}
+
+	int count;
+};
+
+}
+
+void TestCtcFwdBwd::try_contract03() {
+	Variable x,y;
+	NumConstraint c1(x,y,x+y=0);
+	NumConstraint c2(x,y,x-y=0);
+	CountFwdBwd ctc1(c1);
+	CountFwdBwd ctc2(c2);
+
+	double _box[][2]={{0,1},{-2,0}};
+	IntervalVector box(2,_box);
+	TEST_ASSERT(ctc1.try_contract(box));
+	TEST_ASSERT(ctc1.count==1);
+	ctc1.contract(box);
+	TEST_ASSERT(ctc1.count==2);
+
+	Array<Ctc> list(ctc1,ctc2);
+	CtcPropag propag(list);
+	box=IntervalVector(2,_box);
+	TEST_ASSERT(propag.try_contract(box));
+	TEST_ASSERT(ctc1.count>1);
+	TEST_ASSERT(ctc2.count>0);
+
+	int count1=ctc1.count;
+	CtcFixPoint fixpoint(ctc1);
+	box=IntervalVector(2,_box);
+	TEST_ASSERT(fixpoint.try_contract(box));
+	TEST_ASSERT(ctc1.count>count1);
+
+	// the count is not incremented when the box is empty
+	count1=ctc1.count;
+	int count2=ctc2.count;
+	double _box2[][2]={{1,2},{-3,-1}};
+	IntervalVector box2(2,_box2);
+	CtcCompo compo(ctc1,ctc2);
+	TEST_ASSERT(!compo.try_contract(box2));
+	TEST_ASSERT(box2.is_empty());
+	TEST_ASSERT(ctc1.count==count1+1);
+	TEST_ASSERT(ctc2.count==count2);
+
+	Array<NumConstraint> ctrs(c1,c2);
+	CountHC4 hc4(ctrs);
+	CtcFixPoint fixpoint2(hc4);
+	box2=IntervalVector(2,_box2);
+	TEST_ASSERT(!fixpoint2.try_contract(box2));
+	TEST_ASSERT(hc4.count==1);
+	box=IntervalVector(2,_box);
+	TEST_ASSERT(fixpoint2.try_contract(box));
+	TEST_ASSERT(hc4.count>1);
+}
+
 } // namespace ibex
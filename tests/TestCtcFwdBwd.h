@@ -21,9 +21,15 @@ public:
 
 	TestCtcFwdBwd() {
 		TEST_ADD(TestCtcFwdBwd::sqrt_issue28);
+		TEST_ADD(TestCtcFwdBwd::try_contract01);
+		TEST_ADD(TestCtcFwdBwd::try_contract02);
+		TEST_ADD(TestCtcFwdBwd::try_contract03);
 	}
 
 	void sqrt_issue28();
+	void try_contract01();
+	void try_contract02();
+	void try_contract03();
 };
 
 } // namespace ibex
@@ -44,6 +44,92 @@ void TestCtcPolytopeHull::lp01() {
 }
 
 
+/*
+ * The same contractor is applied on a sequence of boxes
+ * (the linear solver starts from the basis of the previous LP):
+ * the results must be the same as with a new contractor.
+ */
+void TestCtcPolytopeHull::lp02() {
+	double _A[6]= {1,1,1,-1,-1,2};
+	Matrix A(3,2,_A);
+	double _b[3]= {1,0,2};
+	Vector b(3,_b);
+
+	CtcPolytopeHull ctc(A,b);
+
+	double _boxes[][2][2] = {
+			{{-1,1},{-1,1}},
+			{{-1,0.5},{-1,1}},
+			{{0,2},{-2,2}},
+			{{-1,1},{-1,1}},
+			{{-3,-1},{0,3}} };
+
+	for (int k=0; k<5; k++) {
+		IntervalVector box(2,_boxes[k]);
+		IntervalVector box2(box);
+
+		CtcPolytopeHull ctc2(A,b);
+
+		ctc.contract(box);
+		ctc2.contract(box2);
+		TEST_ASSERT(box==box2);
+	}
+}
+
+/*
+ * Same as lp02 with the LPs solved in parallel.
+ */
+void TestCtcPolytopeHull::lp03() {
+	double _A[6]= {1,1,1,-1,-1,2};
+	Matrix A(3,2,_A);
+	double _b[3]= {1,0,2};
+	Vector b(3,_b);
+
+	CtcPolytopeHull ctc(A,b);
+	ctc.set_nb_threads(3);
+
+	double _boxes[][2][2] = {
+			{{-1,1},{-1,1}},
+			{{-1,0.5},{-1,1}},
+			{{0,2},{-2,2}},
+			{{-1,1},{-1,1}},
+			{{-3,-1},{0,3}} };
+
+	for (int k=0; k<5; k++) {
+		IntervalVector box(2,_boxes[k]);
+		IntervalVector box2(box);
+
+		CtcPolytopeHull ctc2(A,b);
+
+		ctc.contract(box);
+		ctc2.contract(box2);
+		check(box,box2);
+	}
+}
+
+/*
+ * Infeasibility proved by the LPs solved in parallel.
+ */
+void TestCtcPolytopeHull::lp04() {
+	double _A[6]= {1,1,1,-1,-1,2};
+	Matrix A(3,2,_A);
+	double _b[3]= {1,0,2};
+	Vector b(3,_b);
+
+	CtcPolytopeHull ctc(A,b);
+	ctc.set_nb_threads(2);
+
+	IntervalVector box(2,Interval(2,3));
+	bool empty=false;
+	try {
+		ctc.contract(box);
+	} catch(EmptyBoxException&) {
+		empty=true;
+	}
+	TEST_ASSERT(empty);
+	TEST_ASSERT(box.is_empty());
+}
+
 void TestCtcPolytopeHull::fixbug01() {
 
 	SystemFactory f;
@@ -22,6 +22,9 @@ public:
 #ifndef _IBEX_WITH_NOLP_
 
 		TEST_ADD(TestCtcPolytopeHull::lp01);
+		TEST_ADD(TestCtcPolytopeHull::lp02);
+		TEST_ADD(TestCtcPolytopeHull::lp03);
+		TEST_ADD(TestCtcPolytopeHull::lp04);
 		TEST_ADD(TestCtcPolytopeHull::fixbug01);
 
 #endif //_IBEX_WITH_NOLP_
@@ -30,6 +33,12 @@ public:
 
 	void lp01();
 
+	void lp02();
+
+	void lp03();
+
+	void lp04();
+
 	void fixbug01();
 };
 
@@ -311,4 +311,43 @@ void TestEval::apply04() {
 	check(f3.eval_domain(_x3).i(), Interval(10,10));
 }
 
+void TestEval::check_batch(const Function& f, const IntervalMatrix& x) {
+	IntervalVector y(x.nb_cols());
+	f.eval_batch(x,y);
+	for (int k=0; k<x.nb_cols(); k++) {
+		Interval yk=f.eval(x.col(k));
+		TEST_ASSERT(y[k]==yk);
+	}
+}
+
+// scalar function (evaluated with the scalar tape)
+void TestEval::batch01() {
+	Function f("x","y","sqrt(x)+y*sin(x)-max(x,y)^2");
+
+	IntervalMatrix x(2,4);
+	x[0][0]=Interval(1,2);   x[1][0]=Interval(0,1);
+	x[0][1]=Interval(-2,-1); x[1][1]=Interval(0,1); // outside of the domain of sqrt
+	x[0][2]=Interval(-1,4);  x[1][2]=Interval(-3,3);
+	x[0][3]=Interval(3,3);   x[1][3]=Interval(2,2);
+
+	check_batch(f,x);
+
+	IntervalVector y(4);
+	f.eval_batch(x,y);
+	TEST_ASSERT(y[1].is_empty());
+	TEST_ASSERT(!y[2].is_empty());
+}
+
+// vector operations (evaluated box by box)
+void TestEval::batch02() {
+	Function f("x[2]","y","x*x+y");
+
+	IntervalMatrix x(3,3);
+	x[0][0]=Interval(1,2);   x[1][0]=Interval(0,1);  x[2][0]=Interval(0,1);
+	x[0][1]=Interval(-2,-1); x[1][1]=Interval(0,1);  x[2][1]=Interval(-1,1);
+	x[0][2]=Interval(-1,4);  x[1][2]=Interval(-3,3); x[2][2]=Interval(5,5);
+
+	check_batch(f,x);
+}
+
 }
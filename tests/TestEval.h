@@ -38,6 +38,9 @@ public:
 		TEST_ADD(TestEval::apply02);
 		TEST_ADD(TestEval::apply03);
 		TEST_ADD(TestEval::apply04);
+
+		TEST_ADD(TestEval::batch01);
+		TEST_ADD(TestEval::batch02);
 	}
 
 	void deco01();
@@ -57,7 +60,11 @@ public:
 	void apply03();
 	void apply04();
 
+	void batch01();
+	void batch02();
+
 private:
+	void check_batch(const Function& f, const IntervalMatrix& x);
 	void check_deco(const ExprNode& e);
 };
 
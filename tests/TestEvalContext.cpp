@@ -0,0 +1,179 @@
+/* ============================================================================
+ * I B E X - Evaluation context Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : IBEX contributors
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestEvalContext.h"
+#include "ibex_EvalContext.h"
+#include "ibex_HC4Revise.h"
+#include "ibex_EmptyBoxException.h"
+#include "ibex_Thread.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+// box number k of a sequence of boxes used by the threads
+IntervalVector test_box(int k) {
+	IntervalVector box(2);
+	box[0]=Interval(-1,1)+0.01*k;
+	box[1]=Interval(0,0.5)-0.02*k;
+	return box;
+}
+
+// a thread that evaluates f on a sequence of boxes
+class EvalThread : public Thread {
+public:
+	EvalThread(const Function& f, int nb) : c(f), nb(nb), y(nb), g(nb,IntervalVector(2)) { }
+
+	void run() {
+		for (int k=0; k<nb; k++) {
+			y[k]=c.f.eval(test_box(k),c);
+			c.f.gradient(test_box(k),g[k],c);
+		}
+	}
+
+	EvalContext c;
+	int nb;
+	vector<Interval> y;
+	vector<IntervalVector> g;
+};
+
+} // end anonymous namespace
+
+void TestEvalContext::eval01() {
+	Variable x,y;
+	Function f(x,y,x*y+sin(x)-sqr(y));
+	EvalContext c(f);
+
+	double _box[][2] = { {1,2}, {-3,4} };
+	IntervalVector box(2,_box);
+
+	TEST_ASSERT(f.eval(box,c)==f.eval(box));
+}
+
+void TestEvalContext::eval02() {
+	Variable x(3);
+	Function f(x,Return(x[0]*x[1],x[1]+x[2],exp(x[2])));
+	EvalContext c(f);
+
+	double _box[][2] = { {1,2}, {-3,4}, {0,1} };
+	IntervalVector box(3,_box);
+
+	TEST_ASSERT(f.eval_vector(box,c)==f.eval_vector(box));
+}
+
+void TestEvalContext::unused01() {
+	Variable x,y;
+	Function f(x,y,2*x);
+	EvalContext c(f);
+
+	double _box[][2] = { {1,2}, {-3,4} };
+	IntervalVector box(2,_box);
+
+	TEST_ASSERT(f.eval(box,c)==Interval(2,4));
+
+	IntervalVector g(2);
+	f.gradient(box,g,c);
+	TEST_ASSERT(g[0]==Interval(2,2));
+	TEST_ASSERT(g[1]==Interval::ZERO);
+}
+
+void TestEvalContext::untouched01() {
+	Variable x,y;
+	Function f(x,y,x+y);
+	EvalContext c(f);
+
+	double _box1[][2] = { {1,2}, {3,4} };
+	IntervalVector box1(2,_box1);
+	double _box2[][2] = { {0,0}, {0,1} };
+	IntervalVector box2(2,_box2);
+
+	f.eval(box1);
+	TEST_ASSERT(f.eval(box2,c)==Interval(0,1));
+	TEST_ASSERT(f.expr().deco.d->i()==Interval(4,6));
+}
+
+void TestEvalContext::grad01() {
+	Variable x,y;
+	Function f(x,y,x*y+sin(x)-sqr(y));
+	EvalContext c(f);
+
+	double _box[][2] = { {1,2}, {-3,4} };
+	IntervalVector box(2,_box);
+
+	IntervalVector g(2);
+	f.gradient(box,g,c);
+	TEST_ASSERT(g==f.gradient(box));
+}
+
+void TestEvalContext::proj01() {
+	Variable x,y;
+	Function f(x,y,sqr(x)+sqr(y));
+	EvalContext c(f);
+
+	double _box[][2] = { {-2,2}, {0.5,3} };
+	IntervalVector box(2,_box);
+	IntervalVector box2(box);
+
+	Domain d(Dim::scalar());
+	d.i()=Interval(0,1);
+
+	TEST_ASSERT(!HC4Revise().proj(f,d,box,c));
+	f.backward(d,box2);
+	TEST_ASSERT(box==box2);
+	TEST_ASSERT(almost_eq(box[1],Interval(0.5,1),ERROR));
+}
+
+void TestEvalContext::proj02() {
+	Variable x,y;
+	Function f(x,y,sqr(x)+sqr(y));
+	EvalContext c(f);
+
+	double _box[][2] = { {2,3}, {2,3} };
+	IntervalVector box(2,_box);
+
+	Domain d(Dim::scalar());
+	d.i()=Interval(0,1);
+
+	TEST_THROWS(f.backward(d,box,c),EmptyBoxException);
+}
+
+void TestEvalContext::threads01() {
+	Variable x,y;
+	Function f(x,y,x*exp(y)+sin(x*y)-sqr(y));
+
+	int nb=500;
+	vector<EvalThread*> threads;
+	for (int i=0; i<4; i++)
+		threads.push_back(new EvalThread(f,nb));
+
+	for (int i=0; i<4; i++)
+		threads[i]->start();
+	for (int i=0; i<4; i++)
+		threads[i]->join();
+
+	bool ok=true;
+	for (int k=0; k<nb; k++) {
+		Interval yk=f.eval(test_box(k));
+		IntervalVector gk=f.gradient(test_box(k));
+		for (int i=0; i<4; i++) {
+			ok &= threads[i]->y[k]==yk;
+			ok &= threads[i]->g[k]==gk;
+		}
+	}
+	TEST_ASSERT(ok);
+
+	for (int i=0; i<4; i++)
+		delete threads[i];
+}
+
+} // end namespace ibex
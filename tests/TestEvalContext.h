@@ -0,0 +1,49 @@
+/* ============================================================================
+ * I B E X - Evaluation context Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : IBEX contributors
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_EVAL_CONTEXT_H__
+#define __TEST_EVAL_CONTEXT_H__
+
+#include "cpptest.h"
+#include "utils.h"
+
+namespace ibex {
+
+class TestEvalContext : public TestIbex {
+
+public:
+	TestEvalContext() {
+		TEST_ADD(TestEvalContext::eval01);
+		TEST_ADD(TestEvalContext::eval02);
+		TEST_ADD(TestEvalContext::unused01);
+		TEST_ADD(TestEvalContext::untouched01);
+		TEST_ADD(TestEvalContext::grad01);
+		TEST_ADD(TestEvalContext::proj01);
+		TEST_ADD(TestEvalContext::proj02);
+		TEST_ADD(TestEvalContext::threads01);
+	}
+
+	void eval01();
+	void eval02();
+	// an argument that does not occur in the expression
+	void unused01();
+	// the decorations of the function are not modified
+	void untouched01();
+	void grad01();
+	void proj01();
+	// empty projection
+	void proj02();
+	// several threads evaluate the same function
+	void threads01();
+};
+
+} // namespace ibex
+#endif // __TEST_EVAL_CONTEXT_H__
@@ -11,6 +11,7 @@
 
 #include "TestExprCopy.h"
 #include "ibex_ExprCopy.h"
+#include "ibex_Function.h"
 
 using namespace std;
 
@@ -35,4 +36,59 @@ void TestExprCopy::index_copy01() {
 	TEST_ASSERT(c->get_value()==Interval(0,1));
 }
 
+void TestExprCopy::fold01() {
+	Variable x("x"),y("y");
+	Function f(x,y,(x*(Interval(2)-1)+Interval(0))/Interval(1)+sqr(Interval(3))*y);
+	Function g(f,Function::SIMPLIFY);
+
+	// x+9*y
+	TEST_ASSERT(sameExpr(g.expr(),"(x+(9*y))"));
+	TEST_ASSERT(g.nb_nodes()==5);
+
+	double _box[][2] = {{1,2},{3,4}};
+	IntervalVector box(2,_box);
+	TEST_ASSERT(g.eval(box)==f.eval(box));
+}
+
+void TestExprCopy::fold02() {
+	Variable x("x");
+	// x*1 and x are the same node in the copy
+	Function f(x,x*Interval(1)+x);
+	Function g(f,Function::SIMPLIFY);
+
+	TEST_ASSERT(sameExpr(g.expr(),"(x+x)"));
+	TEST_ASSERT(g.nb_nodes()==2);
+}
+
+void TestExprCopy::cse01() {
+	Variable x("x"),y("y");
+	Function f(x,y,sqr(x+y)+sin(x+y)*sqr(x+y));
+	TEST_ASSERT(f.nb_nodes()==10);
+
+	Function g(f,Function::SIMPLIFY);
+	// x+y and sqr(x+y) are shared
+	TEST_ASSERT(g.nb_nodes()==7);
+
+	double _box[][2] = {{1,2},{3,4}};
+	IntervalVector box(2,_box);
+	TEST_ASSERT(g.eval(box)==f.eval(box));
+	// the derivatives w.r.t. the shared nodes are accumulated first
+	TEST_ASSERT(g.gradient(box).is_subset(f.gradient(box)));
+}
+
+void TestExprCopy::cse02() {
+	Function f("x","y","(x+y)^2+(x+y)^2+(x-y)^2");
+	// x,y,x+y,(x+y)^2,x-y,(x-y)^2 and two additions
+	TEST_ASSERT(f.nb_nodes()==8);
+
+	// the derivatives of (x+y)^2 are shared too
+	Function df(f,Function::DIFF);
+	Function df2(df,Function::SIMPLIFY);
+	TEST_ASSERT(df2.nb_nodes()==df.nb_nodes());
+
+	double _box[][2] = {{1,2},{3,4}};
+	IntervalVector box(2,_box);
+	TEST_ASSERT(df.eval_vector(box)==f.gradient(box));
+}
+
 } // end namespace
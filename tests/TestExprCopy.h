@@ -23,11 +23,28 @@ public:
 	TestExprCopy() {
 
 		TEST_ADD(TestExprCopy::index_copy01);
+		TEST_ADD(TestExprCopy::fold01);
+		TEST_ADD(TestExprCopy::fold02);
+		TEST_ADD(TestExprCopy::cse01);
+		TEST_ADD(TestExprCopy::cse02);
 	}
 
 	// case where the vector is a constant vector
 	void index_copy01();
 
+	// constant folding and neutral elements
+	void fold01();
+
+	// the copy of a node which is simplified
+	// into one of its subnodes
+	void fold02();
+
+	// common subexpressions
+	void cse01();
+
+	// common subexpressions in a parsed function
+	void cse02();
+
 };
 
 } // namespace ibex
@@ -12,6 +12,7 @@
 #include "ibex_Function.h"
 #include "ibex_Expr.h"
 #include "ibex_Eval.h"
+#include "ibex_SparseJacobian.h"
 #include "Ponts30.h"
 
 using namespace std;
@@ -559,5 +560,69 @@ void TestGradient::hansen01() {
 
 };
 
+void TestGradient::check_sparse(const Function& f, const IntervalVector& box) {
+	SparseJacobian J(f);
+	f.jacobian(box,J);
+
+	IntervalMatrix D(f.image_dim(),f.nb_var());
+	f.jacobian(box,D);
+
+	for (int i=0; i<f.image_dim(); i++) {
+		IntervalVector g=f[i].gradient(box);
+		for (int j=0; j<f.nb_var(); j++) {
+			TEST_ASSERT(almost_eq(J(i,j),g[j],1e-12));
+			TEST_ASSERT(almost_eq(D[i][j],g[j],1e-12));
+		}
+		// two variables of the same row have different colors
+		for (int k=J.row_begin(i); k<J.row_begin(i+1); k++)
+			for (int k2=k+1; k2<J.row_begin(i+1); k2++)
+				TEST_ASSERT(J.color(J.col(k))!=J.color(J.col(k2)));
+	}
+}
+
+// Broyden tridiagonal function (scalar components)
+void TestGradient::sparse01() {
+	int n=6;
+	const ExprSymbol& x=ExprSymbol::new_("x",Dim::col_vec(n));
+	Array<const ExprNode> c(n);
+	for (int i=0; i<n; i++) {
+		const ExprNode* e=&((3-2*x[i])*x[i]+1);
+		if (i>0) e=&(*e-x[i-1]);
+		if (i<n-1) e=&(*e-2*x[i+1]);
+		c.set_ref(i,*e);
+	}
+	Function f(x,ExprVector::new_(c,false));
+
+	SparseJacobian J(f);
+	TEST_ASSERT(J.nnz()==3*n-2);
+	TEST_ASSERT(J.nb_colors()==3);
+	TEST_ASSERT(J.row_begin(1)==2);
+	TEST_ASSERT(J.col(2)==0 && J.col(3)==1 && J.col(4)==2);
+
+	IntervalVector box(n,Interval(1,2));
+	box[2]=Interval(-1,0.5);
+	check_sparse(f,box);
+
+	f.jacobian(box,J);
+	TEST_ASSERT(J(0,3)==Interval::ZERO);
+	TEST_ASSERT(almost_eq(J(2,1),Interval(-1,-1),1e-12));
+	TEST_ASSERT(almost_eq(J(2,3),Interval(-2,-2),1e-12));
+}
+
+// components with vector operations (no single sweep)
+void TestGradient::sparse02() {
+	const ExprSymbol& x=ExprSymbol::new_("x",Dim::col_vec(3));
+	const ExprSymbol& y=ExprSymbol::new_("y");
+	Function f(x,y,ExprVector::new_(x*x,sin(y)*x[1],false));
+
+	SparseJacobian J(f);
+	TEST_ASSERT(J.nnz()==5);
+	TEST_ASSERT(J.nb_colors()==3); // y shares the color of x[0]
+
+	IntervalVector box(4,Interval(1,2));
+	box[1]=Interval(-1,0.5);
+	check_sparse(f,box);
+}
+
 } // end namespace
 
@@ -39,6 +39,8 @@ public:
 		TEST_ADD(TestGradient::mulMV01);
 		TEST_ADD(TestGradient::mulVM01);
 		TEST_ADD(TestGradient::mulVM02);
+		TEST_ADD(TestGradient::sparse01);
+		TEST_ADD(TestGradient::sparse02);
 	}
 
 	void deco01();
@@ -60,7 +62,12 @@ public:
 	void mulMV01();
 	void mulVM01();
 	void mulVM02();
+
+	// sparse Jacobian
+	void sparse01();
+	void sparse02();
 private:
+	void check_sparse(const Function& f, const IntervalVector& box);
 	void check_deco(const ExprNode& e);
 };
 
@@ -14,6 +14,7 @@
 #include "ibex_Expr.h"
 #include "ibex_NumConstraint.h"
 #include "ibex_HC4Revise.h"
+#include "ibex_EvalContext.h"
 
 using namespace std;
 
@@ -130,5 +131,169 @@ void TestHC4Revise::dist02() {
 	check(box, boxR);
 }
 
-} // end namespace
+void TestHC4Revise::tape01() {
+	Variable x(2);
+	// x[0] occurs twice (two different nodes)
+	Function f(x,x[0]+x[1]+x[0]);
+	TEST_ASSERT(f.cf.scalar_tape()!=NULL);
+
+	Domain y(Dim::scalar());
+	y.i()=Interval::ZERO;
+	double _box[][2]={{1,2},{-10,10}};
+	IntervalVector box(2,_box);
+	TEST_ASSERT(!HC4Revise(INTERVAL_MODE,true).proj(f,y,box));
+	TEST_ASSERT(box[0]==Interval(1,2));
+	TEST_ASSERT(box[1]==Interval(-4,-2));
+
+	// same result with a context
+	IntervalVector box2(2,_box);
+	EvalContext c(f);
+	HC4Revise(INTERVAL_MODE,true).proj(f,y,box2,c);
+	TEST_ASSERT(box2==box);
+}
 
+void TestHC4Revise::tape02() {
+	Variable x(2);
+	// vector operation: no tape
+	Function f(x,x*x);
+	TEST_ASSERT(f.cf.scalar_tape()==NULL);
+
+	Domain y(Dim::scalar());
+	y.i()=Interval(0,1);
+	IntervalVector box(2,Interval(1,2));
+	TEST_ASSERT(!HC4Revise(INTERVAL_MODE,true).try_proj(f,y,box));
+	TEST_ASSERT(box.is_empty());
+}
+
+void TestHC4Revise::tape03() {
+	Variable x,y;
+	Function f(x,y,sqrt(x)+y);
+	TEST_ASSERT(f.cf.scalar_tape()!=NULL);
+
+	Domain z(Dim::scalar());
+	z.i()=Interval::ZERO;
+	IntervalVector box(2,Interval(-2,-1));
+	TEST_ASSERT(!HC4Revise(INTERVAL_MODE,true).try_proj(f,z,box));
+	TEST_ASSERT(box.is_empty());
+}
+
+void TestHC4Revise::tape04() {
+	Variable x(2);
+	Function f(x,x[0]*x[1]+x[0]);
+	TEST_ASSERT(f.cf.scalar_tape()!=NULL);
+
+	Domain y(Dim::scalar());
+	y.i()=Interval(0,1);
+	double _box[][2]={{1,2},{-10,10}};
+	IntervalVector box(2,_box);
+	IntervalVector box2(box);
+	HC4Revise(INTERVAL_MODE,true).proj(f,y,box2);
+
+	// by default, the labels are updated (and the result is the same)
+	f.backward(y,box);
+	TEST_ASSERT(box==box2);
+	TEST_ASSERT(f.expr().deco.d->i()==Interval(0,1));
+	IntervalVector box3(2);
+	f.read_arg_domains(box3);
+	TEST_ASSERT(box3==box);
+}
+
+void TestHC4Revise::incremental01() {
+	Variable x(4);
+	Function f(x,sqr(x[0])*x[1]+exp(x[2])-x[0]*x[3]+sin(x[1]+x[2]));
+	TEST_ASSERT(f.cf.scalar_tape()!=NULL);
+
+	Domain y(Dim::scalar());
+	y.i()=Interval(0,1);
+
+	HC4Revise inc(INTERVAL_MODE,true);
+	HC4Revise full(INTERVAL_MODE,true,false);
+
+	IntervalVector box(4,Interval(-2,2));
+	srand(1);
+	for (int k=0; k<100; k++) {
+		// change one or two variables, sometimes enlarge them
+		IntervalVector box2(box);
+		for (int j=rand()%2; j<2; j++) {
+			int v=rand()%4;
+			double a=-2+4.0*rand()/RAND_MAX;
+			double b=-2+4.0*rand()/RAND_MAX;
+			box2[v]=Interval(a<b? a : b, a<b? b : a);
+		}
+		IntervalVector box3(box2);
+		bool inactive=inc.try_proj(f,y,box2);
+		TEST_ASSERT(full.try_proj(f,y,box3)==inactive);
+		TEST_ASSERT(box2==box3);
+		if (!box2.is_empty()) box=box2;
+	}
+}
+
+void TestHC4Revise::incremental02() {
+	Variable x,y;
+	Function f(x,y,sqrt(x)+y);
+
+	Domain z(Dim::scalar());
+	z.i()=Interval::ZERO;
+
+	// the forward evaluation is empty
+	IntervalVector box(2,Interval(-2,-1));
+	TEST_ASSERT(!HC4Revise(INTERVAL_MODE,true).try_proj(f,z,box));
+	TEST_ASSERT(box.is_empty());
+
+	// all the nodes are evaluated again
+	box[0]=Interval(1,4);
+	box[1]=Interval(-10,10);
+	IntervalVector box2(box);
+	TEST_ASSERT(!HC4Revise(INTERVAL_MODE,true).try_proj(f,z,box));
+	TEST_ASSERT(!HC4Revise(INTERVAL_MODE,true,false).try_proj(f,z,box2));
+	TEST_ASSERT(box==box2);
+	TEST_ASSERT(box[0]==Interval(1,4));
+	TEST_ASSERT(almost_eq(box[1],Interval(-2,-1),ERROR));
+
+	// x has not changed
+	box[1]=box2[1]=Interval(-1.5,10);
+	TEST_ASSERT(!HC4Revise(INTERVAL_MODE,true).try_proj(f,z,box));
+	TEST_ASSERT(!HC4Revise(INTERVAL_MODE,true,false).try_proj(f,z,box2));
+	TEST_ASSERT(box==box2);
+	TEST_ASSERT(box[0]==Interval(1,2.25));
+	TEST_ASSERT(almost_eq(box[1],Interval(-1.5,-1),ERROR));
+}
+
+void TestHC4Revise::incremental03() {
+	Variable x,z;
+	Domain y(Dim::scalar());
+	y.i()=Interval(0,10);
+
+	// the domain of sqrt(x) is not contracted but x is.
+	Function f(x,z,sqrt(x)+z);
+	IntervalVector box(2);
+	box[0]=Interval(-1,4);
+	box[1]=Interval(-20,20);
+	IntervalVector box2(box);
+	HC4Revise(INTERVAL_MODE,true).try_proj(f,y,box);
+	HC4Revise(INTERVAL_MODE,true,false).try_proj(f,y,box2);
+	TEST_ASSERT(box==box2);
+	TEST_ASSERT(box[0]==Interval(0,4));
+
+	// same with the other partial functions
+	Function f1(x,z,log(x)+z);
+	Function f2(x,z,acos(x)+z);
+	Function f3(x,z,asin(x)+z);
+	Function f4(x,z,acosh(x)+z);
+	Function f5(x,z,atanh(x)+z);
+	Function* g[5] = { &f1, &f2, &f3, &f4, &f5 };
+	double lb[5] = { -1, -2, -2, 0, -2 };
+	double ub[5] = { 4, 0.5, 0.5, 4, 0.5 };
+
+	for (int i=0; i<5; i++) {
+		box[0]=Interval(lb[i],ub[i]);
+		box[1]=Interval(-20,20);
+		box2=box;
+		HC4Revise(INTERVAL_MODE,true).try_proj(*g[i],y,box);
+		HC4Revise(INTERVAL_MODE,true,false).try_proj(*g[i],y,box2);
+		TEST_ASSERT(box==box2);
+		TEST_ASSERT(box[0].lb()>lb[i]);
+	}
+}
+
+} // end namespace
@@ -30,6 +30,13 @@ public:
 		TEST_ADD(TestHC4Revise::min01);
 		TEST_ADD(TestHC4Revise::dist01);
 		TEST_ADD(TestHC4Revise::dist02);
+		TEST_ADD(TestHC4Revise::tape01);
+		TEST_ADD(TestHC4Revise::tape02);
+		TEST_ADD(TestHC4Revise::tape03);
+		TEST_ADD(TestHC4Revise::tape04);
+		TEST_ADD(TestHC4Revise::incremental01);
+		TEST_ADD(TestHC4Revise::incremental02);
+		TEST_ADD(TestHC4Revise::incremental03);
 	}
 	void id01();
 	void add01();
@@ -42,6 +49,16 @@ public:
 
 	void dist01();
 	void dist02();
+
+	void tape01();
+	void tape02();
+	void tape03();
+	void tape04();
+
+	// test: the incremental mode gives the same projections
+	void incremental01();
+	void incremental02();
+	void incremental03();
 };
 
 } // end namespace
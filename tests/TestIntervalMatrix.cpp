@@ -399,6 +399,28 @@ void TestIntervalMatrix::mul02() {
 	TEST_ASSERT((m2*=m1).is_empty());
 }
 
+void TestIntervalMatrix::mul03() {
+	double _m1[][2] = {{0,0}, {NEG_INFINITY,POS_INFINITY}, {1,2}, {-0.1,0.3}, {-2,-1}, {0,POS_INFINITY}};
+	double _m2[][2] = {{-1,3}, {0.1,0.1}, {NEG_INFINITY,0}, {2,2}, {-1,-1}, {1e308,1e308}};
+	IntervalMatrix m1(2,3,_m1);
+	IntervalMatrix m2(3,2,_m2);
+	Matrix r2(m2.mid());
+	IntervalVector v(m1[1]);
+
+	IntervalMatrix p(m1*m2), q(m1*r2), s(r2*m1);
+	IntervalVector w(v*m2);
+	for (int j=0; j<2; j++) {
+		for (int i=0; i<2; i++) {
+			TEST_ASSERT(p[i][j]==m1[i][0]*m2[0][j]+m1[i][1]*m2[1][j]+m1[i][2]*m2[2][j]);
+			TEST_ASSERT(q[i][j]==m1[i][0]*r2[0][j]+m1[i][1]*r2[1][j]+m1[i][2]*r2[2][j]);
+		}
+		TEST_ASSERT(w[j]==v[0]*m2[0][j]+v[1]*m2[1][j]+v[2]*m2[2][j]);
+	}
+	for (int i=0; i<3; i++)
+		for (int j=0; j<3; j++)
+			TEST_ASSERT(s[i][j]==r2[i][0]*m1[0][j]+r2[i][1]*m1[1][j]);
+}
+
 void TestIntervalMatrix::put01() {
 
 	IntervalMatrix M1=2*Matrix::eye(3);
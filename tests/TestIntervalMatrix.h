@@ -69,6 +69,7 @@ public:
 
 		TEST_ADD(TestIntervalMatrix::mul01);
 		TEST_ADD(TestIntervalMatrix::mul02);
+		TEST_ADD(TestIntervalMatrix::mul03);
 
 		TEST_ADD(TestIntervalMatrix::put01);
 	}
@@ -163,6 +164,7 @@ public:
 	//  operator*=(const IntervalMatrix& x)
 	void mul01();
 	void mul02();
+	void mul03();
 
 	void put01();
 };
@@ -114,6 +114,23 @@ void TestIntervalVector::resize04() {
 	check(x[1],Interval(3,4));
 }
 
+void TestIntervalVector::resize05() {
+	// a vector on an external storage
+	Interval storage[2];
+	storage[0]=Interval(1,2);
+	storage[1]=Interval(3,4);
+	IntervalVector* x=new IntervalVector(2,storage,false);
+	(*x)[1]=Interval(5,6);
+	TEST_ASSERT(storage[1]==Interval(5,6));
+	x->resize(3);
+	TEST_ASSERT(x->size()==3);
+	check((*x)[0],Interval(1,2));
+	check((*x)[1],Interval(5,6));
+	(*x)[0]=Interval(7,8);
+	TEST_ASSERT(storage[0]==Interval(1,2));
+	delete x;
+}
+
 static double _x[][2]={{0,1},{2,3},{4,5}};
 
 void TestIntervalVector::subvector01() {
@@ -698,3 +715,61 @@ void TestIntervalVector::random02() {
 
 	TEST_ASSERT(b==r);
 }
+
+/* A vector containing all the kinds of bounds, rotated by k */
+static IntervalVector special(int k) {
+	static const Interval _x[] = { Interval(0,0), Interval::ALL_REALS, Interval(NEG_INFINITY,0),
+			Interval::POS_REALS, Interval(1,2), Interval(-2,-1), Interval(-1,3), Interval(0.1),
+			Interval(-0.3,0.7), Interval(NEG_INFINITY,-1), Interval(2,POS_INFINITY), Interval(1e308) };
+	const int n=sizeof(_x)/sizeof(Interval);
+	IntervalVector x(n);
+	for (int i=0; i<n; i++) x[i]=_x[(i+k)%n];
+	return x;
+}
+
+void TestIntervalVector::kernels01() {
+	IntervalVector x=special(0);
+	int n=x.size();
+
+	for (int k=0; k<n; k++) {
+		IntervalVector y=special(k);
+		IntervalVector s(x+y), d(x-y), m(x[k]*y), h(x|y), i(x&y);
+		for (int j=0; j<n; j++) {
+			TEST_ASSERT(s[j]==x[j]+y[j]);
+			TEST_ASSERT(d[j]==x[j]-y[j]);
+			TEST_ASSERT(m[j]==x[k]*y[j]);
+			TEST_ASSERT(h[j]==(x[j]|y[j]));
+		}
+		// the intersection is empty as soon as one component is
+		bool empty=false;
+		for (int j=0; j<n; j++)
+			if ((x[j]&y[j]).is_empty()) empty=true;
+		TEST_ASSERT(i.is_empty()==empty);
+		if (!empty)
+			for (int j=0; j<n; j++)
+				TEST_ASSERT(i[j]==(x[j]&y[j]));
+	}
+
+	// empty operands
+	IntervalVector e(IntervalVector::empty(n));
+	TEST_ASSERT((x+e).is_empty());
+	TEST_ASSERT((x|e)==x);
+	TEST_ASSERT((e|x)==x);
+	TEST_ASSERT((x&e).is_empty());
+}
+
+void TestIntervalVector::kernels02() {
+	IntervalVector x=special(0);
+	int n=x.size();
+
+	for (int k=0; k<n; k++) {
+		IntervalVector y=special(k);
+		Interval dot;
+		for (int j=0; j<n; j++) dot+=x[j]*y[j];
+		TEST_ASSERT((x*y)==dot);
+		Vector v=y.mid();
+		dot=Interval::ZERO;
+		for (int j=0; j<n; j++) dot+=x[j]*v[j];
+		TEST_ASSERT((x*v)==dot);
+	}
+}
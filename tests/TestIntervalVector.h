@@ -38,6 +38,7 @@ public:
 		TEST_ADD(TestIntervalVector::resize02);
 		TEST_ADD(TestIntervalVector::resize03);
 		TEST_ADD(TestIntervalVector::resize04);
+		TEST_ADD(TestIntervalVector::resize05);
 
 		TEST_ADD(TestIntervalVector::subvector01);
 		TEST_ADD(TestIntervalVector::subvector02);
@@ -117,6 +118,9 @@ public:
 
 		TEST_ADD(TestIntervalVector::random01);
 		TEST_ADD(TestIntervalVector::random02);
+
+		TEST_ADD(TestIntervalVector::kernels01);
+		TEST_ADD(TestIntervalVector::kernels02);
 	}
 
 	/* test:
@@ -148,6 +152,7 @@ public:
 	void resize02();
 	void resize03();
 	void resize04();
+	void resize05();
 
 	// test: subvector(int start_index, int end_index)
 	void subvector01();
@@ -264,6 +269,10 @@ public:
 	void random01();
 	void random02();
 
+	// test: the vectorized kernels give the same results as the interval operators
+	void kernels01();
+	void kernels02();
+
 private:
 
 };
@@ -0,0 +1,178 @@
+/* ============================================================================
+ * I B E X - Memory pool Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : IBEX contributors
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestMemoryPool.h"
+#include "ibex_MemoryPool.h"
+#include "ibex_Cell.h"
+#include "ibex_Bsc.h"
+#include "ibex_Thread.h"
+
+#include <set>
+
+using namespace std;
+
+namespace ibex {
+
+void TestMemoryPool::pool01() {
+	MemoryPool pool(24);
+	TEST_ASSERT(pool.block_size()==32);
+
+	set<void*> blocks;
+	bool aligned=true;
+	for (int i=0; i<10000; i++) {
+		void* p=pool.alloc();
+		aligned &= ((size_t) p)%16==0;
+		blocks.insert(p);
+	}
+	TEST_ASSERT(aligned);
+	TEST_ASSERT(blocks.size()==10000);
+	TEST_ASSERT(pool.nb_used()==10000);
+
+	void* p=*blocks.begin();
+	pool.free(p);
+	TEST_ASSERT(pool.nb_used()==9999);
+	// the last freed block is reused first
+	TEST_ASSERT(pool.alloc()==p);
+
+	for (set<void*>::iterator it=blocks.begin(); it!=blocks.end(); it++)
+		pool.free(*it);
+	TEST_ASSERT(pool.nb_used()==0);
+}
+
+void TestMemoryPool::pool02() {
+	MemoryPool pool(100);
+	vector<void*> blocks;
+	for (int i=0; i<10000; i++)
+		blocks.push_back(pool.alloc());
+	TEST_ASSERT(pool.nb_slabs()>1);
+
+	for (int i=0; i<9999; i++)
+		pool.free(blocks[i]);
+	TEST_ASSERT(pool.nb_slabs()>1);
+
+	pool.free(blocks[9999]);
+	TEST_ASSERT(pool.nb_slabs()==0);
+
+	// the pool can be used again
+	void* p=pool.alloc();
+	TEST_ASSERT(pool.nb_slabs()==1);
+	pool.free(p);
+}
+
+void TestMemoryPool::shared01() {
+	TEST_ASSERT(MemoryPool::pool(1)==MemoryPool::pool(16));
+	TEST_ASSERT(MemoryPool::pool(17)!=MemoryPool::pool(16));
+	TEST_ASSERT(MemoryPool::pool(17)->block_size()==32);
+	TEST_ASSERT(MemoryPool::pool(MemoryPool::max_size)!=NULL);
+	TEST_ASSERT(MemoryPool::pool(MemoryPool::max_size+1)==NULL);
+
+	vector<double*> blocks;
+	for (int n=1; n<1000; n+=7) {
+		double* x=(double*) MemoryPool::allocate(n*sizeof(double));
+		for (int i=0; i<n; i++) x[i]=n;
+		blocks.push_back(x);
+	}
+	bool ok=true;
+	for (int n=1, k=0; n<1000; n+=7, k++) {
+		for (int i=0; i<n; i++) ok &= blocks[k][i]==n;
+		MemoryPool::deallocate(blocks[k],n*sizeof(double));
+	}
+	TEST_ASSERT(ok);
+}
+
+void TestMemoryPool::cell01() {
+	double _box[][2] = {{0,1},{2,3},{4,5}};
+	IntervalVector box(3,_box);
+	Cell* root=new Cell(box);
+	root->add<BisectedVar>();
+	root->get<BisectedVar>().var=1;
+	TEST_ASSERT(root->box==box);
+
+	pair<IntervalVector,IntervalVector> boxes=box.bisect(2);
+	pair<Cell*,Cell*> cells=root->bisect(boxes.first,boxes.second);
+	delete root;
+
+	TEST_ASSERT(cells.first->box==boxes.first);
+	TEST_ASSERT(cells.second->box==boxes.second);
+	TEST_ASSERT(cells.first->get<BisectedVar>().var==1);
+	TEST_ASSERT(cells.second->get<BisectedVar>().var==1);
+
+	// a cell of large dimension (the box is not in the pools)
+	Cell* c=new Cell(IntervalVector(1000,Interval(0,1)));
+	TEST_ASSERT(c->box==IntervalVector(1000,Interval(0,1)));
+	delete c;
+
+	delete cells.first;
+	delete cells.second;
+}
+
+namespace {
+
+class CellThread : public Thread {
+public:
+	CellThread(int n) : n(n) { }
+
+	int n;
+
+	// cells to be deleted by another thread
+	vector<Cell*> cells;
+
+	// cells created by another thread
+	vector<Cell*> to_delete;
+
+	bool ok;
+
+	void run() {
+		ok=true;
+		for (int i=0; i<n; i++) {
+			Cell* c=new Cell(IntervalVector(i%20+1,Interval(i)));
+			c->add<BisectedVar>();
+			cells.push_back(c);
+		}
+		for (vector<Cell*>::iterator it=to_delete.begin(); it!=to_delete.end(); it++) {
+			int i=it-to_delete.begin();
+			ok &= (*it)->box==IntervalVector(i%20+1,Interval(i));
+			delete *it;
+		}
+	}
+};
+
+}
+
+void TestMemoryPool::threads01() {
+	int n=10000;
+	vector<CellThread*> threads;
+	for (int i=0; i<4; i++)
+		threads.push_back(new CellThread(n));
+
+	// first round: each thread creates cells
+	for (int i=0; i<4; i++) threads[i]->start();
+	for (int i=0; i<4; i++) threads[i]->join();
+
+	// second round: each thread deletes the cells of the next one
+	for (int i=0; i<4; i++) {
+		CellThread* t=new CellThread(0);
+		t->to_delete=threads[i]->cells;
+		delete threads[i];
+		threads[i]=t;
+	}
+	for (int i=0; i<4; i++) threads[i]->start();
+	for (int i=0; i<4; i++) threads[i]->join();
+
+	bool ok=true;
+	for (int i=0; i<4; i++) {
+		ok &= threads[i]->ok;
+		delete threads[i];
+	}
+	TEST_ASSERT(ok);
+}
+
+} // end namespace ibex
@@ -0,0 +1,45 @@
+/* ============================================================================
+ * I B E X - Memory pool Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : IBEX contributors
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_MEMORY_POOL_H__
+#define __TEST_MEMORY_POOL_H__
+
+#include "cpptest.h"
+#include "utils.h"
+
+namespace ibex {
+
+class TestMemoryPool : public TestIbex {
+
+public:
+	TestMemoryPool() {
+		TEST_ADD(TestMemoryPool::pool01);
+		TEST_ADD(TestMemoryPool::pool02);
+		TEST_ADD(TestMemoryPool::shared01);
+		TEST_ADD(TestMemoryPool::cell01);
+		TEST_ADD(TestMemoryPool::threads01);
+	}
+
+	// allocation and reuse of blocks
+	void pool01();
+	// the slabs are released when all the blocks are freed
+	void pool02();
+	// shared pools and large blocks
+	void shared01();
+	// cells and their data in the pools
+	void cell01();
+	// cells created in a thread and deleted in another one
+	void threads01();
+};
+
+} // end namespace ibex
+
+#endif // __TEST_MEMORY_POOL_H__
@@ -0,0 +1,83 @@
+//============================================================================
+//                                  I B E X
+// File        : TestParallelOptimizer.cpp
+// Author      : IBEX contributors
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#include "TestParallelOptimizer.h"
+#include "ibex_DefaultParallelOptimizer.h"
+#include "ibex_SystemFactory.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+// true minimum is 0.
+Optimizer::Status issue50(double init_loup, double prec) {
+	SystemFactory f;
+	const ExprSymbol& x=ExprSymbol::new_();
+	f.add_var(x);
+	f.add_ctr(x>=0);
+	f.add_goal(x);
+
+	System sys(f);
+	DefaultParallelOptimizer o(sys,prec,prec,2);
+
+	IntervalVector init_box(1,Interval::ALL_REALS);
+	return o.optimize(init_box,init_loup);
+}
+
+// true if the minimum of x+y in the unit disk (-sqrt(2)) is found
+bool disk(int nb_threads) {
+	SystemFactory f;
+	const ExprSymbol& x=ExprSymbol::new_();
+	const ExprSymbol& y=ExprSymbol::new_();
+	f.add_var(x);
+	f.add_var(y);
+	f.add_ctr(sqr(x)+sqr(y)<=1);
+	f.add_goal(x+y);
+
+	System sys(f);
+	DefaultParallelOptimizer o(sys,1e-07,1e-07,nb_threads);
+
+	IntervalVector init_box(2,Interval(-10,10));
+	if (o.optimize(init_box)!=Optimizer::SUCCESS) return false;
+
+	double min=-::sqrt(2);
+	return o.uplo<=o.loup && o.uplo<=min+1e-6 && o.loup>=min-1e-6 && o.loup<=min+1e-6
+			&& o.loup_point[0]*o.loup_point[0]+o.loup_point[1]*o.loup_point[1]<=1+1e-9;
+}
+
+} // end anonymous namespace
+
+void TestParallelOptimizer::issue50_1() {
+	TEST_ASSERT(issue50(1e-10, 0.1)==Optimizer::NO_FEASIBLE_FOUND);
+}
+
+void TestParallelOptimizer::issue50_2() {
+	TEST_ASSERT(issue50(1e-10, 0)==Optimizer::SUCCESS);
+}
+
+void TestParallelOptimizer::issue50_3() {
+	TEST_ASSERT(issue50(-1e-10, 0.1)==Optimizer::NO_FEASIBLE_FOUND);
+}
+
+void TestParallelOptimizer::issue50_4() {
+	TEST_ASSERT(issue50(-1e-10, 0)==Optimizer::INFEASIBLE);
+}
+
+void TestParallelOptimizer::disk01() {
+	TEST_ASSERT(disk(1));
+}
+
+void TestParallelOptimizer::disk02() {
+	TEST_ASSERT(disk(4));
+}
+
+} // end namespace ibex
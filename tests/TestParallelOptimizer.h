@@ -0,0 +1,43 @@
+//============================================================================
+//                                  I B E X
+// File        : TestParallelOptimizer.h
+// Author      : IBEX contributors
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#ifndef __TEST_PARALLEL_OPTIMIZER_H__
+#define __TEST_PARALLEL_OPTIMIZER_H__
+
+#include "cpptest.h"
+#include "utils.h"
+
+namespace ibex {
+
+class TestParallelOptimizer : public TestIbex {
+public:
+	TestParallelOptimizer() {
+		TEST_ADD(TestParallelOptimizer::issue50_1);
+		TEST_ADD(TestParallelOptimizer::issue50_2);
+		TEST_ADD(TestParallelOptimizer::issue50_3);
+		TEST_ADD(TestParallelOptimizer::issue50_4);
+		TEST_ADD(TestParallelOptimizer::disk01);
+		TEST_ADD(TestParallelOptimizer::disk02);
+	}
+
+	// same status as the sequential optimizer (see TestOptimizer)
+	void issue50_1();
+	void issue50_2();
+	void issue50_3();
+	void issue50_4();
+
+	// minimum of x+y in the unit disk, with one worker
+	void disk01();
+	// minimum of x+y in the unit disk, with four workers
+	void disk02();
+};
+
+} // end namespace ibex
+#endif // __TEST_PARALLEL_OPTIMIZER_H__
@@ -0,0 +1,107 @@
+//============================================================================
+//                                  I B E X
+// File        : TestParallelSolver.cpp
+// Author      : IBEX contributors
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#include "TestParallelSolver.h"
+#include "ibex_ParallelSolver.h"
+#include "ibex_DefaultParallelSolver.h"
+#include "ibex_Solver.h"
+#include "ibex_CtcHC4.h"
+#include "ibex_CtcFwdBwd.h"
+#include "ibex_RoundRobin.h"
+#include "ibex_CellStack.h"
+#include "ibex_SystemFactory.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+// intersection of two circles of radius 1, centered in (0,0) and (1,1)
+Function* circles() {
+	Variable x,y;
+	return new Function(x,y,Return(sqrt(sqr(x)+sqr(y))-1, sqrt(sqr(x-1.0)+sqr(y-1.0))-1));
+}
+
+// true if the parallel solver finds the same solutions as the sequential one
+bool same_sols(int nb_threads) {
+	double _box[][2] = { {-10,10},{-10,10} };
+	IntervalVector box(2,_box);
+
+	Function* f=circles();
+	CtcFwdBwd c(*f);
+	RoundRobin rr(1e-3);
+	CellStack buff;
+	Solver s(c,rr,buff);
+	vector<IntervalVector> sols=s.solve(box);
+
+	Array<Function> fs(nb_threads);
+	Array<Ctc> ctc(nb_threads);
+	Array<Bsc> bsc(nb_threads);
+	for (int i=0; i<nb_threads; i++) {
+		fs.set_ref(i,*circles());
+		ctc.set_ref(i,*new CtcFwdBwd(fs[i]));
+		bsc.set_ref(i,*new RoundRobin(1e-3));
+	}
+	ParallelSolver ps(ctc,bsc);
+	vector<IntervalVector> psols=ps.solve(box);
+
+	// same number of nodes and same solutions (up to the order)
+	bool same=(ps.nb_cells==s.nb_cells && psols.size()==sols.size());
+	for (unsigned int i=0; same && i<sols.size(); i++) {
+		bool found=false;
+		for (unsigned int j=0; j<psols.size(); j++)
+			if (psols[j]==sols[i]) found=true;
+		same=found;
+	}
+
+	for (int i=0; i<nb_threads; i++) {
+		delete &ctc[i];
+		delete &bsc[i];
+		delete &fs[i];
+	}
+	delete f;
+	return same;
+}
+
+} // end anonymous namespace
+
+void TestParallelSolver::circle_inter01() {
+	TEST_ASSERT(same_sols(1));
+}
+
+void TestParallelSolver::circle_inter02() {
+	TEST_ASSERT(same_sols(4));
+}
+
+void TestParallelSolver::default01() {
+	SystemFactory fac;
+	const ExprSymbol& x=ExprSymbol::new_();
+	const ExprSymbol& y=ExprSymbol::new_();
+	fac.add_var(x);
+	fac.add_var(y);
+	fac.add_ctr(sqr(x)+sqr(y)=1);
+	fac.add_ctr(y=x);
+	System sys(fac);
+	sys.box[0]=Interval(-10,10);
+	sys.box[1]=Interval(-10,10);
+
+	DefaultParallelSolver s(sys,1e-8,3);
+	vector<IntervalVector> sols=s.solve(sys.box);
+
+	TEST_ASSERT(sols.size()==2);
+	if (sols.size()==2) {
+		// solutions are sorted
+		TEST_ASSERT(sols[0][0].contains(-::sqrt(2)/2));
+		TEST_ASSERT(sols[1][0].contains(::sqrt(2)/2));
+	}
+}
+
+} // end namespace ibex
@@ -0,0 +1,36 @@
+//============================================================================
+//                                  I B E X
+// File        : TestParallelSolver.h
+// Author      : IBEX contributors
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#ifndef __TEST_PARALLEL_SOLVER_H__
+#define __TEST_PARALLEL_SOLVER_H__
+
+#include "cpptest.h"
+#include "utils.h"
+
+namespace ibex {
+
+class TestParallelSolver : public TestIbex {
+public:
+	TestParallelSolver() {
+		TEST_ADD(TestParallelSolver::circle_inter01);
+		TEST_ADD(TestParallelSolver::circle_inter02);
+		TEST_ADD(TestParallelSolver::default01);
+	}
+
+	// same solutions as the sequential solver with one worker
+	void circle_inter01();
+	// same solutions as the sequential solver with four workers
+	void circle_inter02();
+	// default parallel solver
+	void default01();
+};
+
+} // end namespace ibex
+#endif // __TEST_PARALLEL_SOLVER_H__
@@ -8,11 +8,107 @@
 //============================================================================
 
 #include "TestSepPolygon.h"
+#include <cstdlib>
 
 using namespace std;
 
 namespace ibex {
 
+namespace {
+
+/* The separator of the polygon calculated with all the segments */
+class SepPolygonRef : public SepBoundaryCtc {
+public:
+	SepPolygonRef(vector<double>& ax, vector<double>& ay, vector<double>& bx, vector<double>& by, Array<Ctc> list) :
+		SepBoundaryCtc(*new CtcUnion(list), *new PdcInPolygon(ax,ay,bx,by)) { }
+
+	~SepPolygonRef() {
+		Array<Ctc>& list=((CtcUnion&) ctc_boundary).list;
+		for(int i=0; i<list.size(); i++)
+			delete &list[i];
+		delete &ctc_boundary;
+		delete &is_inside;
+	}
+};
+
+Array<Ctc> segments(vector<double>& ax, vector<double>& ay, vector<double>& bx, vector<double>& by) {
+	Array<Ctc> l(ax.size());
+	for(unsigned int i=0; i<ax.size(); i++)
+		l.set_ref(i, *new CtcSegment(ax[i],ay[i],bx[i],by[i]));
+	return l;
+}
+
+/* The winding number as the sum of the angles of all the segments */
+BoolInterval in_polygon_ref(const vector<double>& ax, const vector<double>& ay, const vector<double>& bx, const vector<double>& by, double x, double y) {
+	Interval theta=Interval(0);
+	for(unsigned int i=0; i<ax.size(); i++) {
+		Interval ma_x = Interval(ax[i]) - x;
+		Interval ma_y = Interval(ay[i]) - y;
+		Interval mb_x = Interval(bx[i]) - x;
+		Interval mb_y = Interval(by[i]) - y;
+		Interval norm = sqrt(sqr(ma_x) + sqr(ma_y))*sqrt(sqr(mb_x) + sqr(mb_y));
+		theta += atan2((ma_x*mb_y - ma_y*mb_x)/norm, (ma_x*mb_x + ma_y*mb_y)/norm);
+	}
+	if (!theta.contains(0)) return YES;
+	else if (!theta.contains(2*M_PI)) return NO;
+	else return MAYBE;
+}
+
+/* A star-shaped polygon with n vertices (counter-clockwise) */
+void star(int n, vector<double>& ax, vector<double>& ay, vector<double>& bx, vector<double>& by) {
+	ax.clear(); ay.clear(); bx.clear(); by.clear();
+	for (int i=0; i<n; i++) {
+		double t1=2*M_PI*i/n;
+		double t2=2*M_PI*(i+1)/n;
+		double r1=i%2==0? 10 : 5;
+		double r2=i%2==0? 5 : 10;
+		ax.push_back(r1*::cos(t1)); ay.push_back(r1*::sin(t1));
+		bx.push_back(r2*::cos(t2)); by.push_back(r2*::sin(t2));
+	}
+}
+
+double random(double a, double b) {
+	return a+(b-a)*rand()/RAND_MAX;
+}
+
+/* compare SepPolygon with SepPolygonRef on random boxes */
+void check_sep(vector<double>& ax, vector<double>& ay, vector<double>& bx, vector<double>& by, double w, bool& ok) {
+	SepPolygon sep(ax,ay,bx,by);
+	SepPolygonRef ref(ax,ay,bx,by,segments(ax,ay,bx,by));
+
+	srand(1);
+	for (int k=0; k<100; k++) {
+		double x=random(-12,12);
+		double y=random(-12,12);
+		IntervalVector box(2);
+		box[0]=Interval(x,x+random(0,w));
+		box[1]=Interval(y,y+random(0,w));
+
+		IntervalVector x_in(box), x_out(box);
+		sep.separate(x_in,x_out);
+		IntervalVector x_in2(box), x_out2(box);
+		ref.separate(x_in2,x_out2);
+
+		ok &= (x_in==x_in2 && x_out==x_out2);
+	}
+}
+
+/* compare PdcInPolygon with in_polygon_ref on random points */
+void check_pdc(vector<double>& ax, vector<double>& ay, vector<double>& bx, vector<double>& by, bool& ok) {
+	PdcInPolygon pdc(ax,ay,bx,by);
+
+	srand(1);
+	for (int k=0; k<1000; k++) {
+		Vector pt(2);
+		pt[0]=random(-12,12);
+		pt[1]=random(-12,12);
+		BoolInterval b=in_polygon_ref(ax,ay,bx,by,pt[0],pt[1]);
+		if (b!=MAYBE) ok &= (pdc.test(pt)==b);
+	}
+}
+
+} // end anonymous namespace
+
 void TestSepPolygon::setup(){
 
     murs_xa.clear(); murs_xa2.clear();
@@ -64,5 +160,56 @@ void TestSepPolygon::test_SepPolygon_03(){
 
 }
 
+void TestSepPolygon::test_SepPolygon_04(){
+
+    murs_xa.insert(murs_xa.end(), murs_xa2.begin(), murs_xa2.end());
+    murs_ya.insert(murs_ya.end(), murs_ya2.begin(), murs_ya2.end());
+    murs_xb.insert(murs_xb.end(), murs_xb2.begin(), murs_xb2.end());
+    murs_yb.insert(murs_yb.end(), murs_yb2.begin(), murs_yb2.end());
+
+    bool ok=true;
+    check_sep(murs_xa, murs_ya, murs_xb, murs_yb, 10, ok);
+    TEST_ASSERT(ok);
+}
+
+void TestSepPolygon::test_SepPolygon_05(){
+    vector<double> ax,ay,bx,by;
+    star(200,ax,ay,bx,by);
+
+    bool ok=true;
+    check_sep(ax, ay, bx, by, 1, ok);
+    TEST_ASSERT(ok);
+}
+
+void TestSepPolygon::test_PdcInPolygon_01(){
+
+    murs_xa.insert(murs_xa.end(), murs_xa2.begin(), murs_xa2.end());
+    murs_ya.insert(murs_ya.end(), murs_ya2.begin(), murs_ya2.end());
+    murs_xb.insert(murs_xb.end(), murs_xb2.begin(), murs_xb2.end());
+    murs_yb.insert(murs_yb.end(), murs_yb2.begin(), murs_yb2.end());
+
+    bool ok=true;
+    check_pdc(murs_xa, murs_ya, murs_xb, murs_yb, ok);
+    TEST_ASSERT(ok);
+
+    // the hole is outside, points on the edges are undetermined
+    PdcInPolygon pdc(murs_xa, murs_ya, murs_xb, murs_yb);
+    double _pt[][2]={{0,0},{5,0},{20,0},{3.5,7},{-1,-7.5}};
+    BoolInterval res[]={NO,YES,NO,MAYBE,MAYBE};
+    for (int i=0; i<5; i++) {
+        Vector pt(2,_pt[i]);
+        TEST_ASSERT(pdc.test(pt)==res[i]);
+    }
+}
+
+void TestSepPolygon::test_PdcInPolygon_02(){
+    vector<double> ax,ay,bx,by;
+    star(1000,ax,ay,bx,by);
+
+    bool ok=true;
+    check_pdc(ax, ay, bx, by, ok);
+    TEST_ASSERT(ok);
+}
+
 } // end namespace
 
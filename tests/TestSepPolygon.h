@@ -15,6 +15,9 @@
 #include "ibex_SepPolygon.h"
 #include "ibex_SepNot.h"
 #include "ibex_SepInter.h"
+#include "ibex_CtcUnion.h"
+#include "ibex_CtcSegment.h"
+#include "ibex_PdcInPolygon.h"
 
 #include "utils.h"
 
@@ -27,6 +30,10 @@ public:
         TEST_ADD(TestSepPolygon::test_SepPolygon_01);
         TEST_ADD(TestSepPolygon::test_SepPolygon_02);
         TEST_ADD(TestSepPolygon::test_SepPolygon_03);
+        TEST_ADD(TestSepPolygon::test_SepPolygon_04);
+        TEST_ADD(TestSepPolygon::test_SepPolygon_05);
+        TEST_ADD(TestSepPolygon::test_PdcInPolygon_01);
+        TEST_ADD(TestSepPolygon::test_PdcInPolygon_02);
 	}
 
     void setup();
@@ -34,6 +41,14 @@ public:
     void test_SepPolygon_02();
     void test_SepPolygon_03();
 
+    /* compare with the separator built from the union of all the segments */
+    void test_SepPolygon_04();
+    void test_SepPolygon_05(); // many segments
+
+    /* compare with the sum of the angles of all the segments */
+    void test_PdcInPolygon_01();
+    void test_PdcInPolygon_02(); // many segments
+
 private:
     vector<double> murs_xa,murs_xb,murs_ya,murs_yb;
     vector<double> murs_xa2,murs_xb2,murs_ya2,murs_yb2;
@@ -10,6 +10,13 @@
 #include "TestSetInterval.h"
 #include "ibex_SetInterval.h"
 #include "ibex_SetLeaf.h"
+#include "ibex_SepFwdBwd.h"
+#include "ibex_SetIndex.h"
+#include <sstream>
+#include <cstdio>
+#include <cstdlib>
+
+using namespace std;
 
 namespace ibex {
 
@@ -27,4 +34,287 @@ void TestSetInterval::diff01() {
 	TEST_ASSERT(leaf && leaf->status==__IBEX_UNK__);
 }
 
+namespace {
+
+/* The ring 1<=x^2+y^2<=4, with one separator per thread */
+class Ring {
+public:
+	Ring(int n) : sep(n) {
+		for (int i=0; i<n; i++) {
+			Variable x,y;
+			f.push_back(new Function(x,y,sqr(x)+sqr(y)));
+			sep.set_ref(i,*new SepFwdBwd(*f.back(),Interval(1,4)));
+		}
+	}
+
+	~Ring() {
+		for (int i=0; i<sep.size(); i++) {
+			delete &sep[i];
+			delete f[i];
+		}
+	}
+
+	vector<Function*> f;
+	Array<Sep> sep;
+};
+
+string to_string(const SetInterval& set) {
+	stringstream s;
+	s << set;
+	return s.str();
+}
+
+/* number of leaves and volume of the inner leaves (see visit_leaves) */
+int nb_leaves;
+double vol_in;
+
+void count_leaves(const IntervalVector& box, BoolInterval status) {
+	nb_leaves++;
+	if (status==YES) vol_in+=box.volume();
+}
+
+/* membership of a point, calculated from all the leaves (see visit_leaves) */
+Vector* point;
+IntervalVector* query;
+int nb_found;
+BoolInterval found;
+
+void find_point(const IntervalVector& box, BoolInterval status) {
+	if (!box.contains(*point)) return;
+	found = nb_found==0 || found==status ? status : MAYBE;
+	nb_found++;
+}
+
+/* count the leaves that intersect a box */
+void find_box(const IntervalVector& box, BoolInterval status) {
+	if (box.intersects(*query)) nb_found++;
+}
+
+/* A matrix of n random points in the box [-4,4]x[-4,4] */
+Matrix random_points(int n) {
+	srand(1);
+	Matrix pts(n,2);
+	for (int i=0; i<n; i++)
+		for (int j=0; j<2; j++)
+			pts[i][j]=-4+8.0*rand()/RAND_MAX;
+	// points on the boundary of leaves
+	pts[0][0]=0;   pts[0][1]=0;
+	pts[1][0]=1.5; pts[1][1]=0;
+	pts[2][0]=-3;  pts[2][1]=3;
+	return pts;
+}
+
+}
+
+void TestSetInterval::parallel_sync01() {
+	Ring ring(3);
+	IntervalVector box(2,Interval(-3,3));
+
+	SetInterval set1(box,0.1,false);
+	set1.sync(ring.sep[0]);
+
+	for (int depth=0; depth<=20; depth+=4) {
+		SetInterval set2(box,0.1,false);
+		set2.sync(ring.sep,depth);
+		TEST_ASSERT(to_string(set1)==to_string(set2));
+	}
+}
+
+void TestSetInterval::parallel_contract01() {
+	Ring ring(3);
+	IntervalVector box(2,Interval(-3,3));
+
+	SetInterval set1(box,0.1);
+	set1.contract(ring.sep[0]);
+
+	for (int depth=0; depth<=20; depth+=4) {
+		SetInterval set2(box,0.1);
+		set2.contract(ring.sep,depth);
+		TEST_ASSERT(to_string(set1)==to_string(set2));
+	}
+}
+
+void TestSetInterval::parallel_noset01() {
+	Variable x,y;
+	Function f1(x,y,sqr(x)+sqr(y));
+	Function f2(x,y,sqr(x)+sqr(y));
+	IntervalVector box(2,Interval(-3,3));
+
+	// the whole box is inside the first set, and outside the second one.
+	// depth 0: the exception is raised by a worker thread.
+	for (int depth=0; depth<=2; depth+=2) {
+		Array<Sep> all(*new SepFwdBwd(f1,Interval(0,100)), *new SepFwdBwd(f2,Interval(0,100)));
+		Array<Sep> none(*new SepFwdBwd(f1,Interval(100,200)), *new SepFwdBwd(f2,Interval(100,200)));
+		SetInterval set(box,0.1,false);
+		set.sync(all,depth);
+		TEST_ASSERT(!set.is_empty());
+		bool no_set=false;
+		try {
+			set.sync(none,depth);
+		} catch(NoSet&) {
+			no_set=true;
+		}
+		TEST_ASSERT(no_set);
+		TEST_ASSERT(set.is_empty());
+		for (int i=0; i<2; i++) {
+			delete &all[i];
+			delete &none[i];
+		}
+	}
+}
+
+void TestSetInterval::save_load01() {
+	Ring ring(1);
+	IntervalVector box(2,Interval(-3,3));
+
+	SetInterval set1(box,0.1);
+	set1.contract(ring.sep[0]);
+	set1.save("test.set");
+
+	SetInterval set2("test.set");
+	TEST_ASSERT(!set2.is_empty());
+	TEST_ASSERT(to_string(set1)==to_string(set2));
+
+	nb_leaves=0; vol_in=0;
+	set1.visit_leaves(count_leaves);
+	int n1=nb_leaves;
+	double v1=vol_in;
+
+	nb_leaves=0; vol_in=0;
+	set2.visit_leaves(count_leaves);
+	TEST_ASSERT(n1>1);
+	TEST_ASSERT(nb_leaves==n1);
+	TEST_ASSERT(vol_in==v1);
+
+	double _pt[][2]={{0,0},{1.5,0},{0.5,0.5},{-2.5,2.5},{3,-3}};
+	for (int i=0; i<5; i++) {
+		Vector pt(2,_pt[i]);
+		TEST_ASSERT(set1.dist(pt,true)==set2.dist(pt,true));
+		TEST_ASSERT(set1.dist(pt,false)==set2.dist(pt,false));
+	}
+
+	// save a loaded set
+	set2.save("test2.set");
+	SetInterval set3("test2.set");
+	TEST_ASSERT(to_string(set1)==to_string(set3));
+
+	remove("test.set");
+	remove("test2.set");
+}
+
+void TestSetInterval::save_load02() {
+	Ring ring(1);
+	IntervalVector box(2,Interval(-3,3));
+
+	SetInterval set1(box,0.2);
+	set1.contract(ring.sep[0]);
+	set1.save("test.set");
+
+	SetInterval set2("test.set");
+	SetInterval set3("test.set");
+
+	Variable x,y;
+	Function f(x,y,x+y);
+	SepFwdBwd sep(f,Interval(-1,1));
+
+	set1.contract(sep);
+	set2.contract(sep);
+	TEST_ASSERT(to_string(set1)==to_string(set2));
+
+	set1 |= set3;
+	set2 |= set3;
+	TEST_ASSERT(to_string(set1)==to_string(set2));
+
+	remove("test.set");
+}
+
+void TestSetInterval::save_load03() {
+	Ring ring(1);
+	IntervalVector box(2,Interval(-3,3));
+
+	SetInterval set1(box,0.2);
+	set1.contract(ring.sep[0]);
+	set1.save("test.set");
+
+	// save a set into the file it is mapped from
+	SetInterval set2("test.set");
+	set2.save("test.set");
+	TEST_ASSERT(to_string(set1)==to_string(set2));
+
+	SetInterval set3("test.set");
+	TEST_ASSERT(to_string(set1)==to_string(set3));
+
+	remove("test.set");
+}
+
+void TestSetInterval::index_contains01() {
+	Ring ring(1);
+	IntervalVector box(2,Interval(-3,3));
+
+	SetInterval set(box,0.1);
+	set.contract(ring.sep[0]);
+	SetIndex index(set);
+
+	int n=1000;
+	Matrix pts=random_points(n);
+	BoolInterval* res1=new BoolInterval[n];
+	BoolInterval* res3=new BoolInterval[n];
+	index.contains(pts,res1);
+	index.contains(pts,res3,3);
+
+	for (int i=0; i<n; i++) {
+		point=&pts[i];
+		nb_found=0;
+		set.visit_leaves(find_point);
+		BoolInterval b=nb_found==0? NO : found;
+		TEST_ASSERT(index.contains(pts[i])==b);
+		TEST_ASSERT(res1[i]==b);
+		TEST_ASSERT(res3[i]==b);
+	}
+	delete[] res1;
+	delete[] res3;
+}
+
+void TestSetInterval::index_dist01() {
+	Ring ring(1);
+	IntervalVector box(2,Interval(-3,3));
+
+	SetInterval set(box,0.1);
+	set.contract(ring.sep[0]);
+	SetIndex index(set);
+
+	int n=100;
+	Matrix pts=random_points(n);
+	Vector d1=index.dist(pts,true);
+	Vector d3=index.dist(pts,false,3);
+
+	for (int i=0; i<n; i++) {
+		TEST_ASSERT(index.dist(pts[i],true)==set.dist(pts[i],true));
+		TEST_ASSERT(d1[i]==set.dist(pts[i],true));
+		TEST_ASSERT(d3[i]==set.dist(pts[i],false));
+	}
+}
+
+void TestSetInterval::index_overlap01() {
+	Ring ring(1);
+	IntervalVector box(2,Interval(-3,3));
+
+	SetInterval set(box,0.1);
+	set.contract(ring.sep[0]);
+	SetIndex index(set);
+
+	double _b[][2]={{0.5,1.5},{-0.2,0.1}};
+	IntervalVector b(2,_b);
+	query=&b;
+
+	nb_found=0;
+	set.visit_leaves(find_box);
+	int n=nb_found;
+	TEST_ASSERT(n>0);
+
+	nb_found=0;
+	index.overlap(b,find_box); // find_box counts again (all leaves given intersect b)
+	TEST_ASSERT(nb_found==n);
+}
+
 } // end namespace ibex
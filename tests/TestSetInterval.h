@@ -19,9 +19,34 @@ class TestSetInterval : public TestIbex {
 public:
 	TestSetInterval() {
 		TEST_ADD(TestSetInterval::diff01);
+		TEST_ADD(TestSetInterval::parallel_sync01);
+		TEST_ADD(TestSetInterval::parallel_contract01);
+		TEST_ADD(TestSetInterval::parallel_noset01);
+		TEST_ADD(TestSetInterval::save_load01);
+		TEST_ADD(TestSetInterval::save_load02);
+		TEST_ADD(TestSetInterval::save_load03);
+		TEST_ADD(TestSetInterval::index_contains01);
+		TEST_ADD(TestSetInterval::index_dist01);
+		TEST_ADD(TestSetInterval::index_overlap01);
 	}
 
 	void diff01();
+
+	/* check that the multi-threaded construction gives the same set */
+	void parallel_sync01();
+	void parallel_contract01();
+	void parallel_noset01();
+
+	/* check the queries on a loaded (mapped) set */
+	void save_load01();
+	/* check the operations on a loaded set */
+	void save_load02();
+	void save_load03();
+
+	/* check the queries of SetIndex against the leaves of the set */
+	void index_contains01();
+	void index_dist01();
+	void index_overlap01();
 };
 
 } // end namespace ibex
@@ -0,0 +1,221 @@
+/* ============================================================================
+ * I B E X - Simplex Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : IBEX contributors
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestSimplex.h"
+
+#include <cstdlib>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+/* Add the rows lb_j <= x_j <= ub_j */
+void add_bounds(Simplex& lp, const IntervalVector& box) {
+	for (int j=0; j<box.size(); j++) {
+		Vector e=Vector::zeros(box.size());
+		e[j]=1;
+		lp.add_row(e,box[j].lb(),box[j].ub());
+	}
+}
+
+double random(double a, double b) {
+	return a+(b-a)*(((double) rand())/RAND_MAX);
+}
+
+}
+
+bool TestSimplex::check_optimal(const Simplex& lp, const Vector& c, double eps) {
+	int n=lp.nb_vars();
+	int m=lp.nb_rows();
+
+	// primal feasibility
+	for (int i=0; i<m; i++) {
+		double s=0;
+		for (int j=0; j<n; j++) s+=lp.coef(i,j)*lp.primal(j);
+		if (s<lp.lhs(i)-eps || s>lp.rhs(i)+eps) return false;
+		// complementary slackness
+		if (lp.dual(i)>eps && fabs(s-lp.lhs(i))>eps) return false;
+		if (lp.dual(i)<-eps && fabs(s-lp.rhs(i))>eps) return false;
+	}
+
+	// dual feasibility: c=A^T y
+	for (int j=0; j<n; j++) {
+		double s=0;
+		for (int i=0; i<m; i++) s+=lp.coef(i,j)*lp.dual(i);
+		if (fabs(s-c[j])>eps) return false;
+	}
+
+	return true;
+}
+
+void TestSimplex::simplex01() {
+	// min -x-y s.t. x+2y<=4, 3x+y<=6, x>=0, y>=0
+	Simplex lp(2);
+	add_bounds(lp,IntervalVector(2,Interval::POS_REALS));
+	double _r1[]={1,2};
+	double _r2[]={3,1};
+	lp.add_row(Vector(2,_r1),NEG_INFINITY,4);
+	lp.add_row(Vector(2,_r2),NEG_INFINITY,6);
+	lp.set_obj(0,-1);
+	lp.set_obj(1,-1);
+
+	TEST_ASSERT(lp.solve()==Simplex::OPTIMAL);
+	TEST_ASSERT_DELTA(lp.obj_value(),-2.8,1e-12);
+	TEST_ASSERT_DELTA(lp.primal(0),1.6,1e-12);
+	TEST_ASSERT_DELTA(lp.primal(1),1.2,1e-12);
+	TEST_ASSERT_DELTA(lp.dual(0),0,1e-12);
+	TEST_ASSERT_DELTA(lp.dual(1),0,1e-12);
+	TEST_ASSERT_DELTA(lp.dual(2),-0.4,1e-12);
+	TEST_ASSERT_DELTA(lp.dual(3),-0.2,1e-12);
+}
+
+void TestSimplex::simplex02() {
+	// x+y>=3, x,y in [0,1]
+	Simplex lp(2);
+	add_bounds(lp,IntervalVector(2,Interval(0,1)));
+	double _r[]={1,1};
+	lp.add_row(Vector(2,_r),3,POS_INFINITY);
+	lp.set_obj(0,1);
+
+	TEST_ASSERT(lp.solve()==Simplex::INFEASIBLE);
+
+	// check the certificate: A^T y=0 and min y^T s>0
+	double min=0;
+	for (int i=0; i<lp.nb_rows(); i++) {
+		double yi=lp.farkas(i);
+		if (yi>0) min+=yi*lp.lhs(i);
+		else if (yi<0) min+=yi*lp.rhs(i);
+	}
+	TEST_ASSERT(min>0.1);
+	for (int j=0; j<2; j++) {
+		double s=0;
+		for (int i=0; i<lp.nb_rows(); i++) s+=lp.coef(i,j)*lp.farkas(i);
+		TEST_ASSERT_DELTA(s,0,1e-12);
+	}
+}
+
+void TestSimplex::simplex03() {
+	// min -x s.t. x-y<=1, y>=0
+	Simplex lp(2);
+	double _r1[]={1,-1};
+	double _r2[]={0,1};
+	lp.add_row(Vector(2,_r1),NEG_INFINITY,1);
+	lp.add_row(Vector(2,_r2),0,POS_INFINITY);
+	lp.set_obj(0,-1);
+	TEST_ASSERT(lp.solve()==Simplex::UNBOUNDED);
+
+	// with y<=2: optimum x=3
+	lp.set_bounds(1,0,2);
+	TEST_ASSERT(lp.solve()==Simplex::OPTIMAL);
+	TEST_ASSERT_DELTA(lp.obj_value(),-3,1e-12);
+}
+
+void TestSimplex::simplex04() {
+	// the polytope x+y<=1, x-y<=0, -x+2y<=2 (see TestCtcPolytopeHull)
+	// the bounds of each variable are calculated
+	// with the same LP (warm start) and with a new one.
+	double _A[3][2]= {{1,1},{1,-1},{-1,2}};
+	double _b[3]= {1,0,2};
+
+	double _boxes[][2][2] = {
+			{{-1,1},{-1,1}},
+			{{-1,0.5},{-1,1}},
+			{{0,2},{-2,2}},
+			{{-1,1},{-1,1}},
+			{{-3,-1},{0,3}} };
+
+	Simplex lp(2);
+	add_bounds(lp,IntervalVector(2));
+
+	for (int k=0; k<5; k++) {
+		IntervalVector box(2,_boxes[k]);
+		for (int j=0; j<2; j++) lp.set_bounds(j,box[j].lb(),box[j].ub());
+		for (int i=0; i<3; i++) lp.add_row(Vector(2,_A[i]),NEG_INFINITY,_b[i]);
+
+		for (int j=0; j<2; j++) {
+			for (int sign=-1; sign<=1; sign+=2) {
+				Simplex lp2(2);
+				add_bounds(lp2,box);
+				for (int i=0; i<3; i++) lp2.add_row(Vector(2,_A[i]),NEG_INFINITY,_b[i]);
+
+				Vector c=Vector::zeros(2);
+				c[j]=sign;
+				lp.set_obj(j,sign);
+				lp2.set_obj(j,sign);
+
+				Simplex::Status s1=lp.solve();
+				Simplex::Status s2=lp2.solve();
+				TEST_ASSERT(s1==s2);
+				if (s1==Simplex::OPTIMAL) {
+					TEST_ASSERT_DELTA(lp.obj_value(),lp2.obj_value(),1e-12);
+					TEST_ASSERT(check_optimal(lp,c,1e-12));
+				}
+				lp.set_obj(j,0);
+			}
+		}
+		lp.remove_rows(2);
+	}
+}
+
+void TestSimplex::simplex05() {
+	srand(1);
+	int n=10;
+	int m=20;
+
+	for (int k=0; k<50; k++) {
+		Simplex lp(n);
+		add_bounds(lp,IntervalVector(n,Interval(-1,1)));
+
+		// random rows satisfied by a random point
+		Vector x0(n);
+		for (int j=0; j<n; j++) x0[j]=random(-1,1);
+		for (int i=0; i<m; i++) {
+			Vector a(n);
+			for (int j=0; j<n; j++) a[j]=random(-1,1);
+			lp.add_row(a,NEG_INFINITY,a*x0+random(0,0.5));
+		}
+
+		// all the bounds of the variables
+		for (int j=0; j<n; j++) {
+			for (int sign=-1; sign<=1; sign+=2) {
+				Vector c=Vector::zeros(n);
+				c[j]=sign;
+				lp.set_obj(j,sign);
+				TEST_ASSERT(lp.solve()==Simplex::OPTIMAL);
+				TEST_ASSERT(check_optimal(lp,c,1e-9));
+				lp.set_obj(j,0);
+			}
+		}
+	}
+}
+
+void TestSimplex::simplex06() {
+	// min -x-y s.t. 0<=1e-10*x<=2e-10, 0<=y<=3, x+y<=4
+	// (the crash basis makes x basic in the first row)
+	Simplex lp(2);
+	double _r1[]={1e-10,0};
+	double _r2[]={0,1};
+	double _r3[]={1,1};
+	lp.add_row(Vector(2,_r1),0,2e-10);
+	lp.add_row(Vector(2,_r2),0,3);
+	lp.add_row(Vector(2,_r3),NEG_INFINITY,4);
+	lp.set_obj(0,-1);
+	lp.set_obj(1,-1);
+
+	TEST_ASSERT(lp.solve()==Simplex::OPTIMAL);
+	TEST_ASSERT_DELTA(lp.obj_value(),-4,1e-9);
+	TEST_ASSERT(lp.primal(0)>=-1e-9 && lp.primal(0)<=2+1e-9);
+	TEST_ASSERT(lp.primal(1)>=-1e-9 && lp.primal(1)<=3+1e-9);
+}
+
+} // end namespace ibex
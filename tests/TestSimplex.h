@@ -0,0 +1,59 @@
+/* ============================================================================
+ * I B E X - Simplex Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : IBEX contributors
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_SIMPLEX_H__
+#define __TEST_SIMPLEX_H__
+
+#include "cpptest.h"
+#include "ibex_Simplex.h"
+#include "utils.h"
+
+namespace ibex {
+
+class TestSimplex : public TestIbex {
+
+public:
+
+	TestSimplex() {
+		TEST_ADD(TestSimplex::simplex01);
+		TEST_ADD(TestSimplex::simplex02);
+		TEST_ADD(TestSimplex::simplex03);
+		TEST_ADD(TestSimplex::simplex04);
+		TEST_ADD(TestSimplex::simplex05);
+		TEST_ADD(TestSimplex::simplex06);
+	}
+
+	// optimal solution and dual values
+	void simplex01();
+
+	// infeasible LP
+	void simplex02();
+
+	// unbounded LP
+	void simplex03();
+
+	// sequence of LPs (objective and bounds changed, rows added/removed)
+	void simplex04();
+
+	// random LPs: optimality conditions
+	void simplex05();
+
+	// singular crash basis (tiny coefficient)
+	void simplex06();
+
+private:
+	// check the optimality conditions of the last LP
+	bool check_optimal(const Simplex& lp, const Vector& c, double eps);
+};
+
+} // namespace ibex
+
+#endif // __TEST_SIMPLEX_H__
@@ -18,6 +18,8 @@
 #include "TestBitSet.h"
 #include "TestSymbolMap.h"
 #include "TestPixelMap.h"
+#include "TestMemoryPool.h"
+#include "TestClock.h"
 
 // ================ arithmetic ===============
 #include "TestInterval.h"
@@ -38,6 +40,7 @@
 #include "TestNumConstraint.h"
 #include "TestEval.h"
 #include "TestGradient.h"
+#include "TestEvalContext.h"
 #include "TestHC4Revise.h"
 #include "TestInHC4Revise.h"
 
@@ -51,6 +54,7 @@
 // ================ numeric ===============
 #include "TestLinear.h"
 #include "TestNewton.h"
+#include "TestSimplex.h"
 
 // ================ predicates ===============
 #include "TestPdcHansenFeasibility.h"
@@ -69,7 +73,10 @@
 
 
 // ================ strategy ===============
+#include "TestCell.h"
 #include "TestOptimizer.h"
+#include "TestParallelSolver.h"
+#include "TestParallelOptimizer.h"
 
 // ================ set ===============
 #include "TestSeparator.h"
@@ -91,6 +98,8 @@ int main() {
     ts.add(auto_ptr<Test::Suite>(new TestBitSet()));
     ts.add(auto_ptr<Test::Suite>(new TestSymbolMap()));
     ts.add(auto_ptr<Test::Suite>(new TestPixelMap()));
+    ts.add(auto_ptr<Test::Suite>(new TestMemoryPool()));
+    ts.add(auto_ptr<Test::Suite>(new TestClock()));
 
     ts.add(auto_ptr<Test::Suite>(new TestInterval()));
     ts.add(auto_ptr<Test::Suite>(new TestIntervalVector()));
@@ -116,9 +125,11 @@ int main() {
     ts.add(auto_ptr<Test::Suite>(new TestHC4Revise()));
     ts.add(auto_ptr<Test::Suite>(new TestInHC4Revise()));
     ts.add(auto_ptr<Test::Suite>(new TestGradient()));
+    ts.add(auto_ptr<Test::Suite>(new TestEvalContext()));
 
     ts.add(auto_ptr<Test::Suite>(new TestLinear()));
     ts.add(auto_ptr<Test::Suite>(new TestNewton()));
+    ts.add(auto_ptr<Test::Suite>(new TestSimplex()));
 
     ts.add(auto_ptr<Test::Suite>(new TestPdcHansenFeasibility()));
 
@@ -134,7 +145,10 @@ int main() {
 
     ts.add(auto_ptr<Test::Suite>(new TestFritzJohn()));
 
+    ts.add(auto_ptr<Test::Suite>(new TestCell()));
     ts.add(auto_ptr<Test::Suite>(new TestOptimizer()));
+    ts.add(auto_ptr<Test::Suite>(new TestParallelSolver()));
+    ts.add(auto_ptr<Test::Suite>(new TestParallelOptimizer()));
     ts.add(auto_ptr<Test::Suite>(new TestSeparator()));
     ts.add(auto_ptr<Test::Suite>(new TestSepPolygon()));
 